@@ -45,6 +45,8 @@ public class GASAttachEditor : ModuleRules
 				"GameplayTags",
 				"AssetRegistry",
 				"ApplicationCore",
+				"GASAttachRuntime",
+				"DesktopPlatform",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -3,10 +3,15 @@
 #include "GASAttachEditor.h"
 #include "Widgets/SGASEditorWidget.h"
 #include "GASAttachEditorCommands.h"
+#include "GASAttachEditorComponentRegistry.h"
 #include "Widgets/SGASTriggersWidget.h"
+#include "Widgets/SGASCaptureViewer.h"
 #include "Widgets/Docking/SDockTab.h"
+#include "GASAttachRuntime.h"
+#include "GASAttachFlightRecorder.h"
 
 #if WITH_EDITOR
+#include "Editor.h"
 #include "LevelEditor.h"
 #include "WorkspaceMenuStructure.h"
 #include "WorkspaceMenuStructureModule.h"
@@ -14,6 +19,7 @@
 
 static const FName GASAttachEditorTabName("GASAttachEditor");
 static const FName GASTriggersEditorTabName("GASTriggersEditor");
+static const FName GASCaptureViewerTabName("GASCaptureViewer");
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
 
@@ -45,6 +51,8 @@ void FGASAttachEditorModule::StartupModule()
 
 	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
 	LevelEditorModule.GetGlobalLevelEditorActions()->Append(PluginCommands.ToSharedRef());
+
+	EndPIEHandle = FEditorDelegates::EndPIE.AddRaw(this, &FGASAttachEditorModule::OnEndPIE);
 #endif
 
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(GASAttachEditorTabName, FOnSpawnTab::CreateRaw(this, &FGASAttachEditorModule::OnSpawnGASEditorTab))
@@ -55,6 +63,13 @@ void FGASAttachEditorModule::StartupModule()
 #endif
 		.SetIcon(FSlateIcon(FGASAttachEditorStyle::GetStyleName(), "GASAttachEditor.OpenPluginWindow"));
 
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(GASCaptureViewerTabName, FOnSpawnTab::CreateRaw(this, &FGASAttachEditorModule::OnSpawnGASCaptureViewerTab))
+		.SetDisplayName(LOCTEXT("FGASCaptureViewerTabTitle", "Ability System Capture Viewer"))
+		.SetTooltipText(LOCTEXT("FGASCaptureViewerTooltipText", "Opens 'Ability System Capture Viewer' tab"))
+#if WITH_EDITOR
+		.SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsDebugCategory())
+#endif
+		.SetIcon(FSlateIcon(FGASAttachEditorStyle::GetStyleName(), "GASAttachEditor.OpenPluginWindow"));
 
 #if WITH_EDITOR
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(GASTriggersEditorTabName, FOnSpawnTab::CreateRaw(this, &FGASAttachEditorModule::OnSpawnGASTriggersTab))
@@ -70,13 +85,51 @@ void FGASAttachEditorModule::ShutdownModule()
 	FGASAttachEditorStyle::Shutdown();
 
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(GASAttachEditorTabName);
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(GASCaptureViewerTabName);
 #if WITH_EDITOR
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(GASTriggersEditorTabName);
+
+	FEditorDelegates::EndPIE.Remove(EndPIEHandle);
 #endif
 
 	PluginCommands.Reset();
 
 	FGASAttachEditorCommands::Unregister();
+
+	FGASComponentRegistry::Shutdown();
+}
+
+#if WITH_EDITOR
+void FGASAttachEditorModule::OnEndPIE(const bool bIsSimulating)
+{
+	// Only the editor knows a session from a map travel within it, so the flight recorder hears it from here
+	const FGASAttachRuntimeModule* Module = FModuleManager::GetModulePtr<FGASAttachRuntimeModule>("GASAttachRuntime");
+	if (FGASFlightRecorder* FlightRecorder = Module ? Module->GetFlightRecorder() : nullptr)
+	{
+		FlightRecorder->OnPIEEnd();
+	}
+}
+#endif
+
+void FGASAttachEditorModule::OpenCaptureViewer(const FString& Filename)
+{
+	FGlobalTabmanager::Get()->TryInvokeTab(GASCaptureViewerTabName);
+
+	if (const TSharedPtr<SGASCaptureViewer> Viewer = CaptureViewer.Pin())
+	{
+		Viewer->Open(Filename);
+	}
+}
+
+TSharedRef<SWidget> FGASAttachEditorModule::MakeCaptureViewer(const FString& Filename, const bool bStandalone)
+{
+	const TSharedRef<SGASCaptureViewer> Viewer =
+		SNew(SGASCaptureViewer)
+		.Filename(Filename)
+		.RegisterCaptureTags(bStandalone);
+
+	CaptureViewer = Viewer;
+	return Viewer;
 }
 
 TSharedRef<SDockTab> FGASAttachEditorModule::OnSpawnGASEditorTab(const FSpawnTabArgs& SpawnTabArgs)
@@ -98,6 +151,24 @@ TSharedRef<SDockTab> FGASAttachEditorModule::OnSpawnGASEditorTab(const FSpawnTab
 	return NomadTab;
 }
 
+TSharedRef<SDockTab> FGASAttachEditorModule::OnSpawnGASCaptureViewerTab(const FSpawnTabArgs& SpawnTabArgs)
+{
+	const TSharedRef<SDockTab> NomadTab = SNew(SDockTab).TabRole(ETabRole::NomadTab);
+
+	NomadTab->SetContent(
+		SNew(SBorder)
+#if WITH_EDITOR
+		.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+#endif
+		.Padding(0.f, 2.f)
+		[
+			MakeCaptureViewer(FString(), false)
+		]
+	);
+
+	return NomadTab;
+}
+
 #if WITH_EDITOR
 TSharedRef<SDockTab> FGASAttachEditorModule::OnSpawnGASTriggersTab(const FSpawnTabArgs& SpawnTabArgs)
 {
@@ -131,6 +202,24 @@ FAutoConsoleCommandWithWorld AbilitySystemEditorShow(
 	FConsoleCommandWithWorldDelegate::CreateStatic(GASAttachEditorShow)
 );
 
+static void GASAttachEditorCaptureOpen(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	FGASAttachEditorModule* Module = FModuleManager::GetModulePtr<FGASAttachEditorModule>("GASAttachEditor");
+	if (!Module ||
+		Args.Num() == 0)
+	{
+		Ar.Logf(TEXT("Usage: GASAttachEditor.Capture.Open <File>"));
+		return;
+	}
+
+	Module->OpenCaptureViewer(Args[0]);
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemEditorCaptureOpen(
+	TEXT("GASAttachEditor.Capture.Open"),
+	TEXT("Open a capture file in the Ability System Capture Viewer."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorCaptureOpen));
+
 #undef LOCTEXT_NAMESPACE
 	
 IMPLEMENT_MODULE(FGASAttachEditorModule, GASAttachEditor)
\ No newline at end of file
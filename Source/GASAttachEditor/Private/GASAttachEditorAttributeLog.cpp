@@ -0,0 +1,230 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorAttributeLog.h"
+
+#include "GameplayEffect.h"
+#include "GameplayEffectExtension.h"
+#include "AbilitySystemComponent.h"
+
+FGASAttributeChangeLog::FGASAttributeChangeLog(const int32 Capacity)
+{
+	check(Capacity > 0);
+	Records.SetNum(Capacity);
+}
+
+void FGASAttributeChangeLog::Append(const FGASAttributeChangeRecord& Record)
+{
+	Records[NumWritten % Records.Num()] = Record;
+	++NumWritten;
+}
+
+uint64 FGASAttributeChangeLog::Read(TArray<FGASAttributeChangeRecord>& OutRecords) const
+{
+	OutRecords.Reset();
+
+	const uint64 Written = NumWritten;
+	const uint64 Capacity = Records.Num();
+	const uint64 First = Written > Capacity ? Written - Capacity : 0;
+
+	OutRecords.Reserve(static_cast<int32>(Written - First));
+	for (uint64 Index = First; Index < Written; ++Index)
+	{
+		OutRecords.Add(Records[Index % Capacity]);
+	}
+
+	return Written;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FGASAttributeChangeRecorder::~FGASAttributeChangeRecorder()
+{
+	Unbind();
+}
+
+void FGASAttributeChangeRecorder::Bind(UAbilitySystemComponent* Component)
+{
+	// Attribute sets can be added after the component was bound - rebind to pick their attributes up
+	if (IsBoundTo(Component) &&
+		Component->GetSpawnedAttributes().Num() == NumBoundSets)
+	{
+		return;
+	}
+
+	// Only the delegates are bound anew for a set added later, the history of the others stays
+	if (IsBoundTo(Component))
+	{
+		RemoveDelegates();
+	}
+	else
+	{
+		Unbind();
+	}
+
+	if (!Component)
+	{
+		return;
+	}
+
+	WeakComponent = Component;
+	NumBoundSets = Component->GetSpawnedAttributes().Num();
+
+	for (const UAttributeSet* Set : Component->GetSpawnedAttributes())
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		for (FStructProperty* Property : TFieldRange<FStructProperty>(Set->GetClass()))
+		{
+			if (!ensure(Property) ||
+				!Property->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				continue;
+			}
+
+			const FGameplayAttribute Attribute(Property);
+			if (Logs.Contains(Attribute))
+			{
+				continue;
+			}
+
+			// Logs are created before any delegate is bound, the map never changes while recording
+			Logs.Add(Attribute, MakeUnique<FGASAttributeChangeLog>(RecordsPerAttribute));
+		}
+	}
+
+	for (const TPair<FGameplayAttribute, TUniquePtr<FGASAttributeChangeLog>>& It : Logs)
+	{
+		const FDelegateHandle Handle = Component->GetGameplayAttributeValueChangeDelegate(It.Key).AddRaw(this, &FGASAttributeChangeRecorder::HandleAttributeChanged);
+		DelegateHandles.Add(It.Key, Handle);
+	}
+}
+
+void FGASAttributeChangeRecorder::Unbind()
+{
+	RemoveDelegates();
+
+	WeakComponent = nullptr;
+	NumBoundSets = 0;
+	Logs.Reset();
+}
+
+void FGASAttributeChangeRecorder::RemoveDelegates()
+{
+	if (UAbilitySystemComponent* Component = WeakComponent.Get())
+	{
+		for (const TPair<FGameplayAttribute, FDelegateHandle>& It : DelegateHandles)
+		{
+			Component->GetGameplayAttributeValueChangeDelegate(It.Key).Remove(It.Value);
+		}
+	}
+
+	DelegateHandles.Reset();
+}
+
+bool FGASAttributeChangeRecorder::IsBoundTo(const UAbilitySystemComponent* Component) const
+{
+	return
+		Component &&
+		WeakComponent.Get() == Component;
+}
+
+const FGASAttributeChangeLog* FGASAttributeChangeRecorder::FindLog(const FGameplayAttribute& Attribute) const
+{
+	const TUniquePtr<FGASAttributeChangeLog>* Log = Logs.Find(Attribute);
+	return Log ? Log->Get() : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FGASAttributeChangeRecorder::HandleAttributeChanged(const FOnAttributeChangeData& ChangeData)
+{
+	const TUniquePtr<FGASAttributeChangeLog>* Log = Logs.Find(ChangeData.Attribute);
+	if (!Log)
+	{
+		return;
+	}
+
+	FGASAttributeChangeRecord Record;
+	Record.Frame = GFrameCounter;
+	Record.OldValue = ChangeData.OldValue;
+	Record.NewValue = ChangeData.NewValue;
+	Record.Magnitude = ChangeData.NewValue - ChangeData.OldValue;
+
+	const UAbilitySystemComponent* Component = WeakComponent.Get();
+	if (const UWorld* World = Component ? Component->GetWorld() : nullptr)
+	{
+		Record.WorldTime = World->GetTimeSeconds();
+	}
+
+	if (const FGameplayEffectModCallbackData* ModData = ChangeData.GEModData)
+	{
+		const FGameplayEffectSpec& Spec = ModData->EffectSpec;
+
+		Record.bExecuted = true;
+		Record.Magnitude = ModData->EvaluatedData.Magnitude;
+		Record.EffectHandle = ModData->EvaluatedData.Handle;
+		Record.EffectName = Spec.Def ? Spec.Def->GetFName() : NAME_None;
+
+		if (const AActor* Instigator = Spec.GetContext().GetInstigator())
+		{
+			Record.InstigatorName = Instigator->GetFName();
+		}
+	}
+	else
+	{
+		InferSource(ChangeData.Attribute, Record);
+	}
+
+	(*Log)->Append(Record);
+}
+
+void FGASAttributeChangeRecorder::InferSource(const FGameplayAttribute& Attribute, FGASAttributeChangeRecord& Record) const
+{
+	const UAbilitySystemComponent* Component = WeakComponent.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	const FActiveGameplayEffect* Newest = nullptr;
+	for (auto It = Component->GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+	{
+		const FActiveGameplayEffect& ActiveGameplayEffect = *It;
+		if (!ActiveGameplayEffect.Spec.Def)
+		{
+			continue;
+		}
+
+		const bool bModifiesAttribute = ActiveGameplayEffect.Spec.Def->Modifiers.ContainsByPredicate([&Attribute](const FGameplayModifierInfo& ModifierInfo)
+		{
+			return ModifierInfo.Attribute == Attribute;
+		});
+
+		if (bModifiesAttribute &&
+			(!Newest || ActiveGameplayEffect.StartWorldTime >= Newest->StartWorldTime))
+		{
+			Newest = &ActiveGameplayEffect;
+		}
+	}
+
+	if (!Newest)
+	{
+		return;
+	}
+
+	Record.bInferred = true;
+	Record.EffectHandle = Newest->Handle;
+	Record.EffectName = Newest->Spec.Def->GetFName();
+
+	if (const AActor* Instigator = Newest->Spec.GetContext().GetInstigator())
+	{
+		Record.InstigatorName = Instigator->GetFName();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "ActiveGameplayEffectHandle.h"
+
+class UAbilitySystemComponent;
+struct FOnAttributeChangeData;
+
+/**
+ * One attribute change, as seen by the attribute's value change delegate.
+ *
+ * Executed (instant or periodic) modifiers carry their spec, so the source is exact. Duration based
+ * modifiers only re-evaluate the aggregator and arrive without a spec - for those the newest active
+ * effect that modifies the attribute is recorded instead and the record is flagged as inferred.
+ */
+struct FGASAttributeChangeRecord
+{
+	uint64 Frame = 0;
+	double WorldTime = 0.0;
+	float OldValue = 0.f;
+	float NewValue = 0.f;
+	float Magnitude = 0.f;
+
+	FActiveGameplayEffectHandle EffectHandle;
+	FName EffectName;
+	FName InstigatorName;
+
+	bool bExecuted = false;
+	bool bInferred = false;
+};
+
+/**
+ * Fixed capacity append log for a single attribute.
+ *
+ * Game thread only: the writer is the attribute change delegate and the readers are the tabs, and nothing
+ * guards a slot being overwritten while it's read. It isn't lock-free, as attribute delegates only ever
+ * fire on the game thread, so there is no other thread to publish to. Storage is allocated once up front
+ * and never grows - once full, the oldest records are overwritten.
+ */
+class FGASAttributeChangeLog
+{
+public:
+	explicit FGASAttributeChangeLog(int32 Capacity);
+
+	void Append(const FGASAttributeChangeRecord& Record);
+
+	/** Copies the records, oldest first. Returns the total number ever written. */
+	uint64 Read(TArray<FGASAttributeChangeRecord>& OutRecords) const;
+
+	uint64 GetNumWritten() const { return NumWritten; }
+
+private:
+	TArray<FGASAttributeChangeRecord> Records;
+	uint64 NumWritten = 0;
+};
+
+/**
+ * Opt-in hook on the inspected component's attribute change delegates.
+ *
+ * Every attribute of every spawned attribute set gets its own log, created when the component is
+ * bound, so a chatty attribute never evicts the history of a quiet one. Sets spawned later get theirs
+ * when Bind is called again; the logs already there keep their history.
+ */
+class FGASAttributeChangeRecorder
+{
+public:
+	FGASAttributeChangeRecorder() = default;
+	~FGASAttributeChangeRecorder();
+
+	FGASAttributeChangeRecorder(const FGASAttributeChangeRecorder&) = delete;
+	FGASAttributeChangeRecorder& operator=(const FGASAttributeChangeRecorder&) = delete;
+
+	void Bind(UAbilitySystemComponent* Component);
+	void Unbind();
+
+	bool IsBoundTo(const UAbilitySystemComponent* Component) const;
+
+	const FGASAttributeChangeLog* FindLog(const FGameplayAttribute& Attribute) const;
+
+private:
+	void RemoveDelegates();
+	void HandleAttributeChanged(const FOnAttributeChangeData& ChangeData);
+	void InferSource(const FGameplayAttribute& Attribute, FGASAttributeChangeRecord& Record) const;
+
+	static constexpr int32 RecordsPerAttribute = 256;
+
+private:
+	TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
+	int32 NumBoundSets = 0;
+	TMap<FGameplayAttribute, FDelegateHandle> DelegateHandles;
+	TMap<FGameplayAttribute, TUniquePtr<FGASAttributeChangeLog>> Logs;
+};
\ No newline at end of file
@@ -0,0 +1,274 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorBenchmark.h"
+#include "GASAttachEditorNodePool.h"
+#include "Widgets/SGASAbilitiesTab.h"
+#include "Widgets/SGASAttributesTab.h"
+#include "Widgets/SGASGameplayTagsTab.h"
+#include "Widgets/SGASGameplayEffectsTab.h"
+
+#include "Engine/Engine.h"
+#include "GameplayEffect.h"
+#include "GameplayAbilitySpec.h"
+#include "GameplayTagsManager.h"
+#include "GameFramework/Actor.h"
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemTestAttributeSet.h"
+#include "HAL/IConsoleManager.h"
+
+namespace GASAttachEditorBenchmark
+{
+	void FConfig::Parse(const TArray<FString>& Args)
+	{
+		const FString Line = FString::Join(Args, TEXT(" "));
+
+		FParse::Value(*Line, TEXT("Components="), Components);
+		FParse::Value(*Line, TEXT("Abilities="), Abilities);
+		FParse::Value(*Line, TEXT("AttributeSets="), AttributeSets);
+		FParse::Value(*Line, TEXT("Effects="), Effects);
+		FParse::Value(*Line, TEXT("Modifiers="), Modifiers);
+		FParse::Value(*Line, TEXT("Tags="), Tags);
+		FParse::Value(*Line, TEXT("Iterations="), Iterations);
+
+		Components = FMath::Max(Components, 1);
+		Iterations = FMath::Max(Iterations, 1);
+	}
+
+	/** A transient game world full of synthetic components, torn down again when it goes out of scope */
+	class FEnvironment
+	{
+	public:
+		explicit FEnvironment(const FConfig& Config, FOutputDevice& Ar)
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GASAttachEditorBenchmark"));
+
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+			WorldContextHandle = WorldContext.ContextHandle;
+
+			CreateEffects(Config);
+
+			FGameplayTagContainer AllTags;
+			UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+			AllTags.GetGameplayTagArray(Tags);
+			if (Tags.Num() < Config.Tags)
+			{
+				Ar.Logf(TEXT("Only %d gameplay tags are registered, %d were asked for"), Tags.Num(), Config.Tags);
+			}
+			Tags.SetNum(FMath::Min(Tags.Num(), Config.Tags));
+
+			for (int32 Index = 0; Index < Config.Components; ++Index)
+			{
+				CreateComponent(Config);
+			}
+		}
+
+		~FEnvironment()
+		{
+			for (UGameplayEffect* Effect : Effects)
+			{
+				Effect->RemoveFromRoot();
+			}
+
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		FName GetWorldContextHandle() const { return WorldContextHandle; }
+		const TArray<UAbilitySystemComponent*>& GetComponents() const { return Components; }
+
+	private:
+		void CreateEffects(const FConfig& Config)
+		{
+			TArray<FGameplayAttribute> Attributes;
+			for (FStructProperty* Property : TFieldRange<FStructProperty>(UAbilitySystemTestAttributeSet::StaticClass()))
+			{
+				if (Property->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+				{
+					Attributes.Add(FGameplayAttribute(Property));
+				}
+			}
+
+			for (int32 Index = 0; Index < Config.Effects; ++Index)
+			{
+				UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), *FString::Printf(TEXT("GE_Benchmark_%d"), Index));
+				Effect->AddToRoot();
+				Effect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+				for (int32 ModifierIndex = 0; ModifierIndex < Config.Modifiers && Attributes.Num() > 0; ++ModifierIndex)
+				{
+					FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+					Modifier.Attribute = Attributes[(Index + ModifierIndex) % Attributes.Num()];
+					Modifier.ModifierOp = EGameplayModOp::Additive;
+					Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.f));
+				}
+
+				Effects.Add(Effect);
+			}
+		}
+
+		void CreateComponent(const FConfig& Config)
+		{
+			AActor* Actor = World->SpawnActor<AActor>();
+			UAbilitySystemComponent* Component = NewObject<UAbilitySystemComponent>(Actor);
+			Component->RegisterComponent();
+			Component->InitAbilityActorInfo(Actor, Actor);
+
+			for (int32 Index = 0; Index < Config.AttributeSets; ++Index)
+			{
+				Component->AddSpawnedAttribute(NewObject<UAbilitySystemTestAttributeSet>(Actor));
+			}
+
+			for (int32 Index = 0; Index < Config.Abilities; ++Index)
+			{
+				Component->GiveAbility(FGameplayAbilitySpec(UGameplayAbility::StaticClass(), 1 + Index % 5));
+			}
+
+			for (UGameplayEffect* Effect : Effects)
+			{
+				Component->ApplyGameplayEffectToSelf(Effect, 1.f, Component->MakeEffectContext());
+			}
+
+			for (const FGameplayTag& Tag : Tags)
+			{
+				Component->AddLooseGameplayTag(Tag);
+			}
+
+			Components.Add(Component);
+		}
+
+	private:
+		UWorld* World = nullptr;
+		FName WorldContextHandle;
+		TArray<UGameplayEffect*> Effects;
+		TArray<FGameplayTag> Tags;
+		TArray<UAbilitySystemComponent*> Components;
+	};
+
+	static FTabResult MeasureTab(const TCHAR* Name, const FGASNodePool& NodePool, const FConfig& Config, const FEnvironment& Environment, TFunctionRef<void(UAbilitySystemComponent*)> RefreshTab, const TFunction<void(const FText&)>& SetSearchText, FOutputDevice& Ar)
+	{
+		const TArray<UAbilitySystemComponent*>& Components = Environment.GetComponents();
+		const FGASNodePoolStats StartStats = NodePool.GetStats();
+
+		FTabResult Result;
+		Result.Name = Name;
+
+		double StartTime = FPlatformTime::Seconds();
+		RefreshTab(Components[0]);
+		Result.ColdMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		const FGASNodePoolStats ColdStats = NodePool.GetStats();
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Config.Iterations; ++Iteration)
+		{
+			RefreshTab(Components[0]);
+		}
+		Result.SteadyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Config.Iterations;
+		Result.SteadyConstructed = NodePool.GetStats().NumConstructed - ColdStats.NumConstructed;
+
+		// Every refresh lands on another component than the one before, so every node is dropped and rebuilt;
+		// starting past Components[0], which the steady refreshes left in the tab
+		if (Components.Num() >= 2)
+		{
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Config.Iterations; ++Iteration)
+			{
+				RefreshTab(Components[(Iteration + 1) % Components.Num()]);
+			}
+			Result.SwitchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Config.Iterations;
+		}
+
+		if (SetSearchText)
+		{
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Config.Iterations; ++Iteration)
+			{
+				SetSearchText(FText::FromString(TEXT("1")));
+				SetSearchText(FText::GetEmpty());
+			}
+			Result.FilterMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / (Config.Iterations * 2);
+		}
+
+		const FGASNodePoolStats EndStats = NodePool.GetStats();
+		Result.NumConstructed = EndStats.NumConstructed - StartStats.NumConstructed;
+		Result.NumChunks = EndStats.NumChunks - StartStats.NumChunks;
+		Result.HighWaterMark = EndStats.HighWaterMark;
+
+		Ar.Logf(TEXT("%-16s cold %8.3f ms | steady %8.3f ms | switching %s | filter %8.3f ms | nodes constructed %d (steady %d), pool chunks added %d, live nodes at most %d"),
+			Name,
+			Result.ColdMs,
+			Result.SteadyMs,
+			Components.Num() >= 2 ? *FString::Printf(TEXT("%8.3f ms"), Result.SwitchMs) : TEXT("n/a (1 component)"),
+			Result.FilterMs,
+			Result.NumConstructed,
+			Result.SteadyConstructed,
+			Result.NumChunks,
+			Result.HighWaterMark);
+
+		return Result;
+	}
+
+	void Run(const FConfig& Config, TArray<FTabResult>& OutResults, FOutputDevice& Ar)
+	{
+		OutResults.Reset();
+
+		Ar.Logf(TEXT("GAS Attach Editor benchmark: %d components, %d abilities, %d attribute sets, %d effects x %d modifiers, %d tags, %d iterations"),
+			Config.Components,
+			Config.Abilities,
+			Config.AttributeSets,
+			Config.Effects,
+			Config.Modifiers,
+			Config.Tags,
+			Config.Iterations);
+
+		const FEnvironment Environment(Config, Ar);
+		const FName WorldContextHandle = Environment.GetWorldContextHandle();
+
+		TSharedRef<SGASAbilitiesTab> AbilitiesTab = SNew(SGASAbilitiesTab);
+		OutResults.Add(MeasureTab(TEXT("Abilities"), AbilitiesTab->GetNodePool(), Config, Environment,
+			[&AbilitiesTab](UAbilitySystemComponent* Component) { AbilitiesTab->Refresh(Component); },
+			[&AbilitiesTab](const FText& Text) { AbilitiesTab->SetSearchText(Text); },
+			Ar));
+
+		TSharedRef<SGASAttributesTab> AttributesTab = SNew(SGASAttributesTab);
+		OutResults.Add(MeasureTab(TEXT("Attributes"), AttributesTab->GetNodePool(), Config, Environment,
+			[&AttributesTab](UAbilitySystemComponent* Component) { AttributesTab->Refresh(Component); },
+			[&AttributesTab](const FText& Text) { AttributesTab->SetSearchText(Text); },
+			Ar));
+
+		TSharedRef<SGASGameplayEffectsTab> GameplayEffectsTab = SNew(SGASGameplayEffectsTab);
+		OutResults.Add(MeasureTab(TEXT("Gameplay Effects"), GameplayEffectsTab->GetNodePool(), Config, Environment,
+			[&GameplayEffectsTab, WorldContextHandle](UAbilitySystemComponent* Component) { GameplayEffectsTab->Refresh(Component, WorldContextHandle); },
+			[&GameplayEffectsTab](const FText& Text) { GameplayEffectsTab->SetSearchText(Text); },
+			Ar));
+
+		TSharedRef<SGASGameplayTagsTab> GameplayTagsTab = SNew(SGASGameplayTagsTab);
+		OutResults.Add(MeasureTab(TEXT("Gameplay Tags"), GameplayTagsTab->GetNodePool(), Config, Environment,
+			[&GameplayTagsTab](UAbilitySystemComponent* Component) { GameplayTagsTab->Refresh(Component); },
+			nullptr,
+			Ar));
+
+		// Drop the nodes while their components are still around
+		AbilitiesTab->Refresh(nullptr);
+		AttributesTab->Refresh(nullptr);
+		GameplayEffectsTab->Refresh(nullptr, NAME_None);
+		GameplayTagsTab->Refresh(nullptr);
+	}
+
+	static void RunCommand(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		FConfig Config;
+		Config.Parse(Args);
+
+		TArray<FTabResult> Results;
+		Run(Config, Results, Ar);
+	}
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice GASAttachEditorBenchmarkCommand(
+	TEXT("GASAttachEditor.Benchmark"),
+	TEXT("Builds synthetic Ability System Components in a transient world and times every tab's refresh and filter.\n")
+	TEXT("Optional: Components=8 Abilities=32 AttributeSets=2 Effects=64 Modifiers=4 Tags=32 Iterations=20"),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&GASAttachEditorBenchmark::RunCommand));
\ No newline at end of file
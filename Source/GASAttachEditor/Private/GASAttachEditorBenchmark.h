@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Times every tab's refresh and filter over synthetic Ability System Components in a transient game world.
+ * Run by the GASAttachEditor.Benchmark console command, which logs the results, and by the automation test
+ * that holds them to a budget.
+ */
+namespace GASAttachEditorBenchmark
+{
+	struct FConfig
+	{
+		int32 Components = 8;
+		int32 Abilities = 32;
+		int32 AttributeSets = 2;
+		int32 Effects = 64;
+		int32 Modifiers = 4;
+		int32 Tags = 32;
+		int32 Iterations = 20;
+
+		/** Reads "Components=8 Effects=64 ..."; whatever isn't given keeps its default */
+		void Parse(const TArray<FString>& Args);
+	};
+
+	/** Timings of one tab: the first refresh builds every node, the rest only update them */
+	struct FTabResult
+	{
+		FString Name;
+
+		double ColdMs = 0.0;
+		// Per refresh of the same component
+		double SteadyMs = 0.0;
+		// Per refresh landing on another component, which drops and rebuilds every node; zero with a single component
+		double SwitchMs = 0.0;
+		// Per change of the search text; zero for tabs without one
+		double FilterMs = 0.0;
+
+		// Of the steady refreshes alone, which should reuse every node
+		int32 SteadyConstructed = 0;
+		// Of the whole run. These count the node pool's work, not calls into the global allocator: a chunk holds
+		// many slots, and the nodes' own members may still allocate
+		int32 NumConstructed = 0;
+		int32 NumChunks = 0;
+		int32 HighWaterMark = 0;
+	};
+
+	/** Builds the world Config asks for, measures each tab on it and tears it down again. Game thread only */
+	void Run(const FConfig& Config, TArray<FTabResult>& OutResults, FOutputDevice& Ar);
+}
\ No newline at end of file
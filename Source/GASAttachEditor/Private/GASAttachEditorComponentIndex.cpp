@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorComponentIndex.h"
+#include "GASAttachEditorComponentRegistry.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameFramework/Actor.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+bool FGASComponentIndex::Update(const UWorld* World)
+{
+	if (IndexedWorld.Get() != World)
+	{
+		Reset();
+		IndexedWorld = World;
+	}
+
+	if (!World)
+	{
+		return false;
+	}
+
+	bool bChanged = false;
+
+	// Components only join as they are created; the ones already indexed are found again by key
+	const FGASComponentRegistry& Registry = FGASComponentRegistry::Get();
+	if (Registry.GetGeneration() != RegistryGeneration)
+	{
+		RegistryGeneration = Registry.GetGeneration();
+
+		TArray<UAbilitySystemComponent*> Components;
+		Registry.GetComponents(Components);
+		for (UAbilitySystemComponent* Component : Components)
+		{
+			if (Component->GetWorld() != World)
+			{
+				continue;
+			}
+
+			TSharedPtr<FGASComponentIndexEntry>& Entry = Entries.FindOrAdd(Component);
+			if (!Entry)
+			{
+				Entry = MakeShared<FGASComponentIndexEntry>();
+				Entry->Component = Component;
+			}
+		}
+	}
+
+	// Destroyed components go before the garbage collector gets to them, as the registry only hears of it then
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FGASComponentIndexEntry& Entry = *It.Value();
+		const UAbilitySystemComponent* Component = Entry.Component.Get();
+		if (!IsValid(Component))
+		{
+			It.RemoveCurrent();
+			bChanged = true;
+			continue;
+		}
+
+		const AActor* Target = GetTarget(Component);
+		if (!Entry.bResolved ||
+			Entry.Target.Get() != Target ||
+			(Target && Target->GetLocalRole() != Entry.Role))
+		{
+			Resolve(Entry, Component, Target);
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		SortedEntries.Reset(Entries.Num());
+		for (const TPair<TObjectKey<UAbilitySystemComponent>, TSharedPtr<FGASComponentIndexEntry>>& It : Entries)
+		{
+			SortedEntries.Add(It.Value);
+		}
+
+		SortedEntries.Sort([](const TSharedPtr<const FGASComponentIndexEntry>& A, const TSharedPtr<const FGASComponentIndexEntry>& B)
+		{
+			return A->Name < B->Name;
+		});
+
+		++Generation;
+	}
+
+	return bChanged;
+}
+
+void FGASComponentIndex::Reset()
+{
+	if (Entries.Num() > 0)
+	{
+		++Generation;
+	}
+
+	IndexedWorld = nullptr;
+	RegistryGeneration = 0;
+	Entries.Reset();
+	SortedEntries.Reset();
+}
+
+bool FGASComponentIndex::Contains(const UAbilitySystemComponent* Component) const
+{
+	return
+		Component &&
+		Entries.Contains(Component);
+}
+
+FText FGASComponentIndex::GetComponentName(const UAbilitySystemComponent* Component)
+{
+	const AActor* Target = GetTarget(Component);
+	if (!Target)
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	const FText Name = FText::FromString(Target->GetActorNameOrLabel());
+
+	// We don't want to show local roles for standalone worlds
+	if (Component->GetWorld()->GetNetMode() == NM_Standalone)
+	{
+		return Name;
+	}
+
+	return FText::Format(LOCTEXT("ComponentNameWithRoleFormat", "{0} [{1}]"), Name, GetRoleName(Target->GetLocalRole()));
+}
+
+FText FGASComponentIndex::GetRoleName(const ENetRole Role)
+{
+	switch (Role)
+	{
+	default: return FText::GetEmpty();
+	case ROLE_SimulatedProxy: return LOCTEXT("SimulatedProxy", "Simulated Proxy");
+	case ROLE_AutonomousProxy: return LOCTEXT("AutonomousProxy", "Autonomous Proxy");
+	case ROLE_Authority: return LOCTEXT("Authority", "Authority");
+	}
+}
+
+const AActor* FGASComponentIndex::GetTarget(const UAbilitySystemComponent* Component)
+{
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	const AActor* Avatar = Component->GetAvatarActor_Direct();
+	return Avatar ? Avatar : Component->GetOwnerActor();
+}
+
+void FGASComponentIndex::Resolve(FGASComponentIndexEntry& Entry, const UAbilitySystemComponent* Component, const AActor* Target)
+{
+	Entry.bResolved = true;
+	Entry.Target = Target;
+	Entry.Role = Target ? Target->GetLocalRole() : ROLE_None;
+	Entry.Name = Target ? Target->GetActorNameOrLabel() : FString();
+	Entry.DisplayName = GetComponentName(Component);
+	Entry.ClassKey = Target ? Target->GetClass()->GetFName() : NAME_None;
+	Entry.ClassName = Target ? FText::FromString(FName::NameToDisplayString(Target->GetClass()->GetName(), false)) : LOCTEXT("None", "None");
+	Entry.RoleName = GetRoleName(Entry.Role);
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineTypes.h"
+
+class AActor;
+class UWorld;
+class UAbilitySystemComponent;
+
+/** What the actor picker needs to know about one component, resolved once and kept */
+struct FGASComponentIndexEntry
+{
+	TWeakObjectPtr<UAbilitySystemComponent> Component;
+
+	// The avatar, or the owner while there is no avatar yet
+	TWeakObjectPtr<const AActor> Target;
+
+	FString Name;
+	FText DisplayName;
+	FName ClassKey;
+	FText ClassName;
+	FText RoleName;
+	ENetRole Role = ROLE_None;
+
+private:
+	friend class FGASComponentIndex;
+	bool bResolved = false;
+};
+
+/**
+ * The Ability System Components of one world, with their names, classes and net roles.
+ *
+ * Entries come and go with the components, as FGASComponentRegistry sees them created and deleted; Update
+ * only looks through the registry when its generation moved. Each update then checks the entries of the
+ * world alone, and only resolves the ones that are new or whose target actor or role changed - avatars are
+ * often set after the component is created, and roles change on possession. Entries are kept sorted by name,
+ * and the generation moves on whenever anything was added, removed or re-resolved, so views built on
+ * top of the index only rebuild when it actually changed.
+ */
+class FGASComponentIndex
+{
+public:
+	/** Returns true if anything changed. Switching to another world starts over. */
+	bool Update(const UWorld* World);
+	void Reset();
+
+	bool Contains(const UAbilitySystemComponent* Component) const;
+
+	const TArray<TSharedPtr<const FGASComponentIndexEntry>>& GetEntries() const { return SortedEntries; }
+	uint32 GetGeneration() const { return Generation; }
+
+	/** "Name [Role]", without the role in standalone worlds */
+	static FText GetComponentName(const UAbilitySystemComponent* Component);
+	static FText GetRoleName(ENetRole Role);
+
+private:
+	static const AActor* GetTarget(const UAbilitySystemComponent* Component);
+	static void Resolve(FGASComponentIndexEntry& Entry, const UAbilitySystemComponent* Component, const AActor* Target);
+
+private:
+	TWeakObjectPtr<const UWorld> IndexedWorld;
+	TMap<TObjectKey<UAbilitySystemComponent>, TSharedPtr<FGASComponentIndexEntry>> Entries;
+	TArray<TSharedPtr<const FGASComponentIndexEntry>> SortedEntries;
+
+	// Of the registry, when its components were last looked through; zero for never
+	uint32 RegistryGeneration = 0;
+	uint32 Generation = 0;
+};
\ No newline at end of file
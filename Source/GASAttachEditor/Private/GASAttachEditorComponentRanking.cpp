@@ -0,0 +1,356 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorComponentRanking.h"
+#include "GASAttachEditorComponentIndex.h"
+#include "GASAttachEditorAbilityAccessors.h"
+#include "GASAttachEditorStats.h"
+
+#include "AbilitySystemComponent.h"
+#include "HAL/IConsoleManager.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+static TAutoConsoleVariable<int32> CVarRankingBatch(
+	TEXT("GASAttachEditor.Refresh.RankingBatch"),
+	256,
+	TEXT("Number of components the heaviest components ranking re-samples per update. The whole world is covered every ceil(components / batch) updates."));
+
+static TAutoConsoleVariable<int32> CVarRankingFrames(
+	TEXT("GASAttachEditor.Refresh.RankingFrames"),
+	4,
+	TEXT("Frames between two updates of the heaviest components ranking."));
+
+void FGASRankingHeap::Set(const int32 Id, const int32 Value)
+{
+	if (Id >= Positions.Num())
+	{
+		const int32 OldNum = Positions.Num();
+		Values.SetNumZeroed(Id + 1);
+		Positions.SetNumUninitialized(Id + 1);
+		for (int32 NewId = OldNum; NewId <= Id; ++NewId)
+		{
+			Positions[NewId] = INDEX_NONE;
+		}
+	}
+
+	int32& Position = Positions[Id];
+	if (Position == INDEX_NONE)
+	{
+		Values[Id] = Value;
+		Position = Heap.Add(Id);
+		SiftUp(Position);
+		return;
+	}
+
+	const int32 OldValue = Values[Id];
+	Values[Id] = Value;
+
+	if (Value > OldValue)
+	{
+		SiftUp(Position);
+	}
+	else if (Value < OldValue)
+	{
+		SiftDown(Position);
+	}
+}
+
+void FGASRankingHeap::Remove(const int32 Id)
+{
+	if (!Positions.IsValidIndex(Id) ||
+		Positions[Id] == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 Position = Positions[Id];
+	const int32 LastPosition = Heap.Num() - 1;
+
+	SwapPositions(Position, LastPosition);
+	Heap.Pop();
+	Positions[Id] = INDEX_NONE;
+	Values[Id] = 0;
+
+	if (Position < Heap.Num())
+	{
+		// The id moved into the hole may belong either above or below it
+		const int32 MovedId = Heap[Position];
+		SiftUp(Position);
+		SiftDown(Positions[MovedId]);
+	}
+}
+
+void FGASRankingHeap::Reset()
+{
+	Heap.Reset();
+	Values.Reset();
+	Positions.Reset();
+}
+
+void FGASRankingHeap::GetTop(const int32 Count, TArray<int32>& OutIds) const
+{
+	OutIds.Reset();
+	if (Heap.Num() == 0 ||
+		Count <= 0)
+	{
+		return;
+	}
+
+	// Walks the heap best first: the next largest value is always a child of one already taken
+	TArray<int32> Frontier;
+	Frontier.HeapPush(0, [this](const int32 A, const int32 B)
+	{
+		return IsAbove(Heap[A], Heap[B]);
+	});
+
+	while (Frontier.Num() > 0 &&
+		OutIds.Num() < Count)
+	{
+		int32 Position = INDEX_NONE;
+		Frontier.HeapPop(Position, [this](const int32 A, const int32 B)
+		{
+			return IsAbove(Heap[A], Heap[B]);
+		});
+
+		OutIds.Add(Heap[Position]);
+
+		for (const int32 Child : { Position * 2 + 1, Position * 2 + 2 })
+		{
+			if (Child < Heap.Num())
+			{
+				Frontier.HeapPush(Child, [this](const int32 A, const int32 B)
+				{
+					return IsAbove(Heap[A], Heap[B]);
+				});
+			}
+		}
+	}
+}
+
+void FGASRankingHeap::SiftUp(int32 Position)
+{
+	while (Position > 0)
+	{
+		const int32 Parent = (Position - 1) / 2;
+		if (!IsAbove(Heap[Position], Heap[Parent]))
+		{
+			break;
+		}
+
+		SwapPositions(Position, Parent);
+		Position = Parent;
+	}
+}
+
+void FGASRankingHeap::SiftDown(int32 Position)
+{
+	for (;;)
+	{
+		const int32 Left = Position * 2 + 1;
+		const int32 Right = Left + 1;
+
+		int32 Largest = Position;
+		if (Left < Heap.Num() &&
+			IsAbove(Heap[Left], Heap[Largest]))
+		{
+			Largest = Left;
+		}
+		if (Right < Heap.Num() &&
+			IsAbove(Heap[Right], Heap[Largest]))
+		{
+			Largest = Right;
+		}
+
+		if (Largest == Position)
+		{
+			break;
+		}
+
+		SwapPositions(Position, Largest);
+		Position = Largest;
+	}
+}
+
+void FGASRankingHeap::SwapPositions(const int32 A, const int32 B)
+{
+	Heap.Swap(A, B);
+	Positions[Heap[A]] = A;
+	Positions[Heap[B]] = B;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool FGASComponentRanking::Update(const FGASComponentIndex& Index)
+{
+	if (GFrameCounter - LastUpdateFrame < uint64(FMath::Max(CVarRankingFrames.GetValueOnGameThread(), 1)))
+	{
+		return false;
+	}
+	LastUpdateFrame = GFrameCounter;
+
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_Ranking);
+
+	// Components that left the index must not linger at the top
+	bool bChanged = false;
+	if (Index.GetGeneration() != IndexGeneration)
+	{
+		SyncSlots(Index);
+		IndexGeneration = Index.GetGeneration();
+		bChanged = true;
+	}
+
+	const TArray<TSharedPtr<const FGASComponentIndexEntry>>& Entries = Index.GetEntries();
+	if (Entries.Num() == 0)
+	{
+		return bChanged;
+	}
+
+	const int32 BatchSize = FMath::Clamp(CVarRankingBatch.GetValueOnGameThread(), 1, Entries.Num());
+
+	for (int32 Step = 0; Step < BatchSize; ++Step)
+	{
+		Cursor = Cursor % Entries.Num();
+
+		if (const int32* SlotId = SlotIds.Find(Entries[Cursor].Get()))
+		{
+			bChanged |= Sample(*SlotId);
+		}
+
+		++Cursor;
+	}
+
+	return bChanged;
+}
+
+void FGASComponentRanking::Reset()
+{
+	SlotIds.Reset();
+	Slots.Reset();
+	FreeSlotIds.Reset();
+
+	for (FGASRankingHeap& Heap : Heaps)
+	{
+		Heap.Reset();
+	}
+
+	IndexGeneration = 0;
+	Cursor = 0;
+	LastUpdateFrame = 0;
+}
+
+void FGASComponentRanking::SyncSlots(const FGASComponentIndex& Index)
+{
+	++SyncStamp;
+
+	for (const TSharedPtr<const FGASComponentIndexEntry>& Entry : Index.GetEntries())
+	{
+		int32& SlotId = SlotIds.FindOrAdd(Entry.Get(), INDEX_NONE);
+		if (SlotId == INDEX_NONE)
+		{
+			SlotId = FreeSlotIds.Num() > 0 ? FreeSlotIds.Pop() : Slots.AddDefaulted();
+			Slots[SlotId].Entry = Entry;
+		}
+
+		Slots[SlotId].SyncStamp = SyncStamp;
+	}
+
+	for (auto It = SlotIds.CreateIterator(); It; ++It)
+	{
+		const int32 SlotId = It.Value();
+		if (Slots[SlotId].SyncStamp == SyncStamp)
+		{
+			continue;
+		}
+
+		for (FGASRankingHeap& Heap : Heaps)
+		{
+			Heap.Remove(SlotId);
+		}
+
+		Slots[SlotId] = FSlot();
+		FreeSlotIds.Add(SlotId);
+		It.RemoveCurrent();
+	}
+}
+
+bool FGASComponentRanking::Sample(const int32 SlotId)
+{
+	const UAbilitySystemComponent* Component = Slots[SlotId].Entry->Component.Get();
+
+	int32 NewValues[uint8(EGASRankingMetric::Num)] = {};
+	if (Component)
+	{
+		const FActiveGameplayEffectsContainer& ActiveGameplayEffects = Component->GetActiveGameplayEffects();
+		NewValues[uint8(EGASRankingMetric::ActiveEffects)] = ActiveGameplayEffects.GetNumGameplayEffects();
+
+		for (auto It = ActiveGameplayEffects.CreateConstIterator(); It; ++It)
+		{
+			NewValues[uint8(EGASRankingMetric::Modifiers)] += It->Spec.Modifiers.Num();
+		}
+
+		for (const FGameplayAbilitySpec& AbilitySpec : Component->GetActivatableAbilities())
+		{
+			for (const UGameplayAbility* Instance : AbilitySpec.GetAbilityInstances())
+			{
+				++NewValues[uint8(EGASRankingMetric::AbilityInstances)];
+
+				if (const TArray<TObjectPtr<UGameplayTask>>* ActiveTasks = FGASAbilityAccessors::FindActiveTasks(Instance))
+				{
+					NewValues[uint8(EGASRankingMetric::RunningTasks)] += ActiveTasks->Num();
+				}
+			}
+		}
+
+		OwnedTagsScratch.Reset();
+		Component->GetOwnedGameplayTags(OwnedTagsScratch);
+		NewValues[uint8(EGASRankingMetric::OwnedTags)] = OwnedTagsScratch.Num();
+	}
+
+	bool bChanged = false;
+	for (uint8 Metric = 0; Metric < uint8(EGASRankingMetric::Num); ++Metric)
+	{
+		FGASRankingHeap& Heap = Heaps[Metric];
+
+		// Never-sampled slots read as zero, which is also where a fresh heap entry would go
+		bChanged |= Heap.GetValue(SlotId) != NewValues[Metric];
+		Heap.Set(SlotId, NewValues[Metric]);
+	}
+
+	return bChanged;
+}
+
+void FGASComponentRanking::GetTop(const EGASRankingMetric Metric, const int32 Count, TArray<TSharedPtr<const FGASComponentIndexEntry>>& OutEntries) const
+{
+	TArray<int32> TopSlotIds;
+	Heaps[uint8(Metric)].GetTop(Count, TopSlotIds);
+
+	OutEntries.Reset(TopSlotIds.Num());
+	for (const int32 SlotId : TopSlotIds)
+	{
+		OutEntries.Add(Slots[SlotId].Entry);
+	}
+}
+
+int32 FGASComponentRanking::GetValue(const EGASRankingMetric Metric, const FGASComponentIndexEntry& Entry) const
+{
+	const int32* SlotId = SlotIds.Find(&Entry);
+
+	return SlotId ? Heaps[uint8(Metric)].GetValue(*SlotId) : 0;
+}
+
+FText FGASComponentRanking::GetMetricName(const EGASRankingMetric Metric)
+{
+	switch (Metric)
+	{
+	case EGASRankingMetric::ActiveEffects: return LOCTEXT("RankingActiveEffects", "Active Effects");
+	case EGASRankingMetric::Modifiers: return LOCTEXT("RankingModifiers", "Modifiers");
+	case EGASRankingMetric::RunningTasks: return LOCTEXT("RankingRunningTasks", "Running Tasks");
+	case EGASRankingMetric::OwnedTags: return LOCTEXT("RankingOwnedTags", "Owned Tags");
+	case EGASRankingMetric::AbilityInstances: return LOCTEXT("RankingAbilityInstances", "Ability Instances");
+	default: return LOCTEXT("None", "None");
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class FGASComponentIndex;
+class UAbilitySystemComponent;
+struct FGASComponentIndexEntry;
+
+enum class EGASRankingMetric : uint8
+{
+	ActiveEffects,
+	Modifiers,
+	RunningTasks,
+	OwnedTags,
+	AbilityInstances,
+	Num,
+};
+
+/**
+ * Max-heap of values keyed by small integer ids, with a position per id so a value can be changed or
+ * removed in O(log n) without searching for it.
+ */
+class FGASRankingHeap
+{
+public:
+	/** Inserts the id, or moves it to its new place if it is already in */
+	void Set(int32 Id, int32 Value);
+	void Remove(int32 Id);
+	void Reset();
+
+	/** The ids of the Count largest values, largest first. Only visits O(Count log Count) heap slots. */
+	void GetTop(int32 Count, TArray<int32>& OutIds) const;
+
+	int32 GetValue(const int32 Id) const { return Values.IsValidIndex(Id) ? Values[Id] : 0; }
+
+private:
+	void SiftUp(int32 Position);
+	void SiftDown(int32 Position);
+	void SwapPositions(int32 A, int32 B);
+
+	bool IsAbove(const int32 IdA, const int32 IdB) const { return Values[IdA] > Values[IdB]; }
+
+private:
+	TArray<int32> Heap;
+	TArray<int32> Values;
+	TArray<int32> Positions;
+};
+
+/**
+ * The heaviest components of a world by a few load metrics, kept up to date a slice at a time.
+ *
+ * Every few frames, Update re-samples the next GASAttachEditor.Refresh.RankingBatch components of the
+ * index, round robin, and moves them in one heap per metric; reading the top N never looks at the
+ * other components. Components the index drops are taken out of the heaps as soon as its generation moves on.
+ */
+class FGASComponentRanking
+{
+public:
+	/** Does nothing until GASAttachEditor.Refresh.RankingFrames frames went by. Returns true if the ranking may have changed. */
+	bool Update(const FGASComponentIndex& Index);
+	void Reset();
+
+	void GetTop(EGASRankingMetric Metric, int32 Count, TArray<TSharedPtr<const FGASComponentIndexEntry>>& OutEntries) const;
+	int32 GetValue(EGASRankingMetric Metric, const FGASComponentIndexEntry& Entry) const;
+
+	static FText GetMetricName(EGASRankingMetric Metric);
+
+private:
+	void SyncSlots(const FGASComponentIndex& Index);
+	bool Sample(int32 SlotId);
+
+	struct FSlot
+	{
+		TSharedPtr<const FGASComponentIndexEntry> Entry;
+		uint32 SyncStamp = 0;
+	};
+
+private:
+	TMap<const FGASComponentIndexEntry*, int32> SlotIds;
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlotIds;
+
+	FGASRankingHeap Heaps[uint8(EGASRankingMetric::Num)];
+
+	uint32 IndexGeneration = 0;
+	uint32 SyncStamp = 0;
+	int32 Cursor = 0;
+	uint64 LastUpdateFrame = 0;
+
+	FGameplayTagContainer OwnedTagsScratch;
+};
\ No newline at end of file
@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorComponentRegistry.h"
+
+#include "AbilitySystemComponent.h"
+#include "UObject/UObjectHash.h"
+
+static TUniquePtr<FGASComponentRegistry> GComponentRegistry;
+
+FGASComponentRegistry& FGASComponentRegistry::Get()
+{
+	if (!GComponentRegistry)
+	{
+		GComponentRegistry.Reset(new FGASComponentRegistry());
+	}
+	return *GComponentRegistry;
+}
+
+void FGASComponentRegistry::Shutdown()
+{
+	GComponentRegistry.Reset();
+}
+
+FGASComponentRegistry::FGASComponentRegistry()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	// Listening first, so that nothing created meanwhile is missed; the set ignores the ones seen twice
+	GUObjectArray.AddUObjectCreateListener(this);
+	GUObjectArray.AddUObjectDeleteListener(this);
+	bListening = true;
+
+	// The one walk there is, and through the class hash rather than every object
+	ForEachObjectOfClass(UAbilitySystemComponent::StaticClass(), [this](UObject* Object)
+	{
+		if (!Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		{
+			Components.Add(Object);
+		}
+	});
+}
+
+FGASComponentRegistry::~FGASComponentRegistry()
+{
+	StopListening();
+}
+
+void FGASComponentRegistry::StopListening()
+{
+	if (!bListening)
+	{
+		return;
+	}
+
+	GUObjectArray.RemoveUObjectCreateListener(this);
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+	bListening = false;
+
+	FScopeLock ScopeLock(&Lock);
+	Components.Reset();
+	++Generation;
+}
+
+uint32 FGASComponentRegistry::GetGeneration() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Generation;
+}
+
+void FGASComponentRegistry::GetComponents(TArray<UAbilitySystemComponent*>& OutComponents) const
+{
+	check(IsInGameThread());
+
+	FScopeLock ScopeLock(&Lock);
+
+	OutComponents.Reset(Components.Num());
+	for (const UObjectBase* Object : Components)
+	{
+		// Deleted ones leave the set before their memory goes, so every pointer here is still an object
+		UAbilitySystemComponent* Component = static_cast<UAbilitySystemComponent*>(const_cast<UObject*>(static_cast<const UObject*>(Object)));
+		if (IsValid(Component))
+		{
+			OutComponents.Add(Component);
+		}
+	}
+}
+
+void FGASComponentRegistry::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	// Called for every object of the process; the class and flags are set by now, nothing else is
+	if (!Object->GetClass()->IsChildOf(UAbilitySystemComponent::StaticClass()) ||
+		(Object->GetFlags() & (RF_ClassDefaultObject | RF_ArchetypeObject)) != RF_NoFlags)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Components.Add(Object);
+	++Generation;
+}
+
+void FGASComponentRegistry::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Components.Remove(Object) > 0)
+	{
+		++Generation;
+	}
+}
+
+void FGASComponentRegistry::OnUObjectArrayShutdown()
+{
+	StopListening();
+}
\ No newline at end of file
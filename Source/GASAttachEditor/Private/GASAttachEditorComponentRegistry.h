@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/UObjectArray.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * Every Ability System Component of the process, kept by listening to objects being created and deleted
+ * rather than by walking the object array.
+ *
+ * The component index and the world correlation both build on it: they only look through the components
+ * again when the generation moved, which is when one came or went. Objects are created on loading threads
+ * too, so the set is locked; reading it is for the game thread. Starts listening on first use.
+ */
+class FGASComponentRegistry : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	static FGASComponentRegistry& Get();
+	/** Stops listening; the editor module calls it as it shuts down */
+	static void Shutdown();
+
+	/** Moves on whenever a component is created or deleted */
+	uint32 GetGeneration() const;
+
+	/** The live components, leaving out those already destroyed and only waiting for garbage collection */
+	void GetComponents(TArray<UAbilitySystemComponent*>& OutComponents) const;
+
+	//~ FUObjectCreateListener / FUObjectDeleteListener
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+	virtual void OnUObjectArrayShutdown() override;
+
+	virtual ~FGASComponentRegistry() override;
+
+private:
+	FGASComponentRegistry();
+
+	void StopListening();
+
+private:
+	mutable FCriticalSection Lock;
+	TSet<const UObjectBase*> Components;
+	uint32 Generation = 1;
+	bool bListening = false;
+};
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorCountdown.h"
+
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+
+void FGASCountdown::Sync(const UWorld* World, const float InStartWorldTime, const float InDuration)
+{
+	if (!World)
+	{
+		Reset();
+		return;
+	}
+
+	// A paused world keeps its timers where they are
+	const AWorldSettings* WorldSettings = World->GetWorldSettings();
+	const float InTimeDilation = World->IsPaused() || !WorldSettings
+		? 0.f
+		: WorldSettings->GetEffectiveTimeDilation();
+
+	// World time is clamped on hitches while the local clock is not, so catch up when they part
+	static constexpr double MaxDrift = 0.1;
+	static constexpr float StartTolerance = 1e-3f;
+
+	if (FMath::IsNearlyEqual(StartWorldTime, InStartWorldTime, StartTolerance) &&
+		Duration == InDuration &&
+		TimeDilation == InTimeDilation &&
+		FMath::Abs(GetLocalWorldTime() - World->GetTimeSeconds()) < MaxDrift)
+	{
+		return;
+	}
+
+	StartWorldTime = InStartWorldTime;
+	Duration = InDuration;
+	TimeDilation = InTimeDilation;
+	SyncWorldTime = World->GetTimeSeconds();
+	SyncRealTime = FPlatformTime::Seconds();
+}
+
+void FGASCountdown::SyncRemote(const double WorldTime, const double LocalTime, const float InTimeDilation, const float InStartWorldTime, const float InDuration)
+{
+	// Snapshots arrive with some jitter, which a tighter drift would turn into a ticking back and forth
+	static constexpr double MaxDrift = 0.25;
+	static constexpr float StartTolerance = 1e-3f;
+
+	if (FMath::IsNearlyEqual(StartWorldTime, InStartWorldTime, StartTolerance) &&
+		Duration == InDuration &&
+		TimeDilation == InTimeDilation &&
+		FMath::Abs(SyncWorldTime + (LocalTime - SyncRealTime) * TimeDilation - WorldTime) < MaxDrift)
+	{
+		return;
+	}
+
+	StartWorldTime = InStartWorldTime;
+	Duration = InDuration;
+	TimeDilation = InTimeDilation;
+	SyncWorldTime = WorldTime;
+	SyncRealTime = LocalTime;
+}
+
+void FGASCountdown::Reset()
+{
+	*this = FGASCountdown();
+}
+
+float FGASCountdown::GetRemaining() const
+{
+	if (!IsRunning())
+	{
+		return 0.f;
+	}
+
+	return FMath::Clamp<float>(Duration - (GetLocalWorldTime() - StartWorldTime), 0.f, Duration);
+}
+
+double FGASCountdown::GetLocalWorldTime() const
+{
+	return SyncWorldTime + (FPlatformTime::Seconds() - SyncRealTime) * TimeDilation;
+}
\ No newline at end of file
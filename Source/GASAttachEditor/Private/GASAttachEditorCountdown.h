@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * A world timer read once and then run on the local clock, so that remaining times can be computed
+ * while painting instead of being re-read from the component on every refresh.
+ *
+ * Start time, duration and the world's effective time dilation are captured on Sync; the capture is
+ * only redone when one of them changes or the local clock drifted away from the world's.
+ */
+struct FGASCountdown
+{
+	/** Cheap when nothing changed - compares against the captured values and returns. */
+	void Sync(const UWorld* World, float InStartWorldTime, float InDuration);
+
+	/** Same as Sync, for a timer of another process: its world time as of a snapshot, and when that snapshot arrived here. */
+	void SyncRemote(double WorldTime, double LocalTime, float InTimeDilation, float InStartWorldTime, float InDuration);
+	void Reset();
+
+	FORCEINLINE bool IsRunning() const { return Duration > 0.f; }
+	FORCEINLINE float GetDuration() const { return Duration; }
+
+	float GetRemaining() const;
+
+private:
+	double GetLocalWorldTime() const;
+
+private:
+	float StartWorldTime = 0.f;
+	float Duration = 0.f;
+	float TimeDilation = 1.f;
+
+	double SyncWorldTime = 0.0;
+	double SyncRealTime = 0.0;
+};
\ No newline at end of file
@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachSnapshotDiff.h"
+#include "Styling/StyleColors.h"
+
+/** How a row of the tabs differs from the capture viewer's base, if the tab was given a diff */
+FORCEINLINE EGASDiffChange GetDiffChange(const FGASDiffEntry* Entry)
+{
+	return Entry ? Entry->Change : EGASDiffChange::Unchanged;
+}
+
+/** Rows that differ are tinted by how; the rest keep their own color */
+FORCEINLINE FLinearColor GetDiffColor(const EGASDiffChange Change, const FLinearColor& UnchangedColor)
+{
+	switch (Change)
+	{
+	case EGASDiffChange::Added:		return FStyleColors::Success.GetSpecifiedColor();
+	case EGASDiffChange::Removed:	return FStyleColors::Error.GetSpecifiedColor();
+	case EGASDiffChange::Changed:	return FStyleColors::Warning.GetSpecifiedColor();
+	default:						return UnchangedColor;
+	}
+}
\ No newline at end of file
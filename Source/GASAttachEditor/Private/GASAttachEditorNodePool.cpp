@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorNodePool.h"
+
+#include "HAL/IConsoleManager.h"
+
+FGASNodePool::FGASNodePool(const TCHAR* Name)
+	: Storage(MakeShared<FStorage>(Name))
+{
+	TArray<TWeakPtr<FStorage>>& LivePools = GetLivePools();
+
+	// Drop the pools that have gone away since
+	LivePools.RemoveAllSwap([](const TWeakPtr<FStorage>& LivePool)
+	{
+		return !LivePool.IsValid();
+	});
+
+	LivePools.Add(Storage);
+}
+
+FGASNodePoolStats FGASNodePool::GetStats() const
+{
+	return Storage->GetStats();
+}
+
+void FGASNodePool::GetAllStats(TArray<FGASNodePoolStats>& OutStats)
+{
+	OutStats.Reset();
+	for (const TWeakPtr<FStorage>& LivePool : GetLivePools())
+	{
+		if (const TSharedPtr<FStorage> PinnedPool = LivePool.Pin())
+		{
+			OutStats.Add(PinnedPool->GetStats());
+		}
+	}
+}
+
+TArray<TWeakPtr<FGASNodePool::FStorage>>& FGASNodePool::GetLivePools()
+{
+	static TArray<TWeakPtr<FStorage>> LivePools;
+	return LivePools;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FGASNodePool::FStorage::FStorage(const TCHAR* InName)
+	: Name(InName)
+{
+}
+
+FGASNodePool::FStorage::~FStorage()
+{
+	// Every live node keeps the storage alive, nothing can still be using a slot here
+	ensure(NumLive == 0);
+
+	for (FBucket& Bucket : Buckets)
+	{
+		for (void* Chunk : Bucket.Chunks)
+		{
+			FMemory::Free(Chunk);
+		}
+	}
+}
+
+int32 FGASNodePool::FStorage::FindOrAddBucket(const SIZE_T Size)
+{
+	// Slots double as free list links, and every slot of a chunk has to stay aligned
+	const SIZE_T SlotSize = Align(FMath::Max<SIZE_T>(Size, sizeof(void*)), SlotAlignment);
+
+	for (int32 Index = 0; Index < Buckets.Num(); ++Index)
+	{
+		if (Buckets[Index].SlotSize == SlotSize)
+		{
+			return Index;
+		}
+	}
+
+	FBucket& Bucket = Buckets.AddDefaulted_GetRef();
+	Bucket.SlotSize = SlotSize;
+	return Buckets.Num() - 1;
+}
+
+void* FGASNodePool::FStorage::Allocate(const int32 BucketIndex)
+{
+	FBucket& Bucket = Buckets[BucketIndex];
+
+	if (!Bucket.FreeList)
+	{
+		uint8* Chunk = static_cast<uint8*>(FMemory::Malloc(Bucket.SlotSize * SlotsPerChunk, SlotAlignment));
+		Bucket.Chunks.Add(Chunk);
+
+		// Thread the new slots onto the free list back to front, so they are handed out in address order
+		for (int32 Index = SlotsPerChunk - 1; Index >= 0; --Index)
+		{
+			void* Slot = Chunk + Index * Bucket.SlotSize;
+			*static_cast<void**>(Slot) = Bucket.FreeList;
+			Bucket.FreeList = Slot;
+		}
+	}
+
+	void* Slot = Bucket.FreeList;
+	Bucket.FreeList = *static_cast<void**>(Slot);
+
+	++Bucket.NumConstructed;
+	++NumLive;
+	HighWaterMark = FMath::Max(HighWaterMark, NumLive);
+
+	return Slot;
+}
+
+void FGASNodePool::FStorage::Free(void* Memory, const int32 BucketIndex)
+{
+	FBucket& Bucket = Buckets[BucketIndex];
+	check(NumLive > 0);
+
+	*static_cast<void**>(Memory) = Bucket.FreeList;
+	Bucket.FreeList = Memory;
+	--NumLive;
+}
+
+FGASNodePoolStats FGASNodePool::FStorage::GetStats() const
+{
+	FGASNodePoolStats Stats;
+	Stats.Name = Name;
+	Stats.NumLive = NumLive;
+	Stats.HighWaterMark = HighWaterMark;
+
+	for (const FBucket& Bucket : Buckets)
+	{
+		Stats.NumSlots += Bucket.Chunks.Num() * SlotsPerChunk;
+		Stats.NumChunks += Bucket.Chunks.Num();
+		Stats.NumConstructed += Bucket.NumConstructed;
+	}
+
+	return Stats;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static FAutoConsoleCommandWithOutputDevice GASAttachEditorPoolStatsCommand(
+	TEXT("GASAttachEditor.PoolStats"),
+	TEXT("Prints the node pool usage of every open GAS Attach Editor tab."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		TArray<FGASNodePoolStats> AllStats;
+		FGASNodePool::GetAllStats(AllStats);
+
+		for (const FGASNodePoolStats& Stats : AllStats)
+		{
+			Ar.Logf(TEXT("%s: %d live, high-water mark %d, %d slots in %d chunks, %d nodes constructed"),
+				*Stats.Name,
+				Stats.NumLive,
+				Stats.HighWaterMark,
+				Stats.NumSlots,
+				Stats.NumChunks,
+				Stats.NumConstructed);
+		}
+	}));
\ No newline at end of file
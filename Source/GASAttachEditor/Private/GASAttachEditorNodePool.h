@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGASNodePoolStats
+{
+	FString Name;
+
+	// Nodes currently alive, and the most that were ever alive at once
+	int32 NumLive = 0;
+	int32 HighWaterMark = 0;
+
+	// Slots the pool owns, and how many times it had to go to the global allocator for them
+	int32 NumSlots = 0;
+	int32 NumChunks = 0;
+
+	// Every node ever constructed from this pool, recycled or not
+	int32 NumConstructed = 0;
+};
+
+/**
+ * Recycles the memory of a tab's row nodes between refreshes.
+ *
+ * Nodes are still handed out as shared pointers, so the trees don't change, but their memory comes
+ * from fixed size slots owned by the pool - a node going away returns its slot to a free list, and
+ * the next node reuses it instead of going back through the global allocator. Slots are grouped by
+ * size, so one pool can serve every node type of a tab.
+ *
+ * The storage is kept alive by every live node, so nodes may safely outlive the tab that made them.
+ * Game thread only.
+ */
+class FGASNodePool
+{
+public:
+	explicit FGASNodePool(const TCHAR* Name);
+
+	template<typename NodeType, typename... ArgTypes>
+	TSharedRef<NodeType> Make(ArgTypes&&... Args) const
+	{
+		static_assert(alignof(NodeType) <= SlotAlignment, "Node type is over-aligned for the pool");
+
+		const int32 BucketIndex = Storage->FindOrAddBucket(sizeof(NodeType));
+		NodeType* Node = new (Storage->Allocate(BucketIndex)) NodeType(Forward<ArgTypes>(Args)...);
+
+		return MakeShareable(Node, [Storage = Storage, BucketIndex](NodeType* InNode)
+		{
+			InNode->~NodeType();
+			Storage->Free(InNode, BucketIndex);
+		});
+	}
+
+	FGASNodePoolStats GetStats() const;
+
+	static void GetAllStats(TArray<FGASNodePoolStats>& OutStats);
+
+private:
+	static constexpr SIZE_T SlotAlignment = 16;
+	static constexpr int32 SlotsPerChunk = 64;
+
+	struct FStorage
+	{
+		struct FBucket
+		{
+			SIZE_T SlotSize = 0;
+			void* FreeList = nullptr;
+			TArray<void*> Chunks;
+			int32 NumConstructed = 0;
+		};
+
+		explicit FStorage(const TCHAR* InName);
+		~FStorage();
+
+		int32 FindOrAddBucket(SIZE_T Size);
+		void* Allocate(int32 BucketIndex);
+		void Free(void* Memory, int32 BucketIndex);
+
+		FGASNodePoolStats GetStats() const;
+
+		FString Name;
+		TArray<FBucket> Buckets;
+
+		// Across buckets, as the peaks of separate buckets needn't have happened at once
+		int32 NumLive = 0;
+		int32 HighWaterMark = 0;
+	};
+
+	static TArray<TWeakPtr<FStorage>>& GetLivePools();
+
+	TSharedRef<FStorage> Storage;
+};
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorRefreshScheduler.h"
+
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarRefreshBudgetPercent(
+	TEXT("GASAttachEditor.Refresh.BudgetPercent"),
+	5.f,
+	TEXT("Share of the frame time, in percent, the viewer may spend on average re-reading the inspected component."));
+
+static TAutoConsoleVariable<float> CVarRefreshInterval(
+	TEXT("GASAttachEditor.Refresh.Interval"),
+	0.1f,
+	TEXT("Seconds between continuous refreshes while only slow changing tabs are in front."));
+
+static TAutoConsoleVariable<float> CVarRefreshMinInterval(
+	TEXT("GASAttachEditor.Refresh.MinInterval"),
+	0.f,
+	TEXT("Seconds between continuous refreshes while a fast changing tab is in front. 0 refreshes every frame, budget allowing."));
+
+static TAutoConsoleVariable<float> CVarRefreshMaxInterval(
+	TEXT("GASAttachEditor.Refresh.MaxInterval"),
+	2.f,
+	TEXT("Upper bound, in seconds, for how far refreshes and selection validation may back off."));
+
+static TAutoConsoleVariable<float> CVarValidateInterval(
+	TEXT("GASAttachEditor.Refresh.ValidateInterval"),
+	0.1f,
+	TEXT("Seconds between selection validations, which scan every Ability System Component for the world list."));
+
+static TAutoConsoleVariable<float> CVarPausedInterval(
+	TEXT("GASAttachEditor.Refresh.PausedInterval"),
+	1.f,
+	TEXT("Seconds between refreshes and validations while the inspected world is paused."));
+
+static TAutoConsoleVariable<float> CVarPressureFrameMs(
+	TEXT("GASAttachEditor.Refresh.PressureFrameMs"),
+	33.3f,
+	TEXT("Editor frame time, in milliseconds, above which the viewer backs off in proportion to how far the frame is over."));
+
+static TAutoConsoleVariable<int32> CVarOffscreenPasses(
+	TEXT("GASAttachEditor.Refresh.OffscreenPasses"),
+	8,
+	TEXT("Number of refreshes the rows scrolled out of view are spread over. 1 updates every row on every refresh."));
+
+void FGASRefreshScheduler::BeginFrame(const FFrame& Frame)
+{
+	CurrentFrame = Frame;
+	Smooth(AverageFrameTime, Frame.DeltaTime);
+
+	ValidateInterval = ComputeInterval(CVarValidateInterval.GetValueOnGameThread(), AverageValidateCost);
+
+	const float BaseRefreshInterval = Frame.bWatchingFastTab
+		? CVarRefreshMinInterval.GetValueOnGameThread()
+		: CVarRefreshInterval.GetValueOnGameThread();
+
+	RefreshInterval = ComputeInterval(BaseRefreshInterval, AverageRefreshCost);
+}
+
+bool FGASRefreshScheduler::ShouldValidate()
+{
+	if (CurrentFrame.CurrentTime - LastValidateTime < ValidateInterval)
+	{
+		return false;
+	}
+
+	LastValidateTime = CurrentFrame.CurrentTime;
+	return true;
+}
+
+void FGASRefreshScheduler::ReportValidateCost(const double Seconds)
+{
+	Smooth(AverageValidateCost, Seconds);
+}
+
+bool FGASRefreshScheduler::ShouldRefresh()
+{
+	if (CurrentFrame.CurrentTime - LastRefreshTime < RefreshInterval)
+	{
+		return false;
+	}
+
+	LastRefreshTime = CurrentFrame.CurrentTime;
+	return true;
+}
+
+void FGASRefreshScheduler::ReportRefreshCost(const double Seconds)
+{
+	Smooth(AverageRefreshCost, Seconds);
+}
+
+double FGASRefreshScheduler::ComputeInterval(const double BaseInterval, const double AverageCost) const
+{
+	// Spending Cost every Interval seconds averages out to Cost / Interval of the frame time
+	const double Budget = FMath::Max(CVarRefreshBudgetPercent.GetValueOnGameThread(), 0.1f) / 100.0;
+	double Interval = FMath::Max(BaseInterval, AverageCost / Budget);
+
+	const double PressureFrameTime = CVarPressureFrameMs.GetValueOnGameThread() / 1000.0;
+	if (PressureFrameTime > 0.0 &&
+		AverageFrameTime > PressureFrameTime)
+	{
+		// Never scales an every-frame interval, so make sure there is something to stretch
+		Interval = FMath::Max(Interval, AverageFrameTime) * (AverageFrameTime / PressureFrameTime);
+	}
+
+	if (CurrentFrame.bWorldPaused)
+	{
+		Interval = FMath::Max<double>(Interval, CVarPausedInterval.GetValueOnGameThread());
+	}
+
+	return FMath::Min<double>(Interval, FMath::Max(CVarRefreshMaxInterval.GetValueOnGameThread(), 0.f));
+}
+
+void FGASRefreshScheduler::Smooth(double& Average, const double Sample)
+{
+	static constexpr double Weight = 0.2;
+	Average = Average > 0.0
+		? FMath::Lerp(Average, Sample, Weight)
+		: Sample;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FGASRowUpdateWindow::BeginRefresh(const bool bInFullRate)
+{
+	bFullRate = bInFullRate;
+	NumPasses = FMath::Max(CVarOffscreenPasses.GetValueOnGameThread(), 1);
+	Pass = (Pass + 1) % NumPasses;
+	RowIndex = 0;
+}
+
+bool FGASRowUpdateWindow::ShouldUpdate(const bool bOnScreen)
+{
+	const int32 Index = RowIndex++;
+
+	return
+		bFullRate ||
+		bOnScreen ||
+		Index % NumPasses == Pass;
+}
\ No newline at end of file
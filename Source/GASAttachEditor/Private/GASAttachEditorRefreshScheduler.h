@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Decides when the viewer re-validates its selection and when it re-reads the selected component.
+ *
+ * Both intervals follow the measured cost of the work they schedule, so that on average the viewer
+ * stays within GASAttachEditor.Refresh.BudgetPercent of the frame. On top of that they stretch while
+ * the editor frame time is over GASAttachEditor.Refresh.PressureFrameMs or the inspected world is
+ * paused, and the refresh drops to GASAttachEditor.Refresh.MinInterval - every frame by default -
+ * while a fast changing tab is in front.
+ */
+class FGASRefreshScheduler
+{
+public:
+	struct FFrame
+	{
+		double CurrentTime = 0.0;
+		float DeltaTime = 0.f;
+
+		// The inspected world doesn't change while paused, there is little point in looking at it often
+		bool bWorldPaused = false;
+
+		// A tab whose values change every frame (attributes) is in front
+		bool bWatchingFastTab = false;
+	};
+
+	void BeginFrame(const FFrame& Frame);
+
+	/** True when the selection is due for validation; call ReportValidateCost once done. */
+	bool ShouldValidate();
+	void ReportValidateCost(double Seconds);
+
+	/** True when the selected component is due for a refresh; call ReportRefreshCost once done. */
+	bool ShouldRefresh();
+	void ReportRefreshCost(double Seconds);
+
+	double GetValidateInterval() const { return ValidateInterval; }
+	double GetRefreshInterval() const { return RefreshInterval; }
+
+private:
+	double ComputeInterval(double BaseInterval, double AverageCost) const;
+
+	static void Smooth(double& Average, double Sample);
+
+private:
+	FFrame CurrentFrame;
+
+	double AverageFrameTime = 0.0;
+	double AverageValidateCost = 0.0;
+	double AverageRefreshCost = 0.0;
+
+	double LastValidateTime = -DBL_MAX;
+	double LastRefreshTime = -DBL_MAX;
+
+	double ValidateInterval = 0.0;
+	double RefreshInterval = 0.0;
+};
+
+/**
+ * Spreads the updates of a tab's off-screen rows over several refreshes.
+ *
+ * Rows with a generated widget are updated on every refresh; the others take turns, so that each of
+ * them is updated once every GASAttachEditor.Refresh.OffscreenPasses refreshes. A tab asks for a full
+ * rate refresh while sorting or filtering depends on the values of rows nobody is looking at.
+ */
+class FGASRowUpdateWindow
+{
+public:
+	/** Starts a refresh. Rows must then be asked about in the same order every refresh. */
+	void BeginRefresh(bool bFullRate);
+
+	bool ShouldUpdate(bool bOnScreen);
+
+private:
+	bool bFullRate = true;
+	int32 NumPasses = 1;
+	int32 Pass = 0;
+	int32 RowIndex = 0;
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorStats.h"
+
+DEFINE_STAT(STAT_GASAttachEditor_ValidateSelections);
+DEFINE_STAT(STAT_GASAttachEditor_UpdateComponentsList);
+DEFINE_STAT(STAT_GASAttachEditor_WorldCorrelation);
+DEFINE_STAT(STAT_GASAttachEditor_AbilitiesRefresh);
+DEFINE_STAT(STAT_GASAttachEditor_AttributesRefresh);
+DEFINE_STAT(STAT_GASAttachEditor_GameplayEffectsRefresh);
+DEFINE_STAT(STAT_GASAttachEditor_GameplayTagsRefresh);
+DEFINE_STAT(STAT_GASAttachEditor_OverviewRefresh);
+DEFINE_STAT(STAT_GASAttachEditor_WorldMatrixRefresh);
+DEFINE_STAT(STAT_GASAttachEditor_Ranking);
+DEFINE_STAT(STAT_GASAttachEditor_Sort);
+DEFINE_STAT(STAT_GASAttachEditor_Filter);
+DEFINE_STAT(STAT_GASAttachEditor_GenerateRow);
+
+double FGASCostCounter::GetLastFrameSeconds() const
+{
+	// Rows are generated after the refresh, later in the same frame - it is only final once the frame is over
+	return Frame == GFrameCounter ? LastSeconds : CurrentSeconds;
+}
+
+void FGASCostCounter::Add(const double Seconds)
+{
+	if (Frame != GFrameCounter)
+	{
+		LastSeconds = CurrentSeconds;
+		CurrentSeconds = 0.0;
+		Frame = GFrameCounter;
+	}
+
+	CurrentSeconds += Seconds;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FGASScopedCost::FGASScopedCost(FGASCostCounter& InCounter)
+	: Counter(InCounter)
+{
+	if (Counter.Depth++ == 0)
+	{
+		StartTime = FPlatformTime::Seconds();
+	}
+}
+
+FGASScopedCost::~FGASScopedCost()
+{
+	if (--Counter.Depth == 0)
+	{
+		Counter.Add(FPlatformTime::Seconds() - StartTime);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachRuntimeStats.h"
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Validate Selections"), STAT_GASAttachEditor_ValidateSelections, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Components List"), STAT_GASAttachEditor_UpdateComponentsList, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("World Correlation"), STAT_GASAttachEditor_WorldCorrelation, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Abilities Refresh"), STAT_GASAttachEditor_AbilitiesRefresh, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Attributes Refresh"), STAT_GASAttachEditor_AttributesRefresh, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gameplay Effects Refresh"), STAT_GASAttachEditor_GameplayEffectsRefresh, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gameplay Tags Refresh"), STAT_GASAttachEditor_GameplayTagsRefresh, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Overview Refresh"), STAT_GASAttachEditor_OverviewRefresh, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("World Matrix Refresh"), STAT_GASAttachEditor_WorldMatrixRefresh, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ranking Update"), STAT_GASAttachEditor_Ranking, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sort"), STAT_GASAttachEditor_Sort, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Filter"), STAT_GASAttachEditor_Filter, STATGROUP_GASAttachEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate Row"), STAT_GASAttachEditor_GenerateRow, STATGROUP_GASAttachEditor, );
+
+/**
+ * Wall time a single tab (or step) spent on the game thread, bucketed per frame.
+ *
+ * Scopes nest - only the outermost one is counted - so a Refresh that sorts and filters is not
+ * counted three times.
+ */
+class FGASCostCounter
+{
+public:
+	/** Cost of the most recent finished frame this counter did any work in, in seconds. */
+	double GetLastFrameSeconds() const;
+
+private:
+	friend class FGASScopedCost;
+
+	void Add(double Seconds);
+
+	uint64 Frame = 0;
+	double CurrentSeconds = 0.0;
+	double LastSeconds = 0.0;
+	int32 Depth = 0;
+};
+
+class FGASScopedCost
+{
+public:
+	explicit FGASScopedCost(FGASCostCounter& InCounter);
+	~FGASScopedCost();
+
+	FGASScopedCost(const FGASScopedCost&) = delete;
+	FGASScopedCost& operator=(const FGASScopedCost&) = delete;
+
+private:
+	FGASCostCounter& Counter;
+	double StartTime = 0.0;
+};
+
+/** Same as GAS_ATTACH_EDITOR_SCOPE, also counted towards the in-window cost overlay */
+#define GAS_ATTACH_EDITOR_SCOPE_COST(Stat, Counter) \
+	GAS_ATTACH_EDITOR_SCOPE(Stat); \
+	const FGASScopedCost ANONYMOUS_VARIABLE(GASScopedCost)(Counter)
\ No newline at end of file
@@ -0,0 +1,205 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorWorldCorrelation.h"
+#include "GASAttachEditorComponentRegistry.h"
+#include "GASAttachEditorStats.h"
+#include "GASAttachSnapshot.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/PackageMapClient.h"
+#include "GameFramework/Actor.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+void FGASWorldCorrelation::Update()
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_WorldCorrelation);
+
+	// The same registry as the component index's, so components are only looked through when one came or went
+	const FGASComponentRegistry& Registry = FGASComponentRegistry::Get();
+	if (Registry.GetGeneration() != RegistryGeneration)
+	{
+		RegistryGeneration = Registry.GetGeneration();
+
+		TArray<UAbilitySystemComponent*> Components;
+		Registry.GetComponents(Components);
+		for (UAbilitySystemComponent* Component : Components)
+		{
+			// Not in a world yet may still mean a game world later on
+			const UWorld* World = Component->GetWorld();
+			if (!World ||
+				World->IsGameWorld())
+			{
+				Entries.FindOrAdd(Component);
+			}
+		}
+	}
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FEntry& Entry = It.Value();
+		UAbilitySystemComponent* Component = It.Key().ResolveObjectPtr();
+		if (!IsValid(Component))
+		{
+			if (Entry.bLinked)
+			{
+				Unlink(Component, Entry);
+			}
+			It.RemoveCurrent();
+			continue;
+		}
+
+		const UWorld* World = Component->GetWorld();
+		const AActor* Owner = Component->GetOwnerActor();
+		if (!World ||
+			!World->IsGameWorld() ||
+			!Owner)
+		{
+			if (Entry.bLinked)
+			{
+				Unlink(Component, Entry);
+				Entry.bLinked = false;
+			}
+			continue;
+		}
+
+		// Clients only learn the GUID once the owner replicated, so keep asking until there is one
+		const FName OwnerName = Owner->GetFName();
+		if (!Entry.bLinked ||
+			Entry.OwnerName != OwnerName ||
+			!Entry.NetGUID.IsValid())
+		{
+			const FNetworkGUID NetGUID = GetNetGUID(World, Owner);
+			if (!Entry.bLinked ||
+				Entry.World != TObjectKey<UWorld>(World) ||
+				Entry.OwnerName != OwnerName ||
+				Entry.NetGUID != NetGUID)
+			{
+				if (Entry.bLinked)
+				{
+					Unlink(Component, Entry);
+				}
+
+				Entry.World = World;
+				Entry.NetGUID = NetGUID;
+				Entry.OwnerName = OwnerName;
+				Entry.bLinked = true;
+
+				Link(Component, Entry);
+			}
+		}
+	}
+
+	for (auto It = Worlds.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr() ||
+			It.Value().ByOwnerName.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FGASWorldCorrelation::Reset()
+{
+	RegistryGeneration = 0;
+	Entries.Reset();
+	Worlds.Reset();
+}
+
+UAbilitySystemComponent* FGASWorldCorrelation::FindCounterpart(const UAbilitySystemComponent* Component, const UWorld* World) const
+{
+	const FEntry* Entry = Entries.Find(Component);
+	const FWorldTable* Table = Worlds.Find(World);
+	if (!Entry ||
+		!Table)
+	{
+		return nullptr;
+	}
+
+	if (Entry->World == TObjectKey<UWorld>(World))
+	{
+		return const_cast<UAbilitySystemComponent*>(Component);
+	}
+
+	if (Entry->NetGUID.IsValid())
+	{
+		if (const TWeakObjectPtr<UAbilitySystemComponent>* Counterpart = Table->ByNetGUID.Find(Entry->NetGUID))
+		{
+			if (UAbilitySystemComponent* CounterpartComponent = Counterpart->Get())
+			{
+				return CounterpartComponent;
+			}
+		}
+	}
+
+	const TWeakObjectPtr<UAbilitySystemComponent>* Counterpart = Table->ByOwnerName.Find(Entry->OwnerName);
+	return Counterpart ? Counterpart->Get() : nullptr;
+}
+
+void FGASWorldCorrelation::Link(UAbilitySystemComponent* Component, const FEntry& Entry)
+{
+	FWorldTable& Table = Worlds.FindOrAdd(Entry.World);
+
+	if (Entry.NetGUID.IsValid())
+	{
+		Table.ByNetGUID.Add(Entry.NetGUID, Component);
+	}
+
+	Table.ByOwnerName.Add(Entry.OwnerName, Component);
+}
+
+void FGASWorldCorrelation::Unlink(const UAbilitySystemComponent* Component, const FEntry& Entry)
+{
+	FWorldTable* Table = Worlds.Find(Entry.World);
+	if (!Table)
+	{
+		return;
+	}
+
+	// Another component may have taken the key over since; only remove it while it still points here
+	const auto RemoveIfLinked = [Component](auto& Map, const auto& Key)
+	{
+		const TWeakObjectPtr<UAbilitySystemComponent>* Linked = Map.Find(Key);
+		if (Linked &&
+			(Linked->Get() == Component || !Linked->IsValid()))
+		{
+			Map.Remove(Key);
+		}
+	};
+
+	if (Entry.NetGUID.IsValid())
+	{
+		RemoveIfLinked(Table->ByNetGUID, Entry.NetGUID);
+	}
+
+	RemoveIfLinked(Table->ByOwnerName, Entry.OwnerName);
+}
+
+FText FGASWorldCorrelation::GetWorldName(const FName WorldContextHandle)
+{
+	const FWorldContext* WorldContext = GEngine->GetWorldContextFromHandle(WorldContextHandle);
+	if (!WorldContext)
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	return FGASWorldSnapshot::GetWorldName(*WorldContext);
+}
+
+FNetworkGUID FGASWorldCorrelation::GetNetGUID(const UWorld* World, const UObject* Object)
+{
+	const UNetDriver* NetDriver = World->GetNetDriver();
+	if (!NetDriver ||
+		!NetDriver->GuidCache.IsValid())
+	{
+		return FNetworkGUID();
+	}
+
+	return NetDriver->GuidCache->GetNetGUID(Object);
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/NetworkGuid.h"
+#include "UObject/ObjectKey.h"
+
+class UWorld;
+class UAbilitySystemComponent;
+
+/**
+ * Which component stands for the same actor in every game world - server and each PIE client.
+ *
+ * Components are matched by the network GUID of their owner actor, which the server assigns and every
+ * client maps to its own copy; owners without one yet (not replicated so far, or no net driver) fall back
+ * to matching by actor name. Components come from FGASComponentRegistry, shared with the component index,
+ * and are only looked through again when one came or went. Update re-keys only the components that are
+ * new, got renamed or just received their GUID, and a hop to another world is then two map lookups.
+ */
+class FGASWorldCorrelation
+{
+public:
+	void Update();
+	void Reset();
+
+	/** The component of World standing for the same actor as Component, or null. */
+	UAbilitySystemComponent* FindCounterpart(const UAbilitySystemComponent* Component, const UWorld* World) const;
+
+	/** "Listen Server", "Client [1]" and so on */
+	static FText GetWorldName(FName WorldContextHandle);
+
+private:
+	struct FEntry
+	{
+		TObjectKey<UWorld> World;
+		FNetworkGUID NetGUID;
+		FName OwnerName;
+		// In the table of World; components without a game world or an owner yet aren't
+		bool bLinked = false;
+	};
+
+	struct FWorldTable
+	{
+		TMap<FNetworkGUID, TWeakObjectPtr<UAbilitySystemComponent>> ByNetGUID;
+		TMap<FName, TWeakObjectPtr<UAbilitySystemComponent>> ByOwnerName;
+	};
+
+	void Link(UAbilitySystemComponent* Component, const FEntry& Entry);
+	void Unlink(const UAbilitySystemComponent* Component, const FEntry& Entry);
+
+	static FNetworkGUID GetNetGUID(const UWorld* World, const UObject* Object);
+
+private:
+	TMap<TObjectKey<UAbilitySystemComponent>, FEntry> Entries;
+	TMap<TObjectKey<UWorld>, FWorldTable> Worlds;
+
+	// Of the registry, when its components were last looked through; zero for never
+	uint32 RegistryGeneration = 0;
+};
\ No newline at end of file
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachEditorBenchmark.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASAttachEditorBenchmarkTest, "GASAttachEditor.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASAttachEditorBenchmarkTest::RunTest(const FString& Parameters)
+{
+	// The console command's defaults. Only what doesn't depend on the machine passes or fails; timings are reported
+	const GASAttachEditorBenchmark::FConfig Config;
+
+	TArray<GASAttachEditorBenchmark::FTabResult> Results;
+	GASAttachEditorBenchmark::Run(Config, Results, *GLog);
+
+	TestEqual(TEXT("Every tab measured"), Results.Num(), 4);
+
+	for (const GASAttachEditorBenchmark::FTabResult& Result : Results)
+	{
+		TestTrue(FString::Printf(TEXT("%s builds its nodes"), *Result.Name), Result.NumConstructed > 0);
+		TestEqual(FString::Printf(TEXT("%s reuses its nodes on a steady refresh"), *Result.Name), Result.SteadyConstructed, 0);
+
+		AddInfo(FString::Printf(TEXT("%s: cold %.3f ms, steady %.3f ms, switching %.3f ms, filter %.3f ms, nodes constructed %d, pool chunks added %d"),
+			*Result.Name,
+			Result.ColdMs,
+			Result.SteadyMs,
+			Result.SwitchMs,
+			Result.FilterMs,
+			Result.NumConstructed,
+			Result.NumChunks));
+	}
+
+	return true;
+}
+
+#endif
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include "SGASAbilitiesTab.h"
 
 #include "SGASAbilityItem.h"
+#include "GASAttachEditorDiff.h"
 #include "GASAttachEditorSettings.h"
+#include "GASAttachSnapshot.h"
 
 #include "AbilitySystemComponent.h"
 #include "Widgets/Layout/SBox.h"
@@ -68,6 +70,8 @@ void SGASAbilitiesTab::Construct(const FArguments& InArgs)
 				.TreeItemsSource(&FilteredAbilitiesList)
 				.OnGenerateRow_Lambda([this](TSharedPtr<FGASAbilityNode> Item, const TSharedRef<STableViewBase>& OwnerTable)
 				{
+					GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GenerateRow, RefreshCost);
+
 					return
 						SNew(SGASAbilityItem, OwnerTable)
 						.WidgetInfoToVisualize(Item)
@@ -86,6 +90,15 @@ void SGASAbilitiesTab::Construct(const FArguments& InArgs)
 						}
 					}
 				})
+				.OnExpansionChanged_Lambda([this](TSharedPtr<FGASAbilityNode> Item, const bool bExpanded)
+				{
+					if (Item &&
+						bExpanded)
+					{
+						Item->GatherChildren();
+						AbilitiesTree->RequestTreeRefresh();
+					}
+				})
 				.HighlightParentNodesForSelection(true)
 				.HeaderRow
 				(
@@ -130,11 +143,16 @@ void SGASAbilitiesTab::Construct(const FArguments& InArgs)
 
 void SGASAbilitiesTab::Refresh(UAbilitySystemComponent* Component)
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_AbilitiesRefresh, RefreshCost);
+
 	AbilitiesList.Reset();
+	MappedSnapshotAbilities.Reset();
 
 	TSet<FGameplayAbilitySpecHandle> UnusedAbilities;
 	MappedAbilities.GetKeys(UnusedAbilities);
 
+	RowWindow.BeginRefresh(ShouldUpdateEveryRow());
+
 	if (Component)
 	{
 		for (FGameplayAbilitySpec& AbilitySpec : Component->GetActivatableAbilities())
@@ -147,12 +165,15 @@ void SGASAbilitiesTab::Refresh(UAbilitySystemComponent* Component)
 			UnusedAbilities.Remove(AbilitySpec.Handle);
 			if (const TSharedPtr<FGASAbilityNode>& AbilityNode = MappedAbilities.FindRef(AbilitySpec.Handle))
 			{
-				AbilityNode->Update();
+				if (RowWindow.ShouldUpdate(AbilitiesTree->WidgetFromItem(AbilityNode).IsValid()))
+				{
+					AbilityNode->Update(ShouldGatherChildren(AbilityNode));
+				}
 				continue;
 			}
 
-			TSharedRef<FGASAbilityNode> NewItem = MakeShared<FGASAbilityNode>(Component, AbilitySpec.Handle);
-			NewItem->Update();
+			TSharedRef<FGASAbilityNode> NewItem = NodePool.Make<FGASAbilityNode>(NodePool, Component, AbilitySpec.Handle);
+			NewItem->Update(ShouldGatherChildren(NewItem));
 
 			MappedAbilities.Add(AbilitySpec.Handle, NewItem);
 		}
@@ -168,18 +189,73 @@ void SGASAbilitiesTab::Refresh(UAbilitySystemComponent* Component)
 	SortAbilities();
 }
 
+void SGASAbilitiesTab::Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff)
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_AbilitiesRefresh, RefreshCost);
+
+	AbilitiesList.Reset();
+	MappedAbilities.Reset();
+
+	TSet<uint32> UnusedAbilities;
+	MappedSnapshotAbilities.GetKeys(UnusedAbilities);
+
+	RowWindow.BeginRefresh(ShouldUpdateEveryRow());
+
+	if (Component)
+	{
+		for (const FGASAbilitySnapshot& Ability : Component->Abilities)
+		{
+			// Cheap, and off-screen rows have to be right once scrolled to
+			const EGASDiffChange DiffChange = Diff ? GetDiffChange(Diff->FindAbility(Ability.Ability)) : EGASDiffChange::Unchanged;
+
+			UnusedAbilities.Remove(Ability.Handle);
+			if (const TSharedPtr<FGASAbilityNode>& AbilityNode = MappedSnapshotAbilities.FindRef(Ability.Handle))
+			{
+				if (RowWindow.ShouldUpdate(AbilitiesTree->WidgetFromItem(AbilityNode).IsValid()))
+				{
+					AbilityNode->UpdateFromSnapshot(World, Ability);
+				}
+				AbilityNode->SetDiffChange(DiffChange);
+				continue;
+			}
+
+			TSharedRef<FGASAbilityNode> NewItem = NodePool.Make<FGASAbilityNode>(NodePool, nullptr, FGameplayAbilitySpecHandle());
+			NewItem->UpdateFromSnapshot(World, Ability);
+			NewItem->SetDiffChange(DiffChange);
+
+			MappedSnapshotAbilities.Add(Ability.Handle, NewItem);
+		}
+	}
+
+	for (const uint32 UnusedAbility : UnusedAbilities)
+	{
+		MappedSnapshotAbilities.Remove(UnusedAbility);
+	}
+
+	MappedSnapshotAbilities.GenerateValueArray(AbilitiesList);
+
+	SortAbilities();
+}
+
 TSharedRef<SWidget> SGASAbilitiesTab::CreateSearchBox()
 {
 	return
 		SAssignNew(SearchBox, SSearchBox)
 		.HintText(LOCTEXT("AbilitySearchHint", "Search abilities, states and triggers"))
 		.DelayChangeNotificationsWhileTyping(true)
-		.OnTextChanged_Lambda([this](const FText& NewText)
-		{
-			SearchFilter->SetRawFilterText(NewText);
-			SearchBox->SetError(SearchFilter->GetFilterErrorText());
-			ApplyFilter();
-		});
+		.OnTextChanged(this, &SGASAbilitiesTab::SetSearchText);
+}
+
+void SGASAbilitiesTab::SetSearchText(const FText& InSearchText)
+{
+	if (!SearchBox->GetText().EqualTo(InSearchText))
+	{
+		SearchBox->SetText(InSearchText);
+	}
+
+	SearchFilter->SetRawFilterText(InSearchText);
+	SearchBox->SetError(SearchFilter->GetFilterErrorText());
+	ApplyFilter();
 }
 
 TSharedRef<SCheckBox> SGASAbilitiesTab::CreateStateSettingsCheckBox(const EAbilityStateType::Type StateType)
@@ -226,6 +302,8 @@ TSharedRef<SCheckBox> SGASAbilitiesTab::CreateStateSettingsCheckBox(const EAbili
 
 void SGASAbilitiesTab::SortAbilities()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Sort, RefreshCost);
+
 	if (SortMode == EColumnSortMode::Ascending)
 	{
 		AbilitiesList.Sort([](const TSharedPtr<FGASAbilityNode>& A, const TSharedPtr<FGASAbilityNode>& B)
@@ -265,6 +343,22 @@ bool SGASAbilitiesTab::IsFilterActive() const
 	return !SearchFilter->GetRawFilterText().IsEmpty();
 }
 
+bool SGASAbilitiesTab::ShouldGatherChildren(const TSharedPtr<FGASAbilityNode>& Node) const
+{
+	return
+		IsFilterActive() ||
+		AbilitiesTree->IsItemExpanded(Node);
+}
+
+bool SGASAbilitiesTab::ShouldUpdateEveryRow() const
+{
+	// Filtering by state or text decides about rows nobody is looking at
+	constexpr uint8 AllStateTypes = EAbilityStateType::Active | EAbilityStateType::Blocked | EAbilityStateType::Inactive;
+	return
+		IsFilterActive() ||
+		(VisibleStateTypes & AllStateTypes) != AllStateTypes;
+}
+
 bool SGASAbilitiesTab::MatchesFilter(const FGASAbilityNode& Node) const
 {
 	if (Node.GetNodeType() == EGAAbilityNode::Ability &&
@@ -301,11 +395,19 @@ bool SGASAbilitiesTab::PassesFilter(const TSharedPtr<FGASAbilityNode>& Node) con
 
 void SGASAbilitiesTab::ApplyFilter()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Filter, RefreshCost);
+
 	FilteredAbilitiesList.Reset();
 
 	const bool bFilterActive = IsFilterActive();
 	for (const TSharedPtr<FGASAbilityNode>& AbilityNode : AbilitiesList)
 	{
+		// The search looks at tasks of collapsed rows too
+		if (bFilterActive)
+		{
+			AbilityNode->GatherChildren();
+		}
+
 		if (!PassesFilter(AbilityNode))
 		{
 			continue;
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GASAttachEditorNodePool.h"
+#include "GASAttachEditorStats.h"
+#include "GASAttachEditorRefreshScheduler.h"
 #include "Widgets/SCompoundWidget.h"
 #include "GameplayAbilitySpecHandle.h"
 #include "Misc/TextFilter.h"
@@ -13,6 +16,9 @@ class SCheckBox;
 class SSearchBox;
 class FGASAbilityNode;
 class UAbilitySystemComponent;
+struct FGASWorldSnapshot;
+struct FGASComponentSnapshot;
+struct FGASComponentDiff;
 
 using SAbilitiesTree = STreeView<TSharedPtr<FGASAbilityNode>>;
 using FGASAbilityTextFilter = TTextFilter<const FGASAbilityNode&>;
@@ -42,6 +48,15 @@ public:
 public:
 	void Refresh(UAbilitySystemComponent* Component);
 
+	/** Shows a component of another process, as of its latest snapshot, with the rows in Diff tinted */
+	void Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff = nullptr);
+
+	/** Same as typing into the search box */
+	void SetSearchText(const FText& InSearchText);
+
+	const FGASCostCounter& GetRefreshCost() const { return RefreshCost; }
+	const FGASNodePool& GetNodePool() const { return NodePool; }
+
 private:
 	TSharedRef<SWidget> CreateSearchBox();
 	TSharedRef<SCheckBox> CreateStateSettingsCheckBox(EAbilityStateType::Type StateType);
@@ -62,6 +77,8 @@ private:
 	FText GetHighlightText() const;
 
 	bool IsFilterActive() const;
+	bool ShouldGatherChildren(const TSharedPtr<FGASAbilityNode>& Node) const;
+	bool ShouldUpdateEveryRow() const;
 	bool MatchesFilter(const FGASAbilityNode& Node) const;
 	bool PassesFilter(const TSharedPtr<FGASAbilityNode>& Node) const;
 	void ApplyFilter();
@@ -76,6 +93,10 @@ private:
 	TArray<TSharedPtr<FGASAbilityNode>> AbilitiesList;
 	TArray<TSharedPtr<FGASAbilityNode>> FilteredAbilitiesList;
 	TMap<FGameplayAbilitySpecHandle, TSharedPtr<FGASAbilityNode>> MappedAbilities;
+	TMap<uint32, TSharedPtr<FGASAbilityNode>> MappedSnapshotAbilities;
+	FGASNodePool NodePool { TEXT("Abilities") };
+	FGASCostCounter RefreshCost;
+	FGASRowUpdateWindow RowWindow;
 	uint8 VisibleStateTypes = EAbilityStateType::MAX;
 	EColumnSortMode::Type SortMode = EColumnSortMode::None;
 
@@ -3,6 +3,8 @@
 #include "SGASAbilityItem.h"
 
 #include "GASAttachEditorAbilityAccessors.h"
+#include "GASAttachEditorDiff.h"
+#include "GASAttachSnapshot.h"
 #include "Styling/StyleColors.h"
 #include "AbilitySystemComponent.h"
 #include "Widgets/Input/SHyperlink.h"
@@ -15,15 +17,17 @@
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
 
-FGASAbilityNode::FGASAbilityNode(const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle)
+FGASAbilityNode::FGASAbilityNode(const FGASNodePool& NodePool, const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle)
 	: Type(EGAAbilityNode::Ability)
+	, NodePool(NodePool)
 	, AbilitySpecHandle(AbilitySpecHandle)
 	, WeakComponent(ASC)
 {
 }
 
-FGASAbilityNode::FGASAbilityNode(const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle, const TWeakObjectPtr<UGameplayTask>& InGameplayTask)
+FGASAbilityNode::FGASAbilityNode(const FGASNodePool& NodePool, const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle, const TWeakObjectPtr<UGameplayTask>& InGameplayTask)
 	: Type(EGAAbilityNode::Task)
+	, NodePool(NodePool)
 	, AbilitySpecHandle(AbilitySpecHandle)
 	, WeakComponent(ASC)
 	, GameplayTask(InGameplayTask)
@@ -34,15 +38,110 @@ FGASAbilityNode::FGASAbilityNode(const TWeakObjectPtr<UAbilitySystemComponent>&
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-void FGASAbilityNode::Update()
+void FGASAbilityNode::Update(const bool bGatherChildren)
 {
 	Name = FetchName();
-	State = FetchState(StateType);
+
+	float CooldownStart = 0.f;
+	float CooldownDuration = 0.f;
+	State = FetchState(StateType, CooldownStart, CooldownDuration);
+	if (CooldownDuration > 0.f)
+	{
+		Cooldown.Sync(WeakComponent.IsValid() ? WeakComponent->GetWorld() : nullptr, CooldownStart, CooldownDuration);
+	}
+	else
+	{
+		Cooldown.Reset();
+	}
+
 	TriggersData = FetchTriggersData();
 	ActiveState = IsActive() ? LOCTEXT("AbilityIsActiveYes", "Yes") : LOCTEXT("AbilityIsActiveNo", "No");
 	FetchSourceAsset();
 	FixupColor();
 
+	if (bGatherChildren)
+	{
+		TasksGatherFrame = GFrameCounter;
+		TasksWantedTime = FPlatformTime::Seconds();
+		FixupTasks();
+	}
+	else
+	{
+		DeferTasks();
+	}
+}
+
+void FGASAbilityNode::UpdateFromSnapshot(const FGASWorldSnapshot& World, const FGASAbilitySnapshot& Snapshot)
+{
+	Name = FText::FromString(FGASWorldSnapshot::GetCleanName(Snapshot.Ability));
+
+	Cooldown.Reset();
+	switch (Snapshot.State)
+	{
+	default: check(false);
+	case EGASAbilitySnapshotState::Inactive:
+		StateType = EAbilityStateType::Inactive;
+		State = FText::GetEmpty();
+		break;
+	case EGASAbilitySnapshotState::Active:
+		StateType = EAbilityStateType::Active;
+		State = FText::Format(LOCTEXT("ActiveCountFormat", "Active Count: {0}"), Snapshot.ActiveCount);
+		break;
+	case EGASAbilitySnapshotState::InputBlocked:
+		StateType = EAbilityStateType::Blocked;
+		State = LOCTEXT("InputBlocked", "Input Blocked");
+		break;
+	case EGASAbilitySnapshotState::TagBlocked:
+		StateType = EAbilityStateType::Blocked;
+		State = LOCTEXT("TagBlocked", "Blocked Tags");
+		break;
+	case EGASAbilitySnapshotState::Cooldown:
+		StateType = EAbilityStateType::Blocked;
+		State = LOCTEXT("CantActivate", "Can't Activate");
+		Cooldown.SyncRemote(World.WorldTime, World.LocalTime, World.TimeDilation, Snapshot.CooldownStartWorldTime, Snapshot.CooldownDuration);
+		break;
+	}
+
+	ActiveState = Snapshot.State == EGASAbilitySnapshotState::Active ? LOCTEXT("AbilityIsActiveYes", "Yes") : LOCTEXT("AbilityIsActiveNo", "No");
+
+	// Triggers are class defaults, so this process' copy of the class knows them as well as the other one
+	const UClass* AbilityClass = FGASWorldSnapshot::ResolveClass(Snapshot.Ability);
+	if (!SourceAsset.IsValid())
+	{
+		SourceAsset = FGASSourceAsset::FromClass(AbilityClass);
+	}
+
+	TriggersData = FText::GetEmpty();
+	if (const TArray<FAbilityTriggerData>* ActivationTagsPtr = AbilityClass ? FGASAbilityAccessors::FindAbilityTriggers(Cast<UGameplayAbility>(AbilityClass->GetDefaultObject())) : nullptr)
+	{
+		TArray<FText> TriggerTexts;
+		for (const FAbilityTriggerData& TriggerData : *ActivationTagsPtr)
+		{
+			TriggerTexts.Add(FText::Format(
+				LOCTEXT("AbilityTriggerFormat", "Tag: ({0}), Event: ({1})"),
+				FText::FromName(TriggerData.TriggerTag.GetTagName()),
+				UEnum::GetDisplayValueAsText(TriggerData.TriggerSource)));
+		}
+
+		TriggersData = FText::Join(FText::FromString(TEXT("\n")), TriggerTexts);
+	}
+
+	FixupColor();
+
+	MappedChildNodes.Reset();
+	ChildNodes.Reset();
+}
+
+void FGASAbilityNode::GatherChildren()
+{
+	TasksWantedTime = FPlatformTime::Seconds();
+
+	if (TasksGatherFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	TasksGatherFrame = GFrameCounter;
 	FixupTasks();
 }
 
@@ -114,7 +213,7 @@ FText FGASAbilityNode::FetchName() const
 	return {};
 }
 
-FText FGASAbilityNode::FetchState(EAbilityStateType::Type &OutStateType) const
+FText FGASAbilityNode::FetchState(EAbilityStateType::Type &OutStateType, float& OutCooldownStart, float& OutCooldownDuration) const
 {
 	if (Type != EGAAbilityNode::Ability)
 	{
@@ -169,15 +268,17 @@ FText FGASAbilityNode::FetchState(EAbilityStateType::Type &OutStateType) const
 	{
 		OutStateType = EAbilityStateType::Blocked;
 
-		const float Cooldown = Ability->GetCooldownTimeRemaining(WeakComponent->AbilityActorInfo.Get());
-		if (Cooldown > 0.f)
-		{
-			FNumberFormattingOptions NumberFormatOptions;
-			NumberFormatOptions.MaximumFractionalDigits = 2;
+		// GetState counts the cooldown down from here; once over it falls back to the text below
+		float TimeRemaining = 0.f;
+		float CooldownDuration = 0.f;
+		Ability->GetCooldownTimeRemainingAndDuration(AbilitySpecHandle, WeakComponent->AbilityActorInfo.Get(), TimeRemaining, CooldownDuration);
 
-			return FText::Format(
-				LOCTEXT("CantActivateCooldownFormat", "Can't Activate, Cooldown Time: {0}s"),
-				FText::AsNumber(Cooldown, &NumberFormatOptions));
+		const UWorld* World = WeakComponent->GetWorld();
+		if (World &&
+			TimeRemaining > 0.f)
+		{
+			OutCooldownStart = World->GetTimeSeconds() - (CooldownDuration - TimeRemaining);
+			OutCooldownDuration = CooldownDuration;
 		}
 
 		return LOCTEXT("CantActivate", "Can't Activate");
@@ -186,6 +287,22 @@ FText FGASAbilityNode::FetchState(EAbilityStateType::Type &OutStateType) const
 	return {};
 }
 
+FText FGASAbilityNode::GetState() const
+{
+	const float TimeRemaining = Cooldown.GetRemaining();
+	if (TimeRemaining <= 0.f)
+	{
+		return State;
+	}
+
+	FNumberFormattingOptions NumberFormatOptions;
+	NumberFormatOptions.MaximumFractionalDigits = 2;
+
+	return FText::Format(
+		LOCTEXT("CantActivateCooldownFormat", "Can't Activate, Cooldown Time: {0}s"),
+		FText::AsNumber(TimeRemaining, &NumberFormatOptions));
+}
+
 FText FGASAbilityNode::FetchTriggersData() const
 {
 	if (!WeakComponent.IsValid())
@@ -229,6 +346,17 @@ void FGASAbilityNode::FetchSourceAsset()
 	SourceAsset = FGASSourceAsset::FromObject(FindAbility());
 }
 
+void FGASAbilityNode::SetDiffChange(const EGASDiffChange InDiffChange)
+{
+	if (DiffChange == InDiffChange)
+	{
+		return;
+	}
+
+	DiffChange = InDiffChange;
+	FixupColor();
+}
+
 void FGASAbilityNode::FixupColor()
 {
 	switch (StateType)
@@ -238,6 +366,8 @@ void FGASAbilityNode::FixupColor()
 	case EAbilityStateType::Blocked: Tint = FStyleColors::Error.GetSpecifiedColor(); break;
 	case EAbilityStateType::Inactive: Tint = FSlateColor::UseSubduedForeground().GetColor(FWidgetStyle()); break;
 	}
+
+	Tint = GetDiffColor(DiffChange, Tint);
 }
 
 void FGASAbilityNode::FixupTasks()
@@ -288,7 +418,7 @@ void FGASAbilityNode::FixupTasks()
 				continue;
 			}
 
-			TSharedRef<FGASAbilityNode> NewTask = MakeShared<FGASAbilityNode>(WeakComponent, AbilitySpecHandle, Item);
+			TSharedRef<FGASAbilityNode> NewTask = NodePool.Make<FGASAbilityNode>(NodePool, WeakComponent, AbilitySpecHandle, Item);
 			NewTask->Update();
 			MappedChildNodes.Add(Key, NewTask);
 		}
@@ -302,6 +432,53 @@ void FGASAbilityNode::FixupTasks()
 	MappedChildNodes.GenerateValueArray(ChildNodes);
 }
 
+void FGASAbilityNode::DeferTasks()
+{
+	// A recently collapsed row keeps its tasks as they were, so expanding it again is instant
+	if (TasksGatherFrame != 0 &&
+		FPlatformTime::Seconds() - TasksWantedTime < TasksTimeout)
+	{
+		return;
+	}
+
+	TasksGatherFrame = 0;
+	MappedChildNodes.Reset();
+	ChildNodes.Reset();
+
+	if (HasActiveTasks())
+	{
+		if (!TasksPlaceholder)
+		{
+			TasksPlaceholder = NodePool.Make<FGASAbilityNode>(NodePool, WeakComponent, AbilitySpecHandle, TWeakObjectPtr<UGameplayTask>());
+		}
+
+		ChildNodes.Add(TasksPlaceholder);
+	}
+}
+
+bool FGASAbilityNode::HasActiveTasks() const
+{
+	const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpec();
+	if (!AbilitySpec ||
+		!AbilitySpec->IsActive() ||
+		Type != EGAAbilityNode::Ability)
+	{
+		return false;
+	}
+
+	for (UGameplayAbility* Instance : AbilitySpec->GetAbilityInstances())
+	{
+		const TArray<TObjectPtr<UGameplayTask>>* ActiveTasks = Instance ? FGASAbilityAccessors::FindActiveTasks(Instance) : nullptr;
+		if (ActiveTasks &&
+			ActiveTasks->Num() > 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
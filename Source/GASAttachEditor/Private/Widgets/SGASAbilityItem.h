@@ -6,11 +6,16 @@
 #include "GameplayTask.h"
 #include "GameplayAbilitySpec.h"
 #include "GASAttachEditorAbilityAccessors.h"
+#include "GASAttachEditorCountdown.h"
+#include "GASAttachEditorNodePool.h"
+#include "GASAttachSnapshotDiff.h"
 #include "UObject/ObjectKey.h"
 #include "Widgets/SGASAbilitiesTab.h"
 
 class STableViewBase;
 class UAbilitySystemComponent;
+struct FGASWorldSnapshot;
+struct FGASAbilitySnapshot;
 
 enum class EGAAbilityNode
 {
@@ -21,15 +26,26 @@ enum class EGAAbilityNode
 class FGASAbilityNode : public TSharedFromThis<FGASAbilityNode>
 {
 public:
-	explicit FGASAbilityNode(const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle);
-	explicit FGASAbilityNode(const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle, const TWeakObjectPtr<UGameplayTask>& InGameplayTask);
+	explicit FGASAbilityNode(const FGASNodePool& NodePool, const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle);
+	explicit FGASAbilityNode(const FGASNodePool& NodePool, const TWeakObjectPtr<UAbilitySystemComponent>& ASC, const FGameplayAbilitySpecHandle& AbilitySpecHandle, const TWeakObjectPtr<UGameplayTask>& InGameplayTask);
 
 public:
-	void Update();
+	/** With bGatherChildren unset, task rows are only kept for a while after being last needed. */
+	void Update(bool bGatherChildren = true);
+
+	/** Fills the row from another process' snapshot instead; such rows have no tasks. */
+	void UpdateFromSnapshot(const FGASWorldSnapshot& World, const FGASAbilitySnapshot& Snapshot);
+
+	/** Tints the row by how it differs from the base it's compared with */
+	void SetDiffChange(EGASDiffChange InDiffChange);
+
+	/** Builds the task rows now, for a row being expanded or searched. Free if already done this frame. */
+	void GatherChildren();
 
 	FORCEINLINE FText GetName() const { return Name; }
 	FORCEINLINE FLinearColor GetColor() const { return Tint; }
-	FORCEINLINE FText GetState() const { return State; }
+	/** A cooldown counts down at paint time, between refreshes */
+	FText GetState() const;
 	FORCEINLINE FText GetActiveState() const { return ActiveState; }
 	FORCEINLINE FText GetTriggersData() const { return TriggersData; }
 	FORCEINLINE EGAAbilityNode GetNodeType() const { return Type; }
@@ -40,12 +56,14 @@ private:
 	UGameplayAbility* FindAbility() const;
 
 	FText FetchName() const;
-	FText FetchState(EAbilityStateType::Type& OutStateType) const;
+	FText FetchState(EAbilityStateType::Type& OutStateType, float& OutCooldownStart, float& OutCooldownDuration) const;
 	FText FetchTriggersData() const;
 	void FetchSourceAsset();
 	bool IsActive() const;
 	void FixupColor();
 	void FixupTasks();
+	void DeferTasks();
+	bool HasActiveTasks() const;
 
 public:
 	bool CanNavigateToSource() const { return SourceAsset.CanNavigate(); }
@@ -57,19 +75,31 @@ private:
 	TMap<FObjectKey, TSharedPtr<FGASAbilityNode>> MappedChildNodes;
 	TArray<TSharedPtr<FGASAbilityNode>> ChildNodes;
 
+	// Stands in for the tasks while they are not gathered, so the row can still be expanded
+	TSharedPtr<FGASAbilityNode> TasksPlaceholder;
+	uint64 TasksGatherFrame = 0;
+	double TasksWantedTime = 0.0;
+
+	static constexpr double TasksTimeout = 5.0;
+
 	FText Name;
 	FLinearColor Tint = FLinearColor::White;
 	FText State;
+	FGASCountdown Cooldown;
 	FText ActiveState;
 	FText TriggersData;
 
 	EGAAbilityNode Type = EGAAbilityNode::Ability;
 
 	EAbilityStateType::Type StateType = EAbilityStateType::Active;
+	EGASDiffChange DiffChange = EGASDiffChange::Unchanged;
 
 	// Resolved once and kept, so the source link still works after PIE ends
 	FGASSourceAsset SourceAsset;
 
+	// Task nodes come from the same pool as their ability
+	FGASNodePool NodePool;
+
 	FGameplayAbilitySpecHandle AbilitySpecHandle;
 	TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
 	TWeakObjectPtr<UGameplayTask> GameplayTask;
@@ -0,0 +1,246 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASActorPicker.h"
+
+#include "GASAttachEditorSettings.h"
+#include "GASAttachEditorComponentIndex.h"
+
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SSearchBox.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+const TCHAR* SGASActorPicker::GroupingKey = TEXT("ActorPicker.Grouping");
+
+void SGASActorPicker::Construct(const FArguments& InArgs)
+{
+	Index = InArgs._Index;
+	OnComponentPicked = InArgs._OnComponentPicked;
+	Grouping = EGASActorPickerGrouping(FGASAttachEditorSettings::LoadInt(GroupingKey, int32(EGASActorPickerGrouping::None)));
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SAssignNew(SearchBox, SSearchBox)
+			.HintText(LOCTEXT("ActorPickerSearchHint", "Search actors and classes"))
+			.OnTextChanged(this, &SGASActorPicker::OnSearchTextChanged)
+			.OnTextCommitted(this, &SGASActorPicker::OnSearchTextCommitted)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				CreateGroupingCheckBox(EGASActorPickerGrouping::Class, LOCTEXT("ActorPickerGroupByClass", "Group by Class"))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				CreateGroupingCheckBox(EGASActorPickerGrouping::Role, LOCTEXT("ActorPickerGroupByRole", "Group by Role"))
+			]
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBox)
+			.MinDesiredWidth(300.f)
+			.MaxDesiredHeight(400.f)
+			[
+				SAssignNew(PickerTree, SGASActorPickerTree)
+				.TreeItemsSource(&RootItems)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow_Lambda([this](TSharedPtr<FGASActorPickerItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+				{
+					return
+						SNew(STableRow<TSharedPtr<FGASActorPickerItem>>, OwnerTable)
+						.Padding(FMargin(2.f, 1.f))
+						[
+							SNew(STextBlock)
+							.Text(Item->Label)
+							.HighlightText_Lambda([this]
+							{
+								return SearchText;
+							})
+							.ToolTipText(Item->Entry ? Item->Entry->ClassName : FText::GetEmpty())
+						];
+				})
+				.OnGetChildren_Lambda([](TSharedPtr<FGASActorPickerItem> Item, TArray<TSharedPtr<FGASActorPickerItem>>& OutChildren)
+				{
+					OutChildren = Item->Children;
+				})
+				.OnMouseButtonClick_Lambda([this](TSharedPtr<FGASActorPickerItem> Item)
+				{
+					Pick(Item);
+				})
+			]
+		]
+	];
+
+	Rebuild();
+}
+
+void SGASActorPicker::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Components come and go while the picker is open
+	if (Index &&
+		Index->GetGeneration() != BuiltGeneration)
+	{
+		Rebuild();
+	}
+}
+
+TSharedPtr<SWidget> SGASActorPicker::GetWidgetToFocus() const
+{
+	return SearchBox;
+}
+
+TSharedRef<SWidget> SGASActorPicker::CreateGroupingCheckBox(const EGASActorPickerGrouping InGrouping, const FText& Label)
+{
+	return
+		SNew(SCheckBox)
+		.Padding(FMargin(4.f, 0.f))
+		.IsChecked_Lambda([this, InGrouping]
+		{
+			return Grouping == InGrouping ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		})
+		.OnCheckStateChanged_Lambda([this, InGrouping](const ECheckBoxState NewValue)
+		{
+			Grouping = NewValue == ECheckBoxState::Checked ? InGrouping : EGASActorPickerGrouping::None;
+			FGASAttachEditorSettings::SaveInt(GroupingKey, int32(Grouping));
+
+			Rebuild();
+		})
+		[
+			SNew(STextBlock)
+			.Text(Label)
+		];
+}
+
+void SGASActorPicker::OnSearchTextChanged(const FText& InSearchText)
+{
+	SearchText = InSearchText;
+	SearchString = InSearchText.ToString().TrimStartAndEnd();
+
+	Rebuild();
+}
+
+void SGASActorPicker::OnSearchTextCommitted(const FText& InSearchText, const ETextCommit::Type CommitType)
+{
+	// Enter takes the first match, so typing a few letters is enough to switch actors
+	if (CommitType == ETextCommit::OnEnter)
+	{
+		Pick(FindFirstComponent());
+	}
+}
+
+void SGASActorPicker::Rebuild()
+{
+	RootItems.Reset();
+
+	if (!Index)
+	{
+		PickerTree->RequestTreeRefresh();
+		return;
+	}
+
+	BuiltGeneration = Index->GetGeneration();
+
+	TMap<FName, TSharedPtr<FGASActorPickerItem>> Groups;
+
+	// The index is sorted by name already, so are the components within each group
+	for (const TSharedPtr<const FGASComponentIndexEntry>& Entry : Index->GetEntries())
+	{
+		if (!PassesFilter(*Entry))
+		{
+			continue;
+		}
+
+		TSharedRef<FGASActorPickerItem> Item = MakeShared<FGASActorPickerItem>();
+		Item->Label = Entry->DisplayName;
+		Item->Entry = Entry;
+
+		if (Grouping == EGASActorPickerGrouping::None)
+		{
+			RootItems.Add(Item);
+			continue;
+		}
+
+		const FName GroupKey = Grouping == EGASActorPickerGrouping::Class
+			? Entry->ClassKey
+			: StaticEnum<ENetRole>()->GetNameByValue(Entry->Role);
+
+		TSharedPtr<FGASActorPickerItem>& Group = Groups.FindOrAdd(GroupKey);
+		if (!Group)
+		{
+			Group = MakeShared<FGASActorPickerItem>();
+			Group->Label = Grouping == EGASActorPickerGrouping::Class ? Entry->ClassName : Entry->RoleName;
+			RootItems.Add(Group);
+		}
+
+		Group->Children.Add(Item);
+	}
+
+	if (Grouping != EGASActorPickerGrouping::None)
+	{
+		RootItems.Sort([](const TSharedPtr<FGASActorPickerItem>& A, const TSharedPtr<FGASActorPickerItem>& B)
+		{
+			return A->Label.CompareTo(B->Label) < 0;
+		});
+
+		for (const TSharedPtr<FGASActorPickerItem>& Group : RootItems)
+		{
+			Group->Label = FText::Format(LOCTEXT("ActorPickerGroupFormat", "{0} ({1})"), Group->Label, Group->Children.Num());
+			PickerTree->SetItemExpansion(Group, true);
+		}
+	}
+
+	PickerTree->RequestTreeRefresh();
+}
+
+bool SGASActorPicker::PassesFilter(const FGASComponentIndexEntry& Entry) const
+{
+	return
+		SearchString.IsEmpty() ||
+		Entry.Name.Contains(SearchString) ||
+		Entry.ClassName.ToString().Contains(SearchString);
+}
+
+void SGASActorPicker::Pick(const TSharedPtr<FGASActorPickerItem>& Item) const
+{
+	if (Item &&
+		Item->Entry)
+	{
+		OnComponentPicked.ExecuteIfBound(Item->Entry->Component);
+	}
+}
+
+TSharedPtr<FGASActorPickerItem> SGASActorPicker::FindFirstComponent() const
+{
+	for (const TSharedPtr<FGASActorPickerItem>& Item : RootItems)
+	{
+		if (Item->Entry)
+		{
+			return Item;
+		}
+
+		if (Item->Children.Num() > 0)
+		{
+			return Item->Children[0];
+		}
+	}
+
+	return nullptr;
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
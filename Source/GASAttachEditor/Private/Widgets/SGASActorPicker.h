@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+
+class SSearchBox;
+class FGASComponentIndex;
+class UAbilitySystemComponent;
+struct FGASComponentIndexEntry;
+
+DECLARE_DELEGATE_OneParam(FOnGASComponentPicked, TWeakObjectPtr<UAbilitySystemComponent>);
+
+enum class EGASActorPickerGrouping : uint8
+{
+	None,
+	Class,
+	Role,
+};
+
+/** A row of the picker - a component, or a class or role group of them */
+struct FGASActorPickerItem
+{
+	FText Label;
+	TSharedPtr<const FGASComponentIndexEntry> Entry;
+	TArray<TSharedPtr<FGASActorPickerItem>> Children;
+};
+
+using SGASActorPickerTree = STreeView<TSharedPtr<FGASActorPickerItem>>;
+
+/**
+ * Type-ahead picker over a component index.
+ *
+ * The rows are virtualized and built from the names the index already resolved, so opening it and
+ * typing into it costs the same with a handful of components as with thousands. It rebuilds only when
+ * the search, the grouping or the index generation changes.
+ */
+class SGASActorPicker : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASActorPicker)
+		: _Index(nullptr)
+	{}
+		SLATE_ARGUMENT(const FGASComponentIndex*, Index)
+		SLATE_EVENT(FOnGASComponentPicked, OnComponentPicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	//~ Begin SCompoundWidget Interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	//~ End SCompoundWidget Interface
+
+	TSharedPtr<SWidget> GetWidgetToFocus() const;
+
+private:
+	TSharedRef<SWidget> CreateGroupingCheckBox(EGASActorPickerGrouping InGrouping, const FText& Label);
+
+	void OnSearchTextChanged(const FText& InSearchText);
+	void OnSearchTextCommitted(const FText& InSearchText, ETextCommit::Type CommitType);
+
+	void Rebuild();
+	bool PassesFilter(const FGASComponentIndexEntry& Entry) const;
+
+	void Pick(const TSharedPtr<FGASActorPickerItem>& Item) const;
+	TSharedPtr<FGASActorPickerItem> FindFirstComponent() const;
+
+	static const TCHAR* GroupingKey;
+
+private:
+	const FGASComponentIndex* Index = nullptr;
+	FOnGASComponentPicked OnComponentPicked;
+
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SGASActorPickerTree> PickerTree;
+
+	FText SearchText;
+	FString SearchString;
+	EGASActorPickerGrouping Grouping = EGASActorPickerGrouping::None;
+	uint32 BuiltGeneration = 0;
+
+	TArray<TSharedPtr<FGASActorPickerItem>> RootItems;
+};
\ No newline at end of file
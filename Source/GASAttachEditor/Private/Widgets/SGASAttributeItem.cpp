@@ -2,6 +2,9 @@
 
 #include "SGASAttributeItem.h"
 #include "AbilitySystemComponent.h"
+#include "GASAttachEditorAttributeLog.h"
+#include "GASAttachEditorDiff.h"
+#include "GASAttachSnapshot.h"
 #include "Widgets/SGASAttributesTab.h"
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
@@ -31,6 +34,14 @@ FGASAttributeNode::FGASAttributeNode(const TWeakObjectPtr<UAbilitySystemComponen
 	}
 }
 
+FGASAttributeNode::FGASAttributeNode(const FGASAttributeSnapshot& Snapshot)
+	: Type(EGASAttributeNode::Attribute)
+{
+	RawName = Snapshot.Name.ToString();
+	Name = FText::FromString(FName::NameToDisplayString(RawName, false));
+	CollectionName = FText::FromString(FName::NameToDisplayString(FGASWorldSnapshot::GetCleanName(Snapshot.Set), false));
+}
+
 void FGASAttributeNode::Update(UAbilitySystemComponent* NewComponent)
 {
 	if (Type == EGASAttributeNode::Collection)
@@ -43,6 +54,38 @@ void FGASAttributeNode::Update(UAbilitySystemComponent* NewComponent)
 	BaseValueText = GatherBaseValue(BaseValue);
 }
 
+void FGASAttributeNode::UpdateFromSnapshot(const FGASAttributeSnapshot& Snapshot)
+{
+	WeakComponent = nullptr;
+	Value = Snapshot.CurrentValue;
+	ValueText = FText::AsNumber(Value);
+	BaseValue = Snapshot.BaseValue;
+	BaseValueText = FText::AsNumber(BaseValue);
+}
+
+void FGASAttributeNode::SetDiff(const FGASDiffEntry* Entry)
+{
+	DiffChange = GetDiffChange(Entry);
+
+	switch (DiffChange)
+	{
+	case EGASDiffChange::Added:		DiffToolTip = LOCTEXT("AttributeAdded", "Not in the base"); break;
+	case EGASDiffChange::Removed:	DiffToolTip = FText::Format(LOCTEXT("AttributeRemovedFormat", "Only in the base, as {0}"), FText::FromString(Entry->Before)); break;
+	case EGASDiffChange::Changed:	DiffToolTip = FText::Format(LOCTEXT("AttributeChangedFormat", "{0} in the base"), FText::FromString(Entry->Before)); break;
+	default:						DiffToolTip = FText::GetEmpty(); break;
+	}
+}
+
+FSlateColor FGASAttributeNode::GetColor() const
+{
+	if (DiffChange == EGASDiffChange::Unchanged)
+	{
+		return FSlateColor::UseForeground();
+	}
+
+	return GetDiffColor(DiffChange, FLinearColor::White);
+}
+
 FText FGASAttributeNode::GatherValue(float& OutValue) const
 {
 	const UAbilitySystemComponent* Component = WeakComponent.Get();
@@ -109,6 +152,7 @@ TSharedRef<SWidget> SGASAttributeItem::GenerateWidgetForColumn(const FName& Colu
 			[
 				SNew(STextBlock)
 				.Text(MakeAttributeSP(WidgetInfo.Get(), bIsCollection ? &FGASAttributeNode::GetCollectionName : &FGASAttributeNode::GetName))
+				.ColorAndOpacity(MakeAttributeSP(WidgetInfo.Get(), &FGASAttributeNode::GetColor))
 				.HighlightText(HighlightText)
 				.Justification(ETextJustify::Left)
 			];
@@ -128,6 +172,8 @@ TSharedRef<SWidget> SGASAttributeItem::GenerateWidgetForColumn(const FName& Colu
 		.Padding(2.0f, 0.0f)
 		[
 			SAssignNew(TextField, STextBlock)
+			.ColorAndOpacity(MakeAttributeSP(WidgetInfo.Get(), &FGASAttributeNode::GetColor))
+			.ToolTipText(MakeAttributeSP(WidgetInfo.Get(), &FGASAttributeNode::GetDiffToolTip))
 			.Justification(ETextJustify::Center)
 		];
 
@@ -148,4 +194,90 @@ TSharedRef<SWidget> SGASAttributeItem::GenerateWidgetForColumn(const FName& Colu
 	return Result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SGASAttributeChangeItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Record = InArgs._Record;
+	SetPadding(0.f);
+
+	check(Record.IsValid());
+
+	SMultiColumnTableRow<TSharedPtr<FGASAttributeChangeRecord>>::Construct(SMultiColumnTableRow<TSharedPtr<FGASAttributeChangeRecord>>::FArguments().Padding(0.f), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SGASAttributeChangeItem::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	FNumberFormattingOptions NumberFormatOptions;
+	NumberFormatOptions.MaximumFractionalDigits = 2;
+
+	FText Text;
+	if (SGASAttributesTab::ChangeFrameColumn == ColumnName)
+	{
+		Text = FText::AsNumber(Record->Frame, &FNumberFormattingOptions::DefaultNoGrouping());
+	}
+	else if (SGASAttributesTab::ChangeTimeColumn == ColumnName)
+	{
+		Text = FText::AsNumber(Record->WorldTime, &NumberFormatOptions);
+	}
+	else if (SGASAttributesTab::ChangeValueColumn == ColumnName)
+	{
+		Text = FText::Format(
+			LOCTEXT("AttributeChangeValueFormat", "{0} -> {1}"),
+			FText::AsNumber(Record->OldValue, &NumberFormatOptions),
+			FText::AsNumber(Record->NewValue, &NumberFormatOptions));
+	}
+	else if (SGASAttributesTab::ChangeMagnitudeColumn == ColumnName)
+	{
+		Text = FText::AsNumber(Record->Magnitude, &NumberFormatOptions);
+	}
+	else if (SGASAttributesTab::ChangeSourceColumn == ColumnName)
+	{
+		Text = GetSourceText();
+	}
+	else
+	{
+		ensure(false);
+		return SNullWidget::NullWidget;
+	}
+
+	return
+		SNew(SBox)
+		.VAlign(VAlign_Center)
+		.Padding(2.0f, 0.0f)
+		[
+			SNew(STextBlock)
+			.Text(Text)
+			.ToolTipText(Text)
+		];
+}
+
+FText SGASAttributeChangeItem::GetSourceText() const
+{
+	if (Record->EffectName.IsNone())
+	{
+		return LOCTEXT("AttributeChangeNoSource", "Base value / aggregator");
+	}
+
+	FText Result = FText::FromName(Record->EffectName);
+
+	if (!Record->InstigatorName.IsNone())
+	{
+		Result = FText::Format(LOCTEXT("AttributeChangeInstigatorFormat", "{0}, From: {1}"), Result, FText::FromName(Record->InstigatorName));
+	}
+
+	if (Record->bExecuted)
+	{
+		Result = FText::Format(LOCTEXT("AttributeChangeExecutedFormat", "{0} (executed)"), Result);
+	}
+	else if (Record->bInferred)
+	{
+		Result = FText::Format(LOCTEXT("AttributeChangeInferredFormat", "{0} (inferred)"), Result);
+	}
+
+	return Result;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
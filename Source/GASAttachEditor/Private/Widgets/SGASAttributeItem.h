@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
+#include "GASAttachSnapshotDiff.h"
 #include "Widgets/Views/STableRow.h"
 
 class UAbilitySystemComponent;
+struct FGASAttributeChangeRecord;
+struct FGASAttributeSnapshot;
 
 enum class EGASAttributeNode
 {
@@ -19,8 +22,14 @@ class FGASAttributeNode : public TSharedFromThis<FGASAttributeNode>
 public:
 	explicit FGASAttributeNode(FName CollectionKey, const FText& CollectionName);
 	explicit FGASAttributeNode(const TWeakObjectPtr<UAbilitySystemComponent>& ASComponent, const FGameplayAttribute& Attribute);
+	/** An attribute of another process, which has no FGameplayAttribute here */
+	explicit FGASAttributeNode(const FGASAttributeSnapshot& Snapshot);
 
 	void Update(UAbilitySystemComponent* NewComponent);
+	void UpdateFromSnapshot(const FGASAttributeSnapshot& Snapshot);
+
+	/** Tints the row by how it differs from the base it's compared with, and keeps what it was for the tooltip */
+	void SetDiff(const FGASDiffEntry* Entry);
 
 public:
 	FORCEINLINE EGASAttributeNode GetNodeType() const { return Type; }
@@ -34,6 +43,9 @@ public:
 	FORCEINLINE FText GetValueText() const { return ValueText; }
 	FORCEINLINE float GetBaseValue() const { return BaseValue; }
 	FORCEINLINE FText GetBaseValueText() const { return BaseValueText; }
+	FORCEINLINE const FGameplayAttribute& GetAttribute() const { return Attribute; }
+	FSlateColor GetColor() const;
+	FORCEINLINE FText GetDiffToolTip() const { return DiffToolTip; }
 
 	const TArray<TSharedPtr<FGASAttributeNode>>& GetChildNodes() const { return ChildNodes; }
 	void ResetChildNodes() { ChildNodes.Reset(); }
@@ -55,6 +67,8 @@ private:
 	FText ValueText;
 	float BaseValue = 0.f;
 	FText BaseValueText;
+	EGASDiffChange DiffChange = EGASDiffChange::Unchanged;
+	FText DiffToolTip;
 
 	TArray<TSharedPtr<FGASAttributeNode>> ChildNodes;
 
@@ -82,4 +96,25 @@ protected:
 private:
 	TSharedPtr<FGASAttributeNode> WidgetInfo;
 	TAttribute<FText> HighlightText;
+};
+
+class SGASAttributeChangeItem : public SMultiColumnTableRow<TSharedPtr<FGASAttributeChangeRecord>>
+{
+public:
+	SLATE_BEGIN_ARGS(SGASAttributeChangeItem)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<FGASAttributeChangeRecord>, Record)
+	SLATE_END_ARGS()
+
+public:
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+
+protected:
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	FText GetSourceText() const;
+
+private:
+	TSharedPtr<FGASAttributeChangeRecord> Record;
 };
\ No newline at end of file
@@ -4,13 +4,17 @@
 
 #include "SGASAttributeItem.h"
 #include "GASAttachEditorSettings.h"
+#include "GASAttachEditorAttributeLog.h"
+#include "GASAttachSnapshot.h"
 
 #include "AbilitySystemComponent.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SSplitter.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Input/SComboButton.h"
+#include "Misc/PackageName.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
@@ -19,6 +23,7 @@ const TCHAR* SGASAttributesTab::HiddenCollectionsKey = TEXT("HiddenAttributeColl
 const TCHAR* SGASAttributesTab::HiddenColumnsKey = TEXT("Attributes.HiddenColumns");
 const TCHAR* SGASAttributesTab::HideZeroKey = TEXT("Attributes.HideZero");
 const TCHAR* SGASAttributesTab::OnlyModifiedKey = TEXT("Attributes.OnlyModified");
+const TCHAR* SGASAttributesTab::RecordChangesKey = TEXT("Attributes.RecordChanges");
 const TCHAR* SGASAttributesTab::NameSortKey = TEXT("Attributes.NameSort");
 const TCHAR* SGASAttributesTab::ValueSortKey = TEXT("Attributes.ValueSort");
 const TCHAR* SGASAttributesTab::BaseValueSortKey = TEXT("Attributes.BaseValueSort");
@@ -27,9 +32,16 @@ const FName SGASAttributesTab::AttributeNameColumn = "Attribute_Name";
 const FName SGASAttributesTab::AttributeValueColumn = "Attribute_Value";
 const FName SGASAttributesTab::AttributeBaseValueColumn = "Attribute_BaseValue";
 
+const FName SGASAttributesTab::ChangeFrameColumn = "Change_Frame";
+const FName SGASAttributesTab::ChangeTimeColumn = "Change_Time";
+const FName SGASAttributesTab::ChangeValueColumn = "Change_Value";
+const FName SGASAttributesTab::ChangeMagnitudeColumn = "Change_Magnitude";
+const FName SGASAttributesTab::ChangeSourceColumn = "Change_Source";
+
 void SGASAttributesTab::Construct(const FArguments& InArgs)
 {
 	SearchFilter = MakeShared<FGASAttributeTextFilter>(FGASAttributeTextFilter::FItemToStringArray::CreateSP(this, &SGASAttributesTab::PopulateSearchStrings));
+	ChangeRecorder = MakeShared<FGASAttributeChangeRecorder>();
 
 	LoadSettings();
 
@@ -53,6 +65,11 @@ void SGASAttributesTab::Construct(const FArguments& InArgs)
 			]
 			+ SHorizontalBox::Slot()
 			.AutoWidth()
+			[
+				CreateRecordChangesCheckBox()
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
 			.Padding(8.f, 0.f, 0.f, 0.f)
 			.VAlign(VAlign_Center)
 			[
@@ -68,88 +85,107 @@ void SGASAttributesTab::Construct(const FArguments& InArgs)
 		+ SVerticalBox::Slot()
 		.FillHeight(1.f)
 		[
-			SNew(SBorder)
-			.Padding(0.f)
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+			+ SSplitter::Slot()
+			.Value(.75f)
 			[
-				SAssignNew(AttributesTree, SAttributesTree)
-				.TreeItemsSource(&FilteredAttributesList)
-				.OnGenerateRow_Lambda([this](TSharedPtr<FGASAttributeNode> Item, const TSharedRef<STableViewBase>& OwnerTable)
-				{
-					return
-						SNew(SGASAttributeItem, OwnerTable)
-						.WidgetInfoToVisualize(Item)
-						.HighlightText(this, &SGASAttributesTab::GetHighlightText);
-				})
-				.OnGetChildren_Lambda([this](TSharedPtr<FGASAttributeNode> Item, TArray<TSharedPtr<FGASAttributeNode>>& OutChildren)
-				{
-					const bool bCollectionMatchesText = MatchesText(*Item);
-					for (const TSharedPtr<FGASAttributeNode>& ChildNode : Item->GetChildNodes())
-					{
-						if (ChildNode &&
-							IsAttributeVisible(*ChildNode, bCollectionMatchesText))
-						{
-							OutChildren.Add(ChildNode);
-						}
-					}
-				})
-				.HighlightParentNodesForSelection(true)
-				.HeaderRow
-				(
-					SAssignNew(HeaderRow, SHeaderRow)
-					.CanSelectGeneratedColumn(true)
-					.HiddenColumnsList(HiddenColumns)
-					.OnHiddenColumnsListChanged(FSimpleDelegate::CreateSP(this, &SGASAttributesTab::SaveHiddenColumns))
-
-					+ SHeaderRow::Column(AttributeNameColumn)
-					.SortMode_Lambda([this]
-					{
-						return NameSortMode;
-					})
-					.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+				SNew(SBorder)
+				.Padding(0.f)
+				[
+					SAssignNew(AttributesTree, SAttributesTree)
+					.TreeItemsSource(&FilteredAttributesList)
+					.OnGenerateRow_Lambda([this](TSharedPtr<FGASAttributeNode> Item, const TSharedRef<STableViewBase>& OwnerTable)
 					{
-						NameSortMode = InSortMode;
-						ValueSortMode = EColumnSortMode::None;
-						BaseValueSortMode = EColumnSortMode::None;
-						SaveSettings();
-						SortAttributes();
-					})
-					.DefaultLabel(LOCTEXT("AttributeNameColumn", "Name"))
-					.DefaultTooltip(LOCTEXT("AttributeNameColumnToolTip", "Attribute set and the attributes it declares"))
-					.FillWidth(.6f)
-					.ShouldGenerateWidget(true)
+						GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GenerateRow, RefreshCost);
 
-					+ SHeaderRow::Column(AttributeValueColumn)
-					.SortMode_Lambda([this]
-					{
-						return ValueSortMode;
+						return
+							SNew(SGASAttributeItem, OwnerTable)
+							.WidgetInfoToVisualize(Item)
+							.HighlightText(this, &SGASAttributesTab::GetHighlightText);
 					})
-					.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
-					{
-						NameSortMode = EColumnSortMode::None;
-						ValueSortMode = InSortMode;
-						BaseValueSortMode = EColumnSortMode::None;
-						SaveSettings();
-						SortAttributes();
-					})
-					.DefaultLabel(LOCTEXT("AttributeValueColumn", "Value"))
-					.FillWidth(.2f)
-
-					+ SHeaderRow::Column(AttributeBaseValueColumn)
-					.SortMode_Lambda([this]
+					.OnGetChildren_Lambda([this](TSharedPtr<FGASAttributeNode> Item, TArray<TSharedPtr<FGASAttributeNode>>& OutChildren)
 					{
-						return BaseValueSortMode;
+						const bool bCollectionMatchesText = MatchesText(*Item);
+						for (const TSharedPtr<FGASAttributeNode>& ChildNode : Item->GetChildNodes())
+						{
+							if (ChildNode &&
+								IsAttributeVisible(*ChildNode, bCollectionMatchesText))
+							{
+								OutChildren.Add(ChildNode);
+							}
+						}
 					})
-					.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+					.HighlightParentNodesForSelection(true)
+					.OnSelectionChanged_Lambda([this](TSharedPtr<FGASAttributeNode> Item, ESelectInfo::Type)
 					{
-						NameSortMode = EColumnSortMode::None;
-						ValueSortMode = EColumnSortMode::None;
-						BaseValueSortMode = InSortMode;
-						SaveSettings();
-						SortAttributes();
+						SelectedAttribute = Item;
+						NumChangesShown = MAX_uint64;
+						RefreshChanges();
 					})
-					.DefaultLabel(LOCTEXT("AttributeBaseValueColumn", "Base Value"))
-					.FillWidth(.2f)
-				)
+					.HeaderRow
+					(
+						SAssignNew(HeaderRow, SHeaderRow)
+						.CanSelectGeneratedColumn(true)
+						.HiddenColumnsList(HiddenColumns)
+						.OnHiddenColumnsListChanged(FSimpleDelegate::CreateSP(this, &SGASAttributesTab::SaveHiddenColumns))
+
+						+ SHeaderRow::Column(AttributeNameColumn)
+						.SortMode_Lambda([this]
+						{
+							return NameSortMode;
+						})
+						.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+						{
+							NameSortMode = InSortMode;
+							ValueSortMode = EColumnSortMode::None;
+							BaseValueSortMode = EColumnSortMode::None;
+							SaveSettings();
+							SortAttributes();
+						})
+						.DefaultLabel(LOCTEXT("AttributeNameColumn", "Name"))
+						.DefaultTooltip(LOCTEXT("AttributeNameColumnToolTip", "Attribute set and the attributes it declares"))
+						.FillWidth(.6f)
+						.ShouldGenerateWidget(true)
+
+						+ SHeaderRow::Column(AttributeValueColumn)
+						.SortMode_Lambda([this]
+						{
+							return ValueSortMode;
+						})
+						.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+						{
+							NameSortMode = EColumnSortMode::None;
+							ValueSortMode = InSortMode;
+							BaseValueSortMode = EColumnSortMode::None;
+							SaveSettings();
+							SortAttributes();
+						})
+						.DefaultLabel(LOCTEXT("AttributeValueColumn", "Value"))
+						.FillWidth(.2f)
+
+						+ SHeaderRow::Column(AttributeBaseValueColumn)
+						.SortMode_Lambda([this]
+						{
+							return BaseValueSortMode;
+						})
+						.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+						{
+							NameSortMode = EColumnSortMode::None;
+							ValueSortMode = EColumnSortMode::None;
+							BaseValueSortMode = InSortMode;
+							SaveSettings();
+							SortAttributes();
+						})
+						.DefaultLabel(LOCTEXT("AttributeBaseValueColumn", "Base Value"))
+						.FillWidth(.2f)
+					)
+				]
+			]
+			+ SSplitter::Slot()
+			.Value(.25f)
+			[
+				CreateChangesPanel()
 			]
 		]
 	];
@@ -157,6 +193,10 @@ void SGASAttributesTab::Construct(const FArguments& InArgs)
 
 void SGASAttributesTab::Refresh(UAbilitySystemComponent* Component)
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_AttributesRefresh, RefreshCost);
+
+	SetShowingSnapshot(false);
+
 	AttributesList.Reset();
 
 	TSet<FName> UnusedAttributes;
@@ -170,6 +210,8 @@ void SGASAttributesTab::Refresh(UAbilitySystemComponent* Component)
 		It.Value->ResetChildNodes();
 	}
 
+	RowWindow.BeginRefresh(ShouldUpdateEveryRow());
+
 	if (Component)
 	{
 		for (const UAttributeSet* Set : Component->GetSpawnedAttributes())
@@ -187,7 +229,7 @@ void SGASAttributesTab::Refresh(UAbilitySystemComponent* Component)
 			TSharedPtr<FGASAttributeNode> CollectionNode = MappedCollections.FindRef(CollectionKey);
 			if (!CollectionNode)
 			{
-				CollectionNode = MakeShared<FGASAttributeNode>(CollectionKey, CollectionName);
+				CollectionNode = NodePool.Make<FGASAttributeNode>(CollectionKey, CollectionName);
 				MappedCollections.Add(CollectionKey, CollectionNode);
 				AttributesTree->SetItemExpansion(CollectionNode, true);
 			}
@@ -209,11 +251,14 @@ void SGASAttributesTab::Refresh(UAbilitySystemComponent* Component)
 				{
 					FGameplayAttribute Attribute(Property);
 
-					AttributeNode = MakeShared<FGASAttributeNode>(Component, Attribute);
+					AttributeNode = NodePool.Make<FGASAttributeNode>(Component, Attribute);
 					MappedAttributes.Add(Key, AttributeNode);
+					AttributeNode->Update(Component);
+				}
+				else if (RowWindow.ShouldUpdate(AttributesTree->WidgetFromItem(AttributeNode).IsValid()))
+				{
+					AttributeNode->Update(Component);
 				}
-
-				AttributeNode->Update(Component);
 				CollectionNode->AddChildNode(AttributeNode);
 			}
 		}
@@ -232,6 +277,118 @@ void SGASAttributesTab::Refresh(UAbilitySystemComponent* Component)
 	MappedCollections.GenerateValueArray(AttributesList);
 
 	SortAttributes();
+
+	if (bRecordChanges)
+	{
+		ChangeRecorder->Bind(Component);
+	}
+
+	RefreshChanges();
+}
+
+void SGASAttributesTab::Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff)
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_AttributesRefresh, RefreshCost);
+
+	SetShowingSnapshot(true);
+
+	AttributesList.Reset();
+
+	TSet<FName> UnusedAttributes;
+	MappedAttributes.GetKeys(UnusedAttributes);
+
+	TSet<FName> UnusedCollections;
+	MappedCollections.GetKeys(UnusedCollections);
+
+	for (const TPair<FName, TSharedPtr<FGASAttributeNode>>& It : MappedCollections)
+	{
+		It.Value->ResetChildNodes();
+	}
+
+	RowWindow.BeginRefresh(ShouldUpdateEveryRow());
+
+	if (Component)
+	{
+		FName SetPath;
+		TSharedPtr<FGASAttributeNode> CollectionNode;
+
+		// A component's attributes come set by set, so the collection only needs looking up when the set changes
+		for (const FGASAttributeSnapshot& Attribute : Component->Attributes)
+		{
+			if (!CollectionNode ||
+				Attribute.Set != SetPath)
+			{
+				SetPath = Attribute.Set;
+
+				// Keyed by class name like the live rows, so hidden collections carry over
+				const FString ClassName = FPackageName::ObjectPathToObjectName(SetPath.ToString());
+				const FName CollectionKey = *ClassName;
+				const FText CollectionName = FText::FromString(FName::NameToDisplayString(ClassName, false));
+
+				KnownCollections.Add(CollectionKey, CollectionName);
+
+				CollectionNode = MappedCollections.FindRef(CollectionKey);
+				if (!CollectionNode)
+				{
+					CollectionNode = NodePool.Make<FGASAttributeNode>(CollectionKey, CollectionName);
+					MappedCollections.Add(CollectionKey, CollectionNode);
+					AttributesTree->SetItemExpansion(CollectionNode, true);
+				}
+				UnusedCollections.Remove(CollectionKey);
+			}
+
+			const FName Key = *(SetPath.ToString() + Attribute.Name.ToString());
+
+			UnusedAttributes.Remove(Key);
+
+			TSharedPtr<FGASAttributeNode> AttributeNode = MappedAttributes.FindRef(Key);
+			if (!AttributeNode)
+			{
+				AttributeNode = NodePool.Make<FGASAttributeNode>(Attribute);
+				MappedAttributes.Add(Key, AttributeNode);
+				AttributeNode->UpdateFromSnapshot(Attribute);
+			}
+			else if (RowWindow.ShouldUpdate(AttributesTree->WidgetFromItem(AttributeNode).IsValid()))
+			{
+				AttributeNode->UpdateFromSnapshot(Attribute);
+			}
+			AttributeNode->SetDiff(Diff ? Diff->FindAttribute(Attribute.Set, Attribute.Name) : nullptr);
+			CollectionNode->AddChildNode(AttributeNode);
+		}
+	}
+
+	for (const FName UnusedAttribute : UnusedAttributes)
+	{
+		MappedAttributes.Remove(UnusedAttribute);
+	}
+
+	for (const FName UnusedCollection : UnusedCollections)
+	{
+		MappedCollections.Remove(UnusedCollection);
+	}
+
+	MappedCollections.GenerateValueArray(AttributesList);
+
+	SortAttributes();
+	RefreshChanges();
+}
+
+void SGASAttributesTab::SetShowingSnapshot(const bool bInShowingSnapshot)
+{
+	if (bShowingSnapshot == bInShowingSnapshot)
+	{
+		return;
+	}
+
+	bShowingSnapshot = bInShowingSnapshot;
+
+	MappedAttributes.Reset();
+	MappedCollections.Reset();
+
+	if (bShowingSnapshot)
+	{
+		ChangeRecorder->Unbind();
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -244,12 +401,19 @@ TSharedRef<SWidget> SGASAttributesTab::CreateSearchBox()
 		SAssignNew(SearchBox, SSearchBox)
 		.HintText(LOCTEXT("AttributeSearchHint", "Search attributes and attribute sets"))
 		.DelayChangeNotificationsWhileTyping(true)
-		.OnTextChanged_Lambda([this](const FText& NewText)
-		{
-			SearchFilter->SetRawFilterText(NewText);
-			SearchBox->SetError(SearchFilter->GetFilterErrorText());
-			ApplyFilter();
-		});
+		.OnTextChanged(this, &SGASAttributesTab::SetSearchText);
+}
+
+void SGASAttributesTab::SetSearchText(const FText& InSearchText)
+{
+	if (!SearchBox->GetText().EqualTo(InSearchText))
+	{
+		SearchBox->SetText(InSearchText);
+	}
+
+	SearchFilter->SetRawFilterText(InSearchText);
+	SearchBox->SetError(SearchFilter->GetFilterErrorText());
+	ApplyFilter();
 }
 
 TSharedRef<SWidget> SGASAttributesTab::CreateCollectionsComboButton()
@@ -382,6 +546,7 @@ void SGASAttributesTab::LoadSettings()
 
 	bHideZero = FGASAttachEditorSettings::LoadBool(HideZeroKey, false);
 	bOnlyModified = FGASAttachEditorSettings::LoadBool(OnlyModifiedKey, false);
+	bRecordChanges = FGASAttachEditorSettings::LoadBool(RecordChangesKey, false);
 
 	NameSortMode = FGASAttachEditorSettings::LoadSortMode(NameSortKey);
 	ValueSortMode = FGASAttachEditorSettings::LoadSortMode(ValueSortKey);
@@ -394,6 +559,7 @@ void SGASAttributesTab::SaveSettings() const
 
 	FGASAttachEditorSettings::SaveBool(HideZeroKey, bHideZero);
 	FGASAttachEditorSettings::SaveBool(OnlyModifiedKey, bOnlyModified);
+	FGASAttachEditorSettings::SaveBool(RecordChangesKey, bRecordChanges);
 
 	FGASAttachEditorSettings::SaveSortMode(NameSortKey, NameSortMode);
 	FGASAttachEditorSettings::SaveSortMode(ValueSortKey, ValueSortMode);
@@ -456,12 +622,136 @@ TSharedRef<SCheckBox> SGASAttributesTab::CreateOnlyModifiedCheckBox()
 		];
 }
 
+TSharedRef<SCheckBox> SGASAttributesTab::CreateRecordChangesCheckBox()
+{
+	return
+		SNew(SCheckBox)
+		.Padding(FMargin(4.f, 0.f))
+		.ToolTipText(LOCTEXT("RecordChangesToolTip", "Record every change of the inspected component's attributes together with the effect that caused it. Select an attribute to browse its history."))
+		.IsChecked_Lambda([this]
+		{
+			return bRecordChanges ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		})
+		.OnCheckStateChanged_Lambda([this](const ECheckBoxState NewValue)
+		{
+			bRecordChanges = NewValue == ECheckBoxState::Checked;
+			SaveSettings();
+
+			if (!bRecordChanges)
+			{
+				ChangeRecorder->Unbind();
+				RefreshChanges();
+			}
+		})
+		[
+			SNew(SBox)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("RecordChanges", "Record Changes"))
+			]
+		];
+}
+
+TSharedRef<SWidget> SGASAttributesTab::CreateChangesPanel()
+{
+	return
+		SNew(SBorder)
+		.Padding(0.f)
+		.Visibility_Lambda([this]
+		{
+			return bRecordChanges ? EVisibility::Visible : EVisibility::Collapsed;
+		})
+		[
+			SAssignNew(ChangesList, SAttributeChangesList)
+			.ListItemsSource(&ChangesListItems)
+			.SelectionMode(ESelectionMode::None)
+			.OnGenerateRow_Lambda([](TSharedPtr<FGASAttributeChangeRecord> Item, const TSharedRef<STableViewBase>& OwnerTable)
+			{
+				return
+					SNew(SGASAttributeChangeItem, OwnerTable)
+					.Record(Item);
+			})
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+
+				+ SHeaderRow::Column(ChangeFrameColumn)
+				.DefaultLabel(LOCTEXT("ChangeFrameColumn", "Frame"))
+				.FillWidth(.1f)
+
+				+ SHeaderRow::Column(ChangeTimeColumn)
+				.DefaultLabel(LOCTEXT("ChangeTimeColumn", "Time"))
+				.DefaultTooltip(LOCTEXT("ChangeTimeColumnToolTip", "World time of the inspected component's world"))
+				.FillWidth(.1f)
+
+				+ SHeaderRow::Column(ChangeValueColumn)
+				.DefaultLabel(LOCTEXT("ChangeValueColumn", "Value"))
+				.FillWidth(.2f)
+
+				+ SHeaderRow::Column(ChangeMagnitudeColumn)
+				.DefaultLabel(LOCTEXT("ChangeMagnitudeColumn", "Magnitude"))
+				.DefaultTooltip(LOCTEXT("ChangeMagnitudeColumnToolTip", "Evaluated modifier magnitude for executed effects, otherwise the value delta"))
+				.FillWidth(.15f)
+
+				+ SHeaderRow::Column(ChangeSourceColumn)
+				.DefaultLabel(LOCTEXT("ChangeSourceColumn", "Source"))
+				.DefaultTooltip(LOCTEXT("ChangeSourceColumnToolTip", "Effect responsible for the change. Changes caused by duration effects carry no spec, so their source is inferred from the newest active effect modifying the attribute."))
+				.FillWidth(.45f)
+			)
+		];
+}
+
+void SGASAttributesTab::RefreshChanges()
+{
+	const TSharedPtr<FGASAttributeNode> Attribute = SelectedAttribute.Pin();
+
+	const FGASAttributeChangeLog* Log = nullptr;
+	if (bRecordChanges &&
+		Attribute &&
+		!Attribute->IsCollection())
+	{
+		Log = ChangeRecorder->FindLog(Attribute->GetAttribute());
+	}
+
+	if (!Log)
+	{
+		if (ChangesListItems.Num() > 0)
+		{
+			ChangesListItems.Reset();
+			ChangesList->RequestListRefresh();
+		}
+
+		NumChangesShown = 0;
+		return;
+	}
+
+	if (Log->GetNumWritten() == NumChangesShown)
+	{
+		return;
+	}
+
+	TArray<FGASAttributeChangeRecord> Records;
+	NumChangesShown = Log->Read(Records);
+
+	// Newest first
+	ChangesListItems.Reset(Records.Num());
+	for (int32 Index = Records.Num() - 1; Index >= 0; --Index)
+	{
+		ChangesListItems.Add(MakeShared<FGASAttributeChangeRecord>(Records[Index]));
+	}
+
+	ChangesList->RequestListRefresh();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 void SGASAttributesTab::SortAttributes()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Sort, RefreshCost);
+
 	const auto SortNodes = [](TArray<TSharedPtr<FGASAttributeNode>>& Nodes, const EColumnSortMode::Type SortMode, auto&& Projection)
 	{
 		if (SortMode == EColumnSortMode::None)
@@ -528,6 +818,15 @@ bool SGASAttributesTab::IsFilterActive() const
 		!SearchFilter->GetRawFilterText().IsEmpty();
 }
 
+bool SGASAttributesTab::ShouldUpdateEveryRow() const
+{
+	// Sorting and filtering by value need every value, not only those on screen
+	return
+		IsFilterActive() ||
+		ValueSortMode != EColumnSortMode::None ||
+		BaseValueSortMode != EColumnSortMode::None;
+}
+
 bool SGASAttributesTab::MatchesText(const FGASAttributeNode& Node) const
 {
 	return SearchFilter->PassesFilter(Node);
@@ -574,6 +873,8 @@ bool SGASAttributesTab::HasVisibleAttributes(const FGASAttributeNode& Collection
 
 void SGASAttributesTab::ApplyFilter()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Filter, RefreshCost);
+
 	FilteredAttributesList.Reset();
 
 	const bool bFilterActive = IsFilterActive();
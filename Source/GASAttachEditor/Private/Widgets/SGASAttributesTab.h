@@ -3,8 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GASAttachEditorNodePool.h"
+#include "GASAttachEditorStats.h"
+#include "GASAttachEditorRefreshScheduler.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Misc/TextFilter.h"
+#include "Widgets/Views/SListView.h"
 #include "Widgets/Views/STreeView.h"
 #include "Widgets/Views/SHeaderRow.h"
 
@@ -12,8 +16,14 @@ class SCheckBox;
 class SSearchBox;
 class FGASAttributeNode;
 class UAbilitySystemComponent;
+class FGASAttributeChangeRecorder;
+struct FGASAttributeChangeRecord;
+struct FGASWorldSnapshot;
+struct FGASComponentSnapshot;
+struct FGASComponentDiff;
 
 using SAttributesTree = STreeView<TSharedPtr<FGASAttributeNode>>;
+using SAttributeChangesList = SListView<TSharedPtr<FGASAttributeChangeRecord>>;
 using FGASAttributeTextFilter = TTextFilter<const FGASAttributeNode&>;
 
 class SGASAttributesTab : public SCompoundWidget
@@ -29,10 +39,21 @@ public:
 
 	void Refresh(UAbilitySystemComponent* Component);
 
+	/** Shows a component of another process, as of its latest snapshot; changes are not recorded for those. Rows in Diff are tinted */
+	void Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff = nullptr);
+
+	/** Same as typing into the search box */
+	void SetSearchText(const FText& InSearchText);
+
+	const FGASCostCounter& GetRefreshCost() const { return RefreshCost; }
+	const FGASNodePool& GetNodePool() const { return NodePool; }
+
 private:
 	TSharedRef<SWidget> CreateSearchBox();
 	TSharedRef<SCheckBox> CreateHideZeroCheckBox();
 	TSharedRef<SCheckBox> CreateOnlyModifiedCheckBox();
+	TSharedRef<SCheckBox> CreateRecordChangesCheckBox();
+	TSharedRef<SWidget> CreateChangesPanel();
 	TSharedRef<SWidget> CreateCollectionsComboButton();
 	TSharedRef<SWidget> BuildCollectionsMenu();
 
@@ -50,17 +71,24 @@ private:
 	static const TCHAR* HiddenColumnsKey;
 	static const TCHAR* HideZeroKey;
 	static const TCHAR* OnlyModifiedKey;
+	static const TCHAR* RecordChangesKey;
 	static const TCHAR* NameSortKey;
 	static const TCHAR* ValueSortKey;
 	static const TCHAR* BaseValueSortKey;
 
 	void SortAttributes();
 
+	void RefreshChanges();
+
+	/** Live and snapshot rows are keyed differently, so switching between them starts over */
+	void SetShowingSnapshot(bool bInShowingSnapshot);
+
 private:
 	void PopulateSearchStrings(const FGASAttributeNode& Node, TArray<FString>& OutSearchStrings) const;
 	FText GetHighlightText() const;
 
 	bool IsFilterActive() const;
+	bool ShouldUpdateEveryRow() const;
 	bool MatchesText(const FGASAttributeNode& Node) const;
 	bool PassesValueFilters(const FGASAttributeNode& Node) const;
 	bool IsAttributeVisible(const FGASAttributeNode& Node, bool bCollectionMatchesText) const;
@@ -80,6 +108,7 @@ private:
 
 	bool bHideZero = false;
 	bool bOnlyModified = false;
+	bool bRecordChanges = false;
 
 	TSet<FName> HiddenCollections;
 	TMap<FName, FText> KnownCollections;
@@ -89,9 +118,26 @@ private:
 	TArray<TSharedPtr<FGASAttributeNode>> FilteredAttributesList;
 	TMap<FName, TSharedPtr<FGASAttributeNode>> MappedAttributes;
 	TMap<FName, TSharedPtr<FGASAttributeNode>> MappedCollections;
+	FGASNodePool NodePool { TEXT("Attributes") };
+	FGASCostCounter RefreshCost;
+	FGASRowUpdateWindow RowWindow;
+	bool bShowingSnapshot = false;
+
+private:
+	TSharedPtr<FGASAttributeChangeRecorder> ChangeRecorder;
+	TSharedPtr<SAttributeChangesList> ChangesList;
+	TArray<TSharedPtr<FGASAttributeChangeRecord>> ChangesListItems;
+	TWeakPtr<FGASAttributeNode> SelectedAttribute;
+	uint64 NumChangesShown = 0;
 
 public:
 	static const FName AttributeNameColumn;
 	static const FName AttributeValueColumn;
 	static const FName AttributeBaseValueColumn;
+
+	static const FName ChangeFrameColumn;
+	static const FName ChangeTimeColumn;
+	static const FName ChangeValueColumn;
+	static const FName ChangeMagnitudeColumn;
+	static const FName ChangeSourceColumn;
 };
\ No newline at end of file
@@ -0,0 +1,645 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASCaptureViewer.h"
+
+#include "SGASAbilitiesTab.h"
+#include "SGASAttributesTab.h"
+#include "SGASGameplayTagsTab.h"
+#include "SGASGameplayEffectsTab.h"
+
+#include "DesktopPlatformModule.h"
+#include "GameplayTagsManager.h"
+#include "Misc/Paths.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSlider.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSegmentedControl.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+void SGASCaptureViewer::Construct(const FArguments& InArgs)
+{
+	bRegisterCaptureTags = InArgs._RegisterCaptureTags;
+
+	CaptureTitle = LOCTEXT("NoCapture", "No capture open");
+	SelectedComponentTitle = LOCTEXT("None", "None");
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.Padding(2.f, 2.f)
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("OpenCapture", "Open..."))
+				.ToolTipText(LOCTEXT("OpenCaptureToolTip", "Open a capture written by GASAttachEditor.Capture.Record or GASAttachEditor.Capture.Snapshot"))
+				.OnClicked(this, &SGASCaptureViewer::HandleOpenClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(10.f, 0.f, 0.f, 0.f)
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]
+				{
+					return CaptureTitle;
+				})
+				.ToolTipText_Lambda([this]
+				{
+					return FText::FromString(Capture.GetFilename());
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(20.f, 0.f, 0.f, 0.f)
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("Actor", "Actor: "))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SBox)
+				.MinDesiredWidth(125.f)
+				[
+					SNew(SComboButton)
+					.OnGetMenuContent(this, &SGASCaptureViewer::OnGetActorsList)
+					.VAlign(VAlign_Center)
+					.ContentPadding(2.f)
+					.IsEnabled_Lambda([this]
+					{
+						return IsLoaded();
+					})
+					.ButtonContent()
+					[
+						SNew(STextBlock)
+						.ToolTipText(LOCTEXT("ActorSelectionToolTip", "Actor selection"))
+						.Text_Lambda([this]
+						{
+							return SelectedComponentTitle;
+						})
+					]
+				]
+			]
+		]
+		+ SVerticalBox::Slot()
+		.Padding(2.f, 6.f)
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			.IsEnabled_Lambda([this]
+			{
+				return Capture.GetNumFrames() > 1;
+			})
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SSlider)
+				.ToolTipText(LOCTEXT("FrameSliderToolTip", "Frame of the capture to show"))
+				.Value_Lambda([this]
+				{
+					return Capture.GetNumFrames() > 1 ? static_cast<float>(CurrentFrame) / (Capture.GetNumFrames() - 1) : 0.f;
+				})
+				.StepSize_Lambda([this]
+				{
+					return Capture.GetNumFrames() > 1 ? 1.f / (Capture.GetNumFrames() - 1) : 1.f;
+				})
+				.OnValueChanged_Lambda([this](const float Value)
+				{
+					SetFrame(FMath::RoundToInt(Value * (Capture.GetNumFrames() - 1)));
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(10.f, 0.f, 0.f, 0.f)
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SBox)
+				.MinDesiredWidth(200.f)
+				[
+					SNew(STextBlock)
+					.Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+					.Text(this, &SGASCaptureViewer::GetFrameText)
+				]
+			]
+		]
+		+ SVerticalBox::Slot()
+		.Padding(2.f, 2.f)
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			.IsEnabled_Lambda([this]
+			{
+				return IsLoaded();
+			})
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("CompareWithFrame", "Compare with This Frame"))
+				.ToolTipText(LOCTEXT("CompareWithFrameToolTip", "Keep this frame as the base, and tint what other frames added, removed or changed since"))
+				.OnClicked_Lambda([this]
+				{
+					CompareWithFrame();
+					return FReply::Handled();
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("CompareWithCapture", "Compare with Capture..."))
+				.ToolTipText(LOCTEXT("CompareWithCaptureToolTip", "Use the last frame of another capture as the base, e.g. a snapshot from before a change"))
+				.OnClicked(this, &SGASCaptureViewer::HandleCompareWithCaptureClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("StopComparing", "Stop Comparing"))
+				.IsEnabled_Lambda([this]
+				{
+					return bHasDiffBase;
+				})
+				.OnClicked_Lambda([this]
+				{
+					StopComparing();
+					return FReply::Handled();
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(10.f, 0.f, 0.f, 0.f)
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]
+				{
+					return DiffStatus;
+				})
+				.ToolTipText(LOCTEXT("DiffStatusToolTip", "Added rows are green, removed ones red and changed ones yellow. GASAttachEditor.Capture.Diff writes the same as a report."))
+			]
+		]
+		+ SVerticalBox::Slot()
+		.Padding(2.f, 2.f)
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			.IsEnabled_Lambda([this]
+			{
+				return IsLoaded();
+			})
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SNew(SEditableTextBox)
+				.HintText(LOCTEXT("QueryHint", "Find frames, e.g. Health < 10 and State.Stunned"))
+				.ToolTipText(LOCTEXT("QueryToolTip", "Attributes compare to numbers with < <= > >= == !=, a bare name is an owned tag, \"effect X\" and \"ability X\" test for an effect or a running ability. Combine with and, or, not and parentheses."))
+				.OnTextCommitted_Lambda([this](const FText& Text, ETextCommit::Type CommitType)
+				{
+					if (CommitType == ETextCommit::OnEnter)
+					{
+						RunQuery(Text.ToString());
+					}
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.Padding(10.f, 0.f, 0.f, 0.f)
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]
+				{
+					return QueryStatus;
+				})
+			]
+		]
+		+ SVerticalBox::Slot()
+		.Padding(2.f, 2.f)
+		.AutoHeight()
+		[
+			SNew(SBox)
+			.MaxDesiredHeight(150.f)
+			.Visibility_Lambda([this]
+			{
+				return QueryMatches.Num() > 0 ? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			[
+				SAssignNew(QueryMatchesList, SListView<TSharedPtr<FGASCaptureQuery::FMatch>>)
+				.ListItemsSource(&QueryMatches)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SGASCaptureViewer::OnGenerateMatchRow)
+				.OnMouseButtonClick_Lambda([this](const TSharedPtr<FGASCaptureQuery::FMatch> Match)
+				{
+					if (Match)
+					{
+						JumpToMatch(*Match);
+					}
+				})
+			]
+		]
+		+ SVerticalBox::Slot()
+		.Padding(2.f, 2.f)
+		.AutoHeight()
+		.HAlign(HAlign_Left)
+		[
+			SNew(SSegmentedControl<int32>)
+			.Value_Lambda([this]
+			{
+				return ActiveTab;
+			})
+			.OnValueChanged_Lambda([this](const int32 InActiveTab)
+			{
+				ActiveTab = InActiveTab;
+				TabSwitcher->SetActiveWidgetIndex(ActiveTab);
+			})
+			+ SSegmentedControl<int32>::Slot(0)
+			.Text(LOCTEXT("AbilitiesTabName", "Abilities"))
+			+ SSegmentedControl<int32>::Slot(1)
+			.Text(LOCTEXT("AttributesTabName", "Attributes"))
+			+ SSegmentedControl<int32>::Slot(2)
+			.Text(LOCTEXT("GameplayEffectsTabName", "Gameplay Effects"))
+			+ SSegmentedControl<int32>::Slot(3)
+			.Text(LOCTEXT("GameplayTagsTabName", "Gameplay Tags"))
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SBorder)
+			.BorderImage(FCoreStyle::Get().GetBrush("ToolPanel.GroupBorder"))
+			.BorderBackgroundColor(FLinearColor::Gray)
+			.Padding(0.f, 4.f, 0.f, 0.f)
+			[
+				SAssignNew(TabSwitcher, SWidgetSwitcher)
+				+ SWidgetSwitcher::Slot()
+				[
+					SAssignNew(AbilitiesTab, SGASAbilitiesTab)
+				]
+				+ SWidgetSwitcher::Slot()
+				[
+					SAssignNew(AttributesTab, SGASAttributesTab)
+				]
+				+ SWidgetSwitcher::Slot()
+				[
+					SAssignNew(GameplayEffectsTab, SGASGameplayEffectsTab)
+				]
+				+ SWidgetSwitcher::Slot()
+				[
+					SAssignNew(GameplayTagsTab, SGASGameplayTagsTab)
+				]
+			]
+		]
+	];
+
+	if (!InArgs._Filename.IsEmpty())
+	{
+		Open(InArgs._Filename);
+	}
+}
+
+void SGASCaptureViewer::Open(const FString& Filename)
+{
+	FText Error;
+	if (!Capture.Load(Filename, Error))
+	{
+		CaptureTitle = Error;
+		SelectedComponentId = 0;
+		SelectedComponentTitle = LOCTEXT("None", "None");
+		Refresh();
+		return;
+	}
+
+	CaptureTitle = FText::FromString(FPaths::GetCleanFilename(Filename));
+
+	CaptureColumns = FGASCaptureColumns();
+	QueryMatches.Reset();
+	QueryStatus = FText::GetEmpty();
+	QueryMatchesList->RequestListRefresh();
+
+	if (bRegisterCaptureTags)
+	{
+		RegisterCaptureTags();
+	}
+
+	// Same actor again if the new capture has it, so that reopening a capture that grew stays on it
+	CurrentFrame = 0;
+	const FGASWorldSnapshot* Frame = Capture.GetFrame(CurrentFrame);
+	if (!Frame ||
+		!Frame->FindComponent(SelectedComponentId))
+	{
+		SelectedComponentId = 0;
+		SelectedComponentTitle = LOCTEXT("None", "None");
+	}
+
+	Refresh();
+}
+
+FReply SGASCaptureViewer::HandleOpenClicked()
+{
+	FString Filename;
+	if (PickCaptureFile(LOCTEXT("OpenCaptureTitle", "Open Ability System Capture"), Filename))
+	{
+		Open(Filename);
+	}
+
+	return FReply::Handled();
+}
+
+bool SGASCaptureViewer::PickCaptureFile(const FText& Title, FString& OutFilename)
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform)
+	{
+		return false;
+	}
+
+	const FString FileTypes = FString::Printf(TEXT("Ability System Capture (*%s)|*%s"), FGASCaptureWriter::Extension, FGASCaptureWriter::Extension);
+	const FString DefaultPath = Capture.GetFilename().IsEmpty()
+		? FPaths::ProjectSavedDir() / TEXT("GASAttachEditor")
+		: FPaths::GetPath(Capture.GetFilename());
+
+	TArray<FString> Filenames;
+	if (!DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		Title.ToString(),
+		DefaultPath,
+		FString(),
+		FileTypes,
+		EFileDialogFlags::None,
+		Filenames) ||
+		Filenames.Num() == 0)
+	{
+		return false;
+	}
+
+	OutFilename = Filenames[0];
+	return true;
+}
+
+TSharedRef<SWidget> SGASCaptureViewer::OnGetActorsList()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	// Actors of the frame on screen; one that comes and goes is picked where it exists
+	TArray<const FGASComponentSnapshot*> Components;
+	for (const FGASComponentSnapshot& Component : DisplayedFrame.Components)
+	{
+		Components.Add(&Component);
+	}
+
+	Components.Sort([](const FGASComponentSnapshot& A, const FGASComponentSnapshot& B)
+	{
+		return A.OwnerName.LexicalLess(B.OwnerName);
+	});
+
+	for (const FGASComponentSnapshot* Component : Components)
+	{
+		MenuBuilder.AddMenuEntry(
+			FText::FromName(Component->OwnerName),
+			FText::FromName(Component->OwnerClass),
+			{},
+			FUIAction(FExecuteAction::CreateSP(this, &SGASCaptureViewer::OnChangeComponent, Component->Id)));
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SGASCaptureViewer::OnChangeComponent(const uint32 ComponentId)
+{
+	const FGASComponentSnapshot* Component = DisplayedFrame.FindComponent(ComponentId);
+	if (!Component)
+	{
+		return;
+	}
+
+	SelectedComponentId = ComponentId;
+	SelectedComponentTitle = FText::FromName(Component->OwnerName);
+
+	Refresh();
+}
+
+void SGASCaptureViewer::SetFrame(const int32 FrameIndex)
+{
+	const int32 NewFrame = FMath::Clamp(FrameIndex, 0, FMath::Max(Capture.GetNumFrames() - 1, 0));
+	if (NewFrame == CurrentFrame)
+	{
+		return;
+	}
+
+	CurrentFrame = NewFrame;
+	Refresh();
+}
+
+void SGASCaptureViewer::Refresh()
+{
+	const FGASWorldSnapshot* Frame = IsLoaded() ? Capture.GetFrame(CurrentFrame) : nullptr;
+	if (Frame)
+	{
+		DisplayedFrame = *Frame;
+	}
+	else
+	{
+		DisplayedFrame = FGASWorldSnapshot();
+	}
+	bFrameDamaged = IsLoaded() && !Frame;
+
+	// A capture is looked at, not played - timers stand still at the frame's world time
+	DisplayedFrame.TimeDilation = 0.f;
+	DisplayedFrame.LocalTime = FPlatformTime::Seconds();
+
+	const FGASComponentSnapshot* Component = DisplayedFrame.FindComponent(SelectedComponentId);
+	const FGASComponentDiff* Diff = nullptr;
+
+	if (bHasDiffBase &&
+		IsLoaded())
+	{
+		FGASSnapshotDiff::Compare(DiffBase, DisplayedFrame, WorldDiff);
+		DiffStatus = FText::Format(
+			LOCTEXT("DiffStatusFormat", "{0} {0}|plural(one=actor differs,other=actors differ) from {1}"),
+			FText::AsNumber(WorldDiff.Components.Num()),
+			DiffBaseTitle);
+
+		if (Component)
+		{
+			const FGASComponentSnapshot* BaseComponent = FGASSnapshotDiff::FindMatchingComponent(DiffBase, DisplayedFrame, *Component);
+			FGASComponentDiff::Compare(BaseComponent, Component, ComponentDiff);
+			FGASComponentDiff::Merge(BaseComponent, Component, MergedComponent);
+
+			Component = &MergedComponent;
+			Diff = &ComponentDiff;
+		}
+	}
+
+	AbilitiesTab->Refresh(DisplayedFrame, Component, Diff);
+	AttributesTab->Refresh(DisplayedFrame, Component, Diff);
+	GameplayEffectsTab->Refresh(DisplayedFrame, Component, Diff);
+	GameplayTagsTab->Refresh(DisplayedFrame, Component, Diff);
+}
+
+void SGASCaptureViewer::CompareWithFrame()
+{
+	const FGASWorldSnapshot* Frame = IsLoaded() ? Capture.GetFrame(CurrentFrame) : nullptr;
+	if (!Frame)
+	{
+		return;
+	}
+
+	DiffBase = *Frame;
+	DiffBaseTitle = FText::Format(LOCTEXT("DiffBaseFrameFormat", "frame {0}"), FText::AsNumber(CurrentFrame + 1));
+	bHasDiffBase = true;
+
+	Refresh();
+}
+
+FReply SGASCaptureViewer::HandleCompareWithCaptureClicked()
+{
+	FString Filename;
+	if (!PickCaptureFile(LOCTEXT("CompareWithCaptureTitle", "Compare with Ability System Capture"), Filename))
+	{
+		return FReply::Handled();
+	}
+
+	FText Error;
+	if (!FGASSnapshotDiff::LoadCapturePoint(Filename, DiffBase, Error))
+	{
+		StopComparing();
+		DiffStatus = Error;
+		return FReply::Handled();
+	}
+
+	DiffBaseTitle = FText::FromString(FPaths::GetCleanFilename(Filename));
+	bHasDiffBase = true;
+
+	Refresh();
+	return FReply::Handled();
+}
+
+void SGASCaptureViewer::StopComparing()
+{
+	bHasDiffBase = false;
+	DiffBase = FGASWorldSnapshot();
+	DiffStatus = FText::GetEmpty();
+	WorldDiff.Components.Reset();
+
+	Refresh();
+}
+
+void SGASCaptureViewer::RunQuery(const FString& Text)
+{
+	QueryMatches.Reset();
+	QueryMatchesList->RequestListRefresh();
+
+	FText Error;
+	if (!Query.Parse(Text, Error))
+	{
+		QueryStatus = Error;
+		return;
+	}
+
+	TArray<FGASCaptureQuery::FMatch> Matches;
+	if (Capture.GetTagIndex() &&
+		Query.UsesOnlyTags())
+	{
+		// Tags alone are answered from the index, without decoding a frame
+		Query.Run(*Capture.GetTagIndex(), Matches);
+	}
+	else
+	{
+		if (!CaptureColumns.IsBuilt() ||
+			CaptureColumns.GetNumFrames() != Capture.GetNumFrames())
+		{
+			CaptureColumns.Build(Capture);
+
+			// Building decodes every frame; the one on screen is decoded again from its keyframe
+			Refresh();
+		}
+
+		Query.Run(CaptureColumns, Matches);
+	}
+
+	for (const FGASCaptureQuery::FMatch& Match : Matches)
+	{
+		QueryMatches.Add(MakeShared<FGASCaptureQuery::FMatch>(Match));
+	}
+	QueryMatchesList->RequestListRefresh();
+
+	QueryStatus = FText::Format(LOCTEXT("QueryMatchesFormat", "{0} {0}|plural(one=match,other=matches)"), FText::AsNumber(Matches.Num()));
+}
+
+void SGASCaptureViewer::JumpToMatch(const FGASCaptureQuery::FMatch& Match)
+{
+	SelectedComponentId = Match.ComponentId;
+	SelectedComponentTitle = FText::FromName(Match.OwnerName);
+	CurrentFrame = FMath::Clamp(Match.FirstFrame, 0, FMath::Max(Capture.GetNumFrames() - 1, 0));
+
+	Refresh();
+}
+
+TSharedRef<ITableRow> SGASCaptureViewer::OnGenerateMatchRow(TSharedPtr<FGASCaptureQuery::FMatch> Match, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	FNumberFormattingOptions TimeFormat;
+	TimeFormat.MinimumFractionalDigits = 2;
+	TimeFormat.MaximumFractionalDigits = 2;
+
+	return SNew(STableRow<TSharedPtr<FGASCaptureQuery::FMatch>>, OwnerTable)
+	[
+		SNew(STextBlock)
+		.Text(FText::Format(
+			LOCTEXT("QueryMatchFormat", "{0}  frames {1} - {2}  {3} - {4} s"),
+			FText::FromName(Match->OwnerName),
+			FText::AsNumber(Match->FirstFrame + 1),
+			FText::AsNumber(Match->LastFrame + 1),
+			FText::AsNumber(Capture.GetWorldTime(Match->FirstFrame), &TimeFormat),
+			FText::AsNumber(Capture.GetWorldTime(Match->LastFrame), &TimeFormat)))
+	];
+}
+
+void SGASCaptureViewer::RegisterCaptureTags() const
+{
+	// Outside of an engine's init nothing declares native tags done, so they can still be added this late
+	UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+	for (const FName TagName : Capture.GetTagNames())
+	{
+		if (!TagsManager.RequestGameplayTag(TagName, false).IsValid())
+		{
+			TagsManager.AddNativeGameplayTag(TagName);
+		}
+	}
+}
+
+FText SGASCaptureViewer::GetFrameText() const
+{
+	if (!IsLoaded())
+	{
+		return FText::GetEmpty();
+	}
+
+	FNumberFormattingOptions TimeFormat;
+	TimeFormat.MinimumFractionalDigits = 2;
+	TimeFormat.MaximumFractionalDigits = 2;
+
+	return FText::Format(
+		bFrameDamaged
+			? LOCTEXT("CaptureFrameDamagedFormat", "{0} / {1}  damaged")
+			: LOCTEXT("CaptureFrameFormat", "{0} / {1}  {2} s"),
+		FText::AsNumber(CurrentFrame + 1),
+		FText::AsNumber(Capture.GetNumFrames()),
+		FText::AsNumber(Capture.GetWorldTime(CurrentFrame), &TimeFormat));
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
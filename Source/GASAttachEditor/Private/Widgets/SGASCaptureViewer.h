@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "GASAttachCapture.h"
+#include "GASAttachCaptureQuery.h"
+#include "GASAttachSnapshotDiff.h"
+
+class SWidgetSwitcher;
+class SGASAbilitiesTab;
+class SGASAttributesTab;
+class SGASGameplayTagsTab;
+class SGASGameplayEffectsTab;
+
+/**
+ * Shows the frames of a capture file in the same tabs the live viewer uses, one actor at a time, and finds the
+ * frames in which a condition holds; see FGASCaptureQuery.
+ *
+ * Can compare the frame on screen with a base - another frame, or the last one of another capture - in which
+ * case the tabs tint what was added, removed or changed since; see FGASSnapshotDiff.
+ *
+ * Lives in the Ability System Capture Viewer tab of the editor, and is the whole window of the
+ * GASCaptureViewer program.
+ */
+class SGASCaptureViewer : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASCaptureViewer)
+		: _RegisterCaptureTags(false)
+	{}
+		SLATE_ARGUMENT(FString, Filename)
+		/** Add the tags a capture lists to this process' tags - for hosts that don't load the project's */
+		SLATE_ARGUMENT(bool, RegisterCaptureTags)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void Open(const FString& Filename);
+
+private:
+	FReply HandleOpenClicked();
+	bool PickCaptureFile(const FText& Title, FString& OutFilename);
+	TSharedRef<SWidget> OnGetActorsList();
+	void OnChangeComponent(uint32 ComponentId);
+	void SetFrame(int32 FrameIndex);
+	void Refresh();
+	void RegisterCaptureTags() const;
+
+	bool IsLoaded() const { return Capture.GetNumFrames() > 0; }
+	FText GetFrameText() const;
+
+	void RunQuery(const FString& Text);
+	void JumpToMatch(const FGASCaptureQuery::FMatch& Match);
+	TSharedRef<ITableRow> OnGenerateMatchRow(TSharedPtr<FGASCaptureQuery::FMatch> Match, const TSharedRef<STableViewBase>& OwnerTable);
+
+	void CompareWithFrame();
+	FReply HandleCompareWithCaptureClicked();
+	void StopComparing();
+
+private:
+	bool bRegisterCaptureTags = false;
+
+	FGASCapture Capture;
+	int32 CurrentFrame = 0;
+	FGASWorldSnapshot DisplayedFrame;
+	bool bFrameDamaged = false;
+
+	uint32 SelectedComponentId = 0;
+	FText CaptureTitle;
+	FText SelectedComponentTitle;
+
+	// Built on the first query of a capture
+	FGASCaptureColumns CaptureColumns;
+	FGASCaptureQuery Query;
+	TArray<TSharedPtr<FGASCaptureQuery::FMatch>> QueryMatches;
+	FText QueryStatus;
+
+	// What the frame on screen is compared with, if anything
+	bool bHasDiffBase = false;
+	FGASWorldSnapshot DiffBase;
+	FText DiffBaseTitle;
+	FText DiffStatus;
+	FGASSnapshotDiff WorldDiff;
+	FGASComponentDiff ComponentDiff;
+	// The selected component with what it lost since the base, so the tabs show removed rows too
+	FGASComponentSnapshot MergedComponent;
+
+private:
+	TSharedPtr<SListView<TSharedPtr<FGASCaptureQuery::FMatch>>> QueryMatchesList;
+
+	TSharedPtr<SWidgetSwitcher> TabSwitcher;
+	int32 ActiveTab = 0;
+
+	TSharedPtr<SGASAbilitiesTab> AbilitiesTab;
+	TSharedPtr<SGASAttributesTab> AttributesTab;
+	TSharedPtr<SGASGameplayEffectsTab> GameplayEffectsTab;
+	TSharedPtr<SGASGameplayTagsTab> GameplayTagsTab;
+};
\ No newline at end of file
@@ -6,13 +6,19 @@
 #include "SGASAttributesTab.h"
 #include "SGASGameplayTagsTab.h"
 #include "SGASGameplayEffectsTab.h"
+#include "SGASActorPicker.h"
+#include "SGASOverviewTab.h"
+#include "SGASWorldMatrixTab.h"
 #include "GASAttachEditorSettings.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachRuntime.h"
+#include "GASAttachFlightRecorder.h"
 
 #include "AbilitySystemGlobals.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/Pawn.h"
+#include "Widgets/SOverlay.h"
 #include "Widgets/Input/SButton.h"
-#include "UObject/UObjectIterator.h"
 #include "Widgets/Input/SCheckBox.h"
 #include "GameFramework/Controller.h"
 #include "Widgets/Docking/SDockTab.h"
@@ -30,13 +36,26 @@
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
 
+// GASAttachEditor.FlightRecorder.Scope 2 or 3 (the default) records whatever is selected here
+static void SetFlightRecorderSelection(const UAbilitySystemComponent* Component)
+{
+	const FGASAttachRuntimeModule* Module = FModuleManager::GetModulePtr<FGASAttachRuntimeModule>("GASAttachRuntime");
+	if (FGASFlightRecorder* FlightRecorder = Module ? Module->GetFlightRecorder() : nullptr)
+	{
+		FlightRecorder->SetSelectedComponent(Component);
+	}
+}
+
 const TCHAR* SGASEditorWidget::ContinuousUpdateKey = TEXT("ContinuousUpdate");
 const TCHAR* SGASEditorWidget::TrackSelectionKey = TEXT("TrackSelection");
+const TCHAR* SGASEditorWidget::ShowRefreshCostKey = TEXT("ShowRefreshCost");
 
 static const FName AbilitiesTabName = "SGASEditor.AbilitiesTab";
 static const FName AttributesTabName = "SGASEditor.AttributesTab";
 static const FName GameplayEffectsTabName = "SGASEditor.GameplayEffectsTab";
 static const FName GameplayTagsTabName = "SGASEditor.GameplayTagsTab";
+static const FName OverviewTabName = "SGASEditor.OverviewTab";
+static const FName WorldMatrixTabName = "SGASEditor.WorldMatrixTab";
 
 SGASEditorWidget::~SGASEditorWidget()
 {
@@ -51,6 +70,7 @@ SGASEditorWidget::~SGASEditorWidget()
 void SGASEditorWidget::Construct(const FArguments& InArgs)
 {
 	bContinuousUpdate = FGASAttachEditorSettings::LoadBool(ContinuousUpdateKey, false);
+	bShowRefreshCost = FGASAttachEditorSettings::LoadBool(ShowRefreshCostKey, false);
 #if WITH_EDITOR
 	bTrackSelection = FGASAttachEditorSettings::LoadBool(TrackSelectionKey, false);
 	SelectionChangedHandle = USelection::SelectionChangedEvent.AddSP(this, &SGASEditorWidget::HandleEditorSelectionChanged);
@@ -120,7 +140,7 @@ void SGASEditorWidget::Construct(const FArguments& InArgs)
 				SNew(SBox)
 				.MinDesiredWidth(125.f)
 				[
-					SNew(SComboButton)
+					SAssignNew(ActorComboButton, SComboButton)
 					.OnGetMenuContent(this, &SGASEditorWidget::OnGetActorsList)
 					.VAlign(VAlign_Center)
 					.ContentPadding(2.f)
@@ -128,7 +148,7 @@ void SGASEditorWidget::Construct(const FArguments& InArgs)
 					{
 						return
 							!bTrackSelection &&
-							!SelectedWorldContextHandle.IsNone();
+							(!SelectedWorldContextHandle.IsNone() || IsRemoteSelected());
 					})
 					.ButtonContent()
 					[
@@ -187,7 +207,7 @@ void SGASEditorWidget::Construct(const FArguments& InArgs)
 					[
 						SNew(STextBlock)
 						.Text(LOCTEXT("ContinuousUpdate", "Continuous Update"))
-						.ToolTipText(LOCTEXT("ContinuousUpdateToolTip", "Re-read the selected component continuously instead of only when Refresh is pressed"))
+						.ToolTipText(LOCTEXT("ContinuousUpdateToolTip", "Re-read the selected component continuously instead of only when Refresh is pressed. The rate adapts to the cost of a refresh and the editor frame time, see the GASAttachEditor.Refresh console variables."))
 					]
 				]
 			]
@@ -225,6 +245,32 @@ void SGASEditorWidget::Construct(const FArguments& InArgs)
 				]
 			]
 #endif
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(5.f, 0.f)
+			[
+				SNew(SCheckBox)
+				.Padding(FMargin(4.f, 0.f))
+				.IsChecked_Lambda([this]
+				{
+					return bShowRefreshCost ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+				})
+				.OnCheckStateChanged_Lambda([this](ECheckBoxState)
+				{
+					bShowRefreshCost = !bShowRefreshCost;
+					FGASAttachEditorSettings::SaveBool(ShowRefreshCostKey, bShowRefreshCost);
+				})
+				[
+					SNew(SBox)
+					.MinDesiredWidth(125.f)
+					.VAlign(VAlign_Center)
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("ShowRefreshCost", "Show Refresh Cost"))
+						.ToolTipText(LOCTEXT("ShowRefreshCostToolTip", "Overlay the game thread time this window spent on its last refresh, per tab. The same scopes are in 'stat GASAttachEditor' and the GASAttachEditor Insights channel."))
+					]
+				]
+			]
 		]
 		+ SVerticalBox::Slot()
 		.FillHeight(1.f)
@@ -238,7 +284,29 @@ void SGASEditorWidget::Construct(const FArguments& InArgs)
 				.Padding(0.f, 4.f, 0.f, 0.f)
 				.VAlign(VAlign_Fill)
 				[
-					TabManager->RestoreFrom(GetLayout(), nullptr).ToSharedRef()
+					SNew(SOverlay)
+					+ SOverlay::Slot()
+					[
+						TabManager->RestoreFrom(GetLayout(), nullptr).ToSharedRef()
+					]
+					+ SOverlay::Slot()
+					.HAlign(HAlign_Right)
+					.VAlign(VAlign_Bottom)
+					.Padding(8.f)
+					[
+						SNew(SBorder)
+						.BorderImage(FCoreStyle::Get().GetBrush("ToolPanel.GroupBorder"))
+						.Padding(FMargin(6.f, 2.f))
+						.Visibility_Lambda([this]
+						{
+							return bShowRefreshCost ? EVisibility::HitTestInvisible : EVisibility::Collapsed;
+						})
+						[
+							SNew(STextBlock)
+							.Font(FCoreStyle::GetDefaultFontStyle("Mono", 8))
+							.Text(this, &SGASEditorWidget::GetRefreshCostText)
+						]
+					]
 				]
 			]
 		]
@@ -249,23 +317,59 @@ void SGASEditorWidget::Tick(const FGeometry& AllottedGeometry, const double InCu
 {
 	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 
+	// Cheap - connecting is retried every couple of seconds, and receiving only applies what arrived
+	RemoteStreams.Tick();
+
 	// Both of these are expensive - ValidateSelections scans every UAbilitySystemComponent in memory,
-	// and a refresh re-gathers every row on every tab. Neither needs to happen at frame rate.
-	if (InCurrentTime - LastUpdateTime < UpdateInterval)
+	// and a refresh re-gathers every row on every tab. The scheduler keeps them within budget.
+	FGASRefreshScheduler::FFrame Frame;
+	Frame.CurrentTime = InCurrentTime;
+	Frame.DeltaTime = InDeltaTime;
+	Frame.bWorldPaused = IsSelectedWorldPaused();
+	Frame.bWatchingFastTab = IsWatchingFastTab();
+	RefreshScheduler.BeginFrame(Frame);
+
+	if (RefreshScheduler.ShouldValidate())
 	{
-		return;
+		const double StartTime = FPlatformTime::Seconds();
+		ValidateSelections();
+		RefreshScheduler.ReportValidateCost(FPlatformTime::Seconds() - StartTime);
 	}
 
-	LastUpdateTime = InCurrentTime;
-
-	ValidateSelections();
-
-	if (bContinuousUpdate)
+	if (bContinuousUpdate &&
+		RefreshScheduler.ShouldRefresh())
 	{
+		const double StartTime = FPlatformTime::Seconds();
 		Refresh();
+		RefreshScheduler.ReportRefreshCost(FPlatformTime::Seconds() - StartTime);
 	}
 }
 
+bool SGASEditorWidget::IsSelectedWorldPaused() const
+{
+	const FWorldContext* WorldContext = GEngine->GetWorldContextFromHandle(SelectedWorldContextHandle);
+	const UWorld* World = WorldContext ? WorldContext->World() : nullptr;
+
+	return
+		World &&
+		World->IsPaused();
+}
+
+bool SGASEditorWidget::IsWatchingFastTab() const
+{
+	// Attribute values move every frame; effect timers and cooldowns count down on their own while painting
+	return IsTabInFront(AttributesTabName);
+}
+
+bool SGASEditorWidget::IsTabInFront(const FName TabName) const
+{
+	const TSharedPtr<SDockTab> Tab = SpawnedTabs.FindRef(TabName).Pin();
+
+	return
+		Tab &&
+		Tab->IsForeground();
+}
+
 void SGASEditorWidget::CreateTabManager(const TSharedPtr<SDockTab>& ParentTab)
 {
 	TabManager = FGlobalTabmanager::Get()->NewTabManager(ParentTab.ToSharedRef());
@@ -297,6 +401,8 @@ void SGASEditorWidget::CreateTabManager(const TSharedPtr<SDockTab>& ParentTab)
 	RegisterTrackedTabSpawner(AttributesTabName, FOnSpawnTab::CreateSP(this, &SGASEditorWidget::SpawnAttributesTab)).SetDisplayName(LOCTEXT("AttributesTabName", "Attributes"));
 	RegisterTrackedTabSpawner(GameplayEffectsTabName, FOnSpawnTab::CreateSP(this, &SGASEditorWidget::SpawnGameplayEffectsTab)).SetDisplayName(LOCTEXT("GameplayEffectsTabName", "Gameplay Effects"));
 	RegisterTrackedTabSpawner(GameplayTagsTabName, FOnSpawnTab::CreateSP(this, &SGASEditorWidget::SpawnGameplayTagsTab)).SetDisplayName(LOCTEXT("GameplayTagsTabName", "Gameplay Tags"));
+	RegisterTrackedTabSpawner(OverviewTabName, FOnSpawnTab::CreateSP(this, &SGASEditorWidget::SpawnOverviewTab)).SetDisplayName(LOCTEXT("OverviewTabName", "Overview"));
+	RegisterTrackedTabSpawner(WorldMatrixTabName, FOnSpawnTab::CreateSP(this, &SGASEditorWidget::SpawnWorldMatrixTab)).SetDisplayName(LOCTEXT("WorldMatrixTabName", "Worlds"));
 }
 
 void SGASEditorWidget::OnTabSpawned(const FName& TabIdentifier, const TSharedRef<SDockTab>& SpawnedTab)
@@ -314,7 +420,7 @@ void SGASEditorWidget::OnTabSpawned(const FName& TabIdentifier, const TSharedRef
 
 TSharedRef<FTabManager::FLayout> SGASEditorWidget::GetLayout() const
 {
-	TSharedRef<FTabManager::FLayout> Layout = FTabManager::NewLayout("SGASEditor_Layout_V1_Dev")
+	TSharedRef<FTabManager::FLayout> Layout = FTabManager::NewLayout("SGASEditor_Layout_V3_Dev")
 	->AddArea(
 		FTabManager::NewPrimaryArea()
 		->SetOrientation(Orient_Vertical)
@@ -325,6 +431,8 @@ TSharedRef<FTabManager::FLayout> SGASEditorWidget::GetLayout() const
 			->AddTab(AttributesTabName, ETabState::OpenedTab)
 			->AddTab(GameplayEffectsTabName, ETabState::OpenedTab)
 			->AddTab(GameplayTagsTabName, ETabState::OpenedTab)
+			->AddTab(OverviewTabName, ETabState::OpenedTab)
+			->AddTab(WorldMatrixTabName, ETabState::OpenedTab)
 			->SetForegroundTab(AbilitiesTabName)
 		)
 	);
@@ -387,11 +495,41 @@ TSharedRef<SDockTab> SGASEditorWidget::SpawnGameplayTagsTab(const FSpawnTabArgs&
 		];
 }
 
+TSharedRef<SDockTab> SGASEditorWidget::SpawnOverviewTab(const FSpawnTabArgs& Args)
+{
+	return
+		SNew(SDockTab)
+		.Label(LOCTEXT("OverviewTabName", "Overview"))
+		.ShouldAutosize(false)
+		.CanEverClose(false)
+		[
+			SAssignNew(OverviewTab, SGASOverviewTab)
+			.Index(&ComponentIndex)
+			.OnComponentPicked_Lambda([this](const TWeakObjectPtr<UAbilitySystemComponent> WeakComponent)
+			{
+				OnChangeSelectedActor(WeakComponent);
+				TabManager->TryInvokeTab(AbilitiesTabName);
+			})
+		];
+}
+
+TSharedRef<SDockTab> SGASEditorWidget::SpawnWorldMatrixTab(const FSpawnTabArgs& Args)
+{
+	return
+		SNew(SDockTab)
+		.Label(LOCTEXT("WorldMatrixTabName", "Worlds"))
+		.ShouldAutosize(false)
+		.CanEverClose(false)
+		[
+			SAssignNew(WorldMatrixTab, SGASWorldMatrixTab)
+		];
+}
+
 void SGASEditorWidget::SelectLocallyControlledComponent()
 {
-	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent : AbilitySystemComponents)
+	for (const TSharedPtr<const FGASComponentIndexEntry>& Entry : ComponentIndex.GetEntries())
 	{
-		UAbilitySystemComponent* Component = WeakComponent.Get();
+		UAbilitySystemComponent* Component = Entry->Component.Get();
 		if (!Component)
 		{
 			continue;
@@ -549,6 +687,17 @@ void SGASEditorWidget::HandleEditorSelectionChanged(UObject* NewSelection)
 
 void SGASEditorWidget::ValidateSelections()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_ValidateSelections, ValidateSelectionsCost);
+
+	// Kept current here so that switching worlds finds the counterpart without scanning
+	WorldCorrelation.Update();
+
+	if (IsRemoteSelected())
+	{
+		ValidateRemoteSelection();
+		return;
+	}
+
 	if (SelectedWorldContextHandle.IsNone())
 	{
 		const TIndirectArray<FWorldContext>& Worlds = GEngine->GetWorldContexts();
@@ -584,7 +733,7 @@ void SGASEditorWidget::ValidateSelections()
 			}
 
 			if (!SelectedComponent.IsValid() ||
-				!AbilitySystemComponents.Contains(SelectedComponent))
+				!ComponentIndex.Contains(SelectedComponent.Get()))
 			{
 				SelectLocallyControlledComponent();
 			}
@@ -601,6 +750,7 @@ void SGASEditorWidget::ClearSelection()
 	bSelectionStopped = false;
 	SelectedComponent = nullptr;
 	SelectedComponentTitle = LOCTEXT("None", "None");
+	SetFlightRecorderSelection(nullptr);
 
 	AbilitiesTab->Refresh(nullptr);
 	AttributesTab->Refresh(nullptr);
@@ -610,6 +760,26 @@ void SGASEditorWidget::ClearSelection()
 
 void SGASEditorWidget::Refresh()
 {
+	if (IsRemoteSelected())
+	{
+		RefreshRemote();
+		return;
+	}
+
+	// The overview reads every component of the world, only worth it while someone looks at it
+	if (OverviewTab &&
+		IsTabInFront(OverviewTabName))
+	{
+		OverviewTab->Refresh();
+	}
+
+	// Same for the matrix, which reads the selected actor's counterpart in every world
+	if (WorldMatrixTab &&
+		IsTabInFront(WorldMatrixTabName))
+	{
+		WorldMatrixTab->Refresh(SelectedComponent.Get(), WorldCorrelation);
+	}
+
 	UAbilitySystemComponent* Component = SelectedComponent.Get();
 	if (!Component)
 	{
@@ -684,11 +854,34 @@ TSharedRef<SWidget> SGASEditorWidget::OnGetWorldTypes()
 	}
 	MenuBuilder.EndSection();
 
+	TArray<const FGASSnapshotStreamClient*> LiveStreams;
+	RemoteStreams.GetLiveStreams(LiveStreams);
+
+	MenuBuilder.BeginSection("Remote", LOCTEXT("SectionRemote", "Other Processes"));
+	{
+		for (const FGASSnapshotStreamClient* Stream : LiveStreams)
+		{
+			MenuBuilder.AddMenuEntry(
+				Stream->GetDisplayName(),
+				FText::Format(LOCTEXT("RemoteWorldToolTipFormat", "Streamed from port {0}"), FText::AsNumber(Stream->GetPort(), &FNumberFormattingOptions::DefaultNoGrouping())),
+				{},
+				FUIAction(FExecuteAction::CreateSP(this, &SGASEditorWidget::OnChangeRemoteWorld, Stream->GetPort())));
+		}
+	}
+	MenuBuilder.EndSection();
+
 	return MenuBuilder.MakeWidget();
 }
 
 void SGASEditorWidget::OnChangeWorldType(const FName WorldContextHandle)
 {
+	if (IsRemoteSelected())
+	{
+		SelectedRemotePort = INDEX_NONE;
+		SelectedRemoteComponentId = 0;
+		ClearSelection();
+	}
+
 	SelectedWorldContextHandle = WorldContextHandle;
 	SelectedWorldTitle = GetWorldInstanceName(WorldContextHandle);
 
@@ -720,54 +913,37 @@ void SGASEditorWidget::OnChangeWorldType(const FName WorldContextHandle)
 		return;
 	}
 
-	const AActor* CurrentOwner = CurrentComponent->GetOwnerActor();
-	if (!CurrentOwner)
-	{
-		OnChangeSelectedActor({});
-		return;
-	}
-
-	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent : AbilitySystemComponents)
+	UAbilitySystemComponent* Counterpart = WorldCorrelation.FindCounterpart(CurrentComponent, World);
+	if (!Counterpart)
 	{
-		UAbilitySystemComponent* Component = WeakComponent.Get();
-		if (!Component)
-		{
-			continue;
-		}
-
-		const AActor* Owner = Component->GetOwnerActor();
-		if (Owner &&
-			Owner->GetFName() == CurrentOwner->GetFName())
-		{
-			OnChangeSelectedActor(Component);
-			return;
-		}
+		// The counterpart may have been spawned, replicated or renamed since the last validation
+		WorldCorrelation.Update();
+		Counterpart = WorldCorrelation.FindCounterpart(CurrentComponent, World);
 	}
 
-	// We haven't found connected actors, reset to none
-	OnChangeSelectedActor({});
+	// Null if we haven't found connected actors, which resets to none
+	OnChangeSelectedActor(Counterpart);
 }
 
 TSharedRef<SWidget> SGASEditorWidget::OnGetActorsList()
 {
-	FMenuBuilder MenuBuilder(true, nullptr);
-
-	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent : AbilitySystemComponents)
+	if (IsRemoteSelected())
 	{
-		const UAbilitySystemComponent* Component = WeakComponent.Get();
-		if (!Component)
+		return OnGetRemoteActorsList();
+	}
+
+	TSharedRef<SGASActorPicker> Picker =
+		SNew(SGASActorPicker)
+		.Index(&ComponentIndex)
+		.OnComponentPicked_Lambda([this](const TWeakObjectPtr<UAbilitySystemComponent> WeakComponent)
 		{
-			continue;
-		}
+			ActorComboButton->SetIsOpen(false);
+			OnChangeSelectedActor(WeakComponent);
+		});
 
-		MenuBuilder.AddMenuEntry(
-			GetComponentName(Component),
-			FText(),
-			{},
-			FUIAction(FExecuteAction::CreateSP(this, &SGASEditorWidget::OnChangeSelectedActor, WeakComponent)));
-	}
+	ActorComboButton->SetMenuContentWidgetToFocus(Picker->GetWidgetToFocus());
 
-	return MenuBuilder.MakeWidget();
+	return Picker;
 }
 
 void SGASEditorWidget::OnChangeSelectedActor(TWeakObjectPtr<UAbilitySystemComponent> WeakComponent)
@@ -791,88 +967,167 @@ void SGASEditorWidget::OnChangeSelectedActor(TWeakObjectPtr<UAbilitySystemCompon
 
 	bSelectionStopped = false;
 	SelectedComponent = Component;
-	SelectedComponentTitle = GetComponentName(Component);
+	SelectedComponentTitle = FGASComponentIndex::GetComponentName(Component);
+	SetFlightRecorderSelection(Component);
 
 	Refresh();
 }
 
-void SGASEditorWidget::UpdateComponentsList(const UWorld* World)
+void SGASEditorWidget::OnChangeRemoteWorld(const int32 Port)
 {
-	AbilitySystemComponents.Reset();
-
-	for (UAbilitySystemComponent* Component : TObjectRange<UAbilitySystemComponent>())
+	const FGASSnapshotStreamClient* Stream = RemoteStreams.FindStream(Port);
+	if (!Stream)
 	{
-		if (!Component)
-		{
-			continue;
-		}
+		return;
+	}
 
-		if (Component->GetWorld() != World)
-		{
-			continue;
-		}
+	// Local components have nothing in common with the other process', not even their ids
+	SelectedWorldContextHandle = NAME_None;
+	ComponentIndex.Reset();
+	ClearSelection();
 
-		AbilitySystemComponents.Add(Component);
-	}
+	SelectedRemotePort = Port;
+	SelectedRemoteComponentId = 0;
+	SelectedWorldTitle = Stream->GetDisplayName();
 }
 
-FText SGASEditorWidget::GetComponentName(const UAbilitySystemComponent* Component) const
+void SGASEditorWidget::OnChangeRemoteComponent(const uint32 ComponentId)
 {
-	const auto GetLocalRoleText = [](const ENetRole Role) -> FText
+	const FGASSnapshotStreamClient* Stream = RemoteStreams.FindStream(SelectedRemotePort);
+	const FGASComponentSnapshot* Component = Stream ? Stream->GetSnapshot().FindComponent(ComponentId) : nullptr;
+	if (!Component)
 	{
-		switch (Role)
-		{
-		default: return FText::GetEmpty();
-		case ROLE_SimulatedProxy: return LOCTEXT("SimulatedProxy", "Simulated Proxy");
-		case ROLE_AutonomousProxy: return LOCTEXT("AutonomousProxy", "Autonomous Proxy");
-		case ROLE_Authority: return LOCTEXT("Authority", "Authority");
-		}
-	};
+		return;
+	}
+
+	bSelectionStopped = false;
+	SelectedRemoteComponentId = ComponentId;
+	SelectedComponentTitle = FText::FromName(Component->OwnerName);
+
+	Refresh();
+}
 
-	const AActor* Avatar = Component->GetAvatarActor_Direct();
-	const AActor* Owner = Component->GetOwnerActor();
-	if (!Avatar &&
-		!Owner)
+void SGASEditorWidget::ValidateRemoteSelection()
+{
+	// A process that went away takes its world along, like a PIE session ending
+	const FGASSnapshotStreamClient* Stream = RemoteStreams.FindStream(SelectedRemotePort);
+	if (!Stream ||
+		!Stream->IsConnected())
 	{
-		return LOCTEXT("None", "None");
+		OnChangeWorldType({});
+		OnChangeSelectedActor({});
+		return;
 	}
 
-	const AActor* Target = Avatar ? Avatar : Owner;
+	SelectedWorldTitle = Stream->GetDisplayName();
+
+	if (SelectedRemoteComponentId != 0 &&
+		!bSelectionStopped &&
+		!Stream->GetSnapshot().FindComponent(SelectedRemoteComponentId))
+	{
+		bSelectionStopped = true;
+		SelectedComponentTitle = FText::Format(LOCTEXT("ComponentStoppedFormat", "{0} (stopped)"), SelectedComponentTitle);
+	}
+}
 
-	const FText Name = FText::FromString(Target->GetActorNameOrLabel());
+void SGASEditorWidget::RefreshRemote()
+{
+	const FGASSnapshotStreamClient* Stream = RemoteStreams.FindStream(SelectedRemotePort);
+	if (!Stream ||
+		!Stream->HasSnapshot())
+	{
+		return;
+	}
 
-	// We don't want to show local roles for standalone worlds
-	if (Component->GetWorld()->GetNetMode() == NM_Standalone)
+	// A component that went away keeps its last rows, same as a local one
+	const FGASWorldSnapshot& World = Stream->GetSnapshot();
+	const FGASComponentSnapshot* Component = World.FindComponent(SelectedRemoteComponentId);
+	if (!Component)
 	{
-		return Name;
+		return;
 	}
 
-	const FText Role = GetLocalRoleText(Target->GetLocalRole());
-	return FText::Format(LOCTEXT("ComponentNameWithRoleFormat", "{0} [{1}]"), Name, Role);
+	AbilitiesTab->Refresh(World, Component);
+	AttributesTab->Refresh(World, Component);
+	GameplayEffectsTab->Refresh(World, Component);
+	GameplayTagsTab->Refresh(World, Component);
 }
 
-FText SGASEditorWidget::GetWorldInstanceName(const FName WorldContextHandle) const
+TSharedRef<SWidget> SGASEditorWidget::OnGetRemoteActorsList()
 {
-	const FWorldContext* WorldContext = GEngine->GetWorldContextFromHandle(WorldContextHandle);
-	if (!WorldContext)
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	const FGASSnapshotStreamClient* Stream = RemoteStreams.FindStream(SelectedRemotePort);
+	if (!Stream)
 	{
-		return LOCTEXT("None", "None");
+		return MenuBuilder.MakeWidget();
 	}
 
-	const UWorld* World = WorldContext->World();
-	if (!World)
+	TArray<const FGASComponentSnapshot*> Components;
+	for (const FGASComponentSnapshot& Component : Stream->GetSnapshot().Components)
 	{
-		return LOCTEXT("None", "None");
+		Components.Add(&Component);
 	}
 
-	switch (World->GetNetMode())
+	Components.Sort([](const FGASComponentSnapshot& A, const FGASComponentSnapshot& B)
+	{
+		return A.OwnerName.LexicalLess(B.OwnerName);
+	});
+
+	for (const FGASComponentSnapshot* Component : Components)
 	{
-	case NM_Standalone: return FText::Format(LOCTEXT("StandaloneFormat", "{0} [{1}]"), LOCTEXT("Standalone", "Standalone"), FText::AsNumber(WorldContext->PIEInstance));
-	case NM_DedicatedServer: return LOCTEXT("DedicatedServer", "Dedicated Server");
-	case NM_ListenServer: return LOCTEXT("ListenServer", "Listen Server");
-	case NM_Client: return FText::Format(LOCTEXT("ClientFormat", "{0} [{1}]"), LOCTEXT("Client", "Client"), FText::AsNumber(WorldContext->PIEInstance));
-	default: return LOCTEXT("None", "None");
+		MenuBuilder.AddMenuEntry(
+			FText::FromName(Component->OwnerName),
+			FText::FromName(Component->OwnerClass),
+			{},
+			FUIAction(FExecuteAction::CreateSP(this, &SGASEditorWidget::OnChangeRemoteComponent, Component->Id)));
 	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SGASEditorWidget::UpdateComponentsList(const UWorld* World)
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_UpdateComponentsList, UpdateComponentsListCost);
+
+	ComponentIndex.Update(World);
+}
+
+FText SGASEditorWidget::GetWorldInstanceName(const FName WorldContextHandle) const
+{
+	return FGASWorldCorrelation::GetWorldName(WorldContextHandle);
+}
+
+FText SGASEditorWidget::GetRefreshCostText() const
+{
+	const auto FormatCost = [](const FGASCostCounter& Cost) -> FText
+	{
+		static const FNumberFormattingOptions Options = FNumberFormattingOptions()
+			.SetMinimumFractionalDigits(2)
+			.SetMaximumFractionalDigits(2);
+
+		return FText::Format(LOCTEXT("RefreshCostFormat", "{0} ms"), FText::AsNumber(Cost.GetLastFrameSeconds() * 1000.0, &Options));
+	};
+
+	const auto FormatTabCost = [&FormatCost](const auto& Tab) -> FText
+	{
+		return Tab.IsValid() ? FormatCost(Tab->GetRefreshCost()) : LOCTEXT("None", "None");
+	};
+
+	static const FNumberFormattingOptions IntervalOptions = FNumberFormattingOptions()
+		.SetMaximumFractionalDigits(0);
+
+	return FText::Format(
+		LOCTEXT("RefreshCostOverlayFormat", "Refresh Interval  {0} ms\nValidate Selections  {1}\nComponents List  {2}\nAbilities  {3}\nAttributes  {4}\nGameplay Effects  {5}\nGameplay Tags  {6}\nOverview  {7}\nWorlds  {8}"),
+		FText::AsNumber(RefreshScheduler.GetRefreshInterval() * 1000.0, &IntervalOptions),
+		FormatCost(ValidateSelectionsCost),
+		FormatCost(UpdateComponentsListCost),
+		FormatTabCost(AbilitiesTab),
+		FormatTabCost(AttributesTab),
+		FormatTabCost(GameplayEffectsTab),
+		FormatTabCost(GameplayTagsTab),
+		FormatTabCost(OverviewTab),
+		FormatTabCost(WorldMatrixTab));
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
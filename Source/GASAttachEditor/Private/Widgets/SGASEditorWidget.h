@@ -5,11 +5,19 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Framework/Docking/TabManager.h"
+#include "GASAttachEditorStats.h"
+#include "GASAttachEditorRefreshScheduler.h"
+#include "GASAttachEditorComponentIndex.h"
+#include "GASAttachEditorWorldCorrelation.h"
+#include "GASAttachSnapshotStream.h"
 
+class SComboButton;
 class SGASAbilitiesTab;
 class SGASAttributesTab;
 class SGASGameplayTagsTab;
 class SGASGameplayEffectsTab;
+class SGASOverviewTab;
+class SGASWorldMatrixTab;
 class UAbilitySystemComponent;
 
 class SGASEditorWidget : public SCompoundWidget
@@ -37,9 +45,12 @@ private:
 	TSharedRef<SDockTab> SpawnAttributesTab(const FSpawnTabArgs& Args);
 	TSharedRef<SDockTab> SpawnGameplayEffectsTab(const FSpawnTabArgs& Args);
 	TSharedRef<SDockTab> SpawnGameplayTagsTab(const FSpawnTabArgs& Args);
+	TSharedRef<SDockTab> SpawnOverviewTab(const FSpawnTabArgs& Args);
+	TSharedRef<SDockTab> SpawnWorldMatrixTab(const FSpawnTabArgs& Args);
 
 	static const TCHAR* ContinuousUpdateKey;
 	static const TCHAR* TrackSelectionKey;
+	static const TCHAR* ShowRefreshCostKey;
 
 #if WITH_EDITOR
 	void HandleEditorSelectionChanged(UObject* NewSelection);
@@ -47,6 +58,10 @@ private:
 	static UAbilitySystemComponent* FindAbilitySystemComponentChecked(AActor* Actor);
 #endif
 
+	bool IsSelectedWorldPaused() const;
+	bool IsWatchingFastTab() const;
+	bool IsTabInFront(FName TabName) const;
+
 	void ValidateSelections();
 	void SelectLocallyControlledComponent();
 	void ClearSelection();
@@ -56,18 +71,28 @@ private:
 	void OnChangeWorldType(FName WorldContextHandle);
 	TSharedRef<SWidget> OnGetActorsList();
 	void OnChangeSelectedActor(TWeakObjectPtr<UAbilitySystemComponent> WeakComponent);
+
+	/** Worlds of other processes, streamed as snapshots; see FGASSnapshotStreamServer */
+	bool IsRemoteSelected() const { return SelectedRemotePort != INDEX_NONE; }
+	void OnChangeRemoteWorld(int32 Port);
+	void OnChangeRemoteComponent(uint32 ComponentId);
+	void ValidateRemoteSelection();
+	void RefreshRemote();
+	TSharedRef<SWidget> OnGetRemoteActorsList();
 	void UpdateComponentsList(const UWorld* World);
 
-	FText GetComponentName(const UAbilitySystemComponent* Component) const;
 	FText GetWorldInstanceName(FName WorldContextHandle) const;
+	FText GetRefreshCostText() const;
 
 private:
-	static constexpr double UpdateInterval = 0.1;
-
-	double LastUpdateTime = 0.0;
+	FGASRefreshScheduler RefreshScheduler;
 
 	bool bContinuousUpdate = false;
 	bool bTrackSelection = false;
+	bool bShowRefreshCost = false;
+
+	FGASCostCounter ValidateSelectionsCost;
+	FGASCostCounter UpdateComponentsListCost;
 
 #if WITH_EDITOR
 	FDelegateHandle SelectionChangedHandle;
@@ -76,16 +101,25 @@ private:
 
 	FName SelectedWorldContextHandle;
 	FText SelectedWorldTitle;
-	TArray<TWeakObjectPtr<UAbilitySystemComponent>> AbilitySystemComponents;
+	FGASComponentIndex ComponentIndex;
+	FGASWorldCorrelation WorldCorrelation;
 	TWeakObjectPtr<UAbilitySystemComponent> SelectedComponent;
 	FText SelectedComponentTitle;
 
+	FGASSnapshotStreamBrowser RemoteStreams;
+	int32 SelectedRemotePort = INDEX_NONE;
+	uint32 SelectedRemoteComponentId = 0;
+
 private:
 	TSharedPtr<FTabManager> TabManager;
 	TMap<FName, TWeakPtr<SDockTab>> SpawnedTabs;
 
+	TSharedPtr<SComboButton> ActorComboButton;
+
 	TSharedPtr<SGASAbilitiesTab> AbilitiesTab;
 	TSharedPtr<SGASAttributesTab> AttributesTab;
 	TSharedPtr<SGASGameplayEffectsTab> GameplayEffectsTab;
 	TSharedPtr<SGASGameplayTagsTab> GameplayTagsTab;
+	TSharedPtr<SGASOverviewTab> OverviewTab;
+	TSharedPtr<SGASWorldMatrixTab> WorldMatrixTab;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "SGASGameplayEffectItem.h"
+#include "GASAttachEditorDiff.h"
 #include "Styling/StyleColors.h"
 #include "AbilitySystemComponent.h"
 #include "Widgets/Input/SHyperlink.h"
@@ -14,14 +15,60 @@
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
 
-void FGASGameplayEffectNodeBase::Update()
+static FText FormatDuration(const float Duration, const float TimeRemaining, const float Period)
 {
+	FNumberFormattingOptions NumberFormatOptions;
+	NumberFormatOptions.MaximumFractionalDigits = 2;
+
+	FText Result = LOCTEXT("GameplayEffectInfiniteDuration", "Infinite Duration");
+
+	if (Duration > 0.f)
+	{
+		Result = FText::Format(
+			LOCTEXT("GameplayEffectDurationFormat", "Duration: {0}, Remaining: {1}"),
+			FText::AsNumber(Duration, &NumberFormatOptions),
+			FText::AsNumber(TimeRemaining, &NumberFormatOptions));
+	}
+
+	if (Period > 0.f)
+	{
+		Result = FText::Format(
+			LOCTEXT("GameplayEffectPeriodFormat", "{0}, Period: {1}"),
+			Result,
+			FText::AsNumber(Period, &NumberFormatOptions));
+	}
+
+	return Result;
+}
+
+void FGASGameplayEffectNodeBase::Update(const EGASGameplayEffectFields Fields, const bool bGatherChildren)
+{
+	const auto GatherField = [this, Fields](const EGASGameplayEffectFields Field, FText& OutText, FText (FGASGameplayEffectNodeBase::*Gather)() const)
+	{
+		// Skipped fields are cleared rather than left stale, so a search can't match on old values
+		OutText = EnumHasAnyFlags(Fields, Field) ? (this->*Gather)() : FText::GetEmpty();
+	};
+
 	Name = GatherName();
-	DurationText = GatherDuration();
-	StackText = GatherStack();
-	LevelText = GatherLevel();
-	Prediction = GatherPrediction();
-	GrantedTagsText = GatherGrantedTags();
+
+	// Timers only re-capture when the effect changed, the text is built while painting
+	bHasTimer =
+		EnumHasAnyFlags(Fields, EGASGameplayEffectFields::Duration) &&
+		GatherTimer(Countdown, Period);
+	if (bHasTimer)
+	{
+		DurationText = FText::GetEmpty();
+	}
+	else
+	{
+		Countdown.Reset();
+		GatherField(EGASGameplayEffectFields::Duration, DurationText, &FGASGameplayEffectNodeBase::GatherDuration);
+	}
+
+	GatherField(EGASGameplayEffectFields::Stack, StackText, &FGASGameplayEffectNodeBase::GatherStack);
+	GatherField(EGASGameplayEffectFields::Level, LevelText, &FGASGameplayEffectNodeBase::GatherLevel);
+	GatherField(EGASGameplayEffectFields::Prediction, Prediction, &FGASGameplayEffectNodeBase::GatherPrediction);
+	GatherField(EGASGameplayEffectFields::GrantedTags, GrantedTagsText, &FGASGameplayEffectNodeBase::GatherGrantedTags);
 	bIsBlocked = GatherBlocked();
 	StateText = GatherState();
 	StateType = GatherStateType();
@@ -34,7 +81,55 @@ void FGASGameplayEffectNodeBase::Update()
 
 	FixupColor();
 
-	CreateChildren();
+	ChildFields = Fields;
+
+	if (bGatherChildren)
+	{
+		ChildrenGatherFrame = GFrameCounter;
+		ChildrenWantedTime = FPlatformTime::Seconds();
+		CreateChildren(Fields);
+	}
+	// A recently collapsed row keeps its children as they were, so expanding it again is instant
+	else if (ChildrenGatherFrame == 0 ||
+		FPlatformTime::Seconds() - ChildrenWantedTime >= ChildrenTimeout)
+	{
+		ChildrenGatherFrame = 0;
+		DeferChildren();
+	}
+}
+
+void FGASGameplayEffectNodeBase::GatherChildren()
+{
+	ChildrenWantedTime = FPlatformTime::Seconds();
+
+	if (ChildrenGatherFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	ChildrenGatherFrame = GFrameCounter;
+	CreateChildren(ChildFields);
+}
+
+FText FGASGameplayEffectNodeBase::GetDurationText() const
+{
+	if (!bHasTimer)
+	{
+		return DurationText;
+	}
+
+	return FormatDuration(Countdown.GetDuration(), Countdown.GetRemaining(), Period);
+}
+
+void FGASGameplayEffectNodeBase::SetDiffChange(const EGASDiffChange InDiffChange)
+{
+	if (DiffChange == InDiffChange)
+	{
+		return;
+	}
+
+	DiffChange = InDiffChange;
+	FixupColor();
 }
 
 void FGASGameplayEffectNodeBase::FixupColor()
@@ -42,6 +137,8 @@ void FGASGameplayEffectNodeBase::FixupColor()
 	Tint = bIsBlocked
 		? FStyleColors::Error.GetSpecifiedColor()
 		: FSlateColor::UseForeground().GetColor(FWidgetStyle());
+
+	Tint = GetDiffColor(DiffChange, Tint);
 }
 
 const TArray<TSharedPtr<FGASGameplayEffectNodeBase>>& FGASGameplayEffectNodeBase::GetChildNodes() const
@@ -53,8 +150,9 @@ const TArray<TSharedPtr<FGASGameplayEffectNodeBase>>& FGASGameplayEffectNodeBase
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-FGASGameplayEffectNode::FGASGameplayEffectNode(const FName WorldContextHandle, const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const FActiveGameplayEffectHandle& GameplayEffectHandle)
-	: WorldContextHandle(WorldContextHandle)
+FGASGameplayEffectNode::FGASGameplayEffectNode(const FGASNodePool& NodePool, const FName WorldContextHandle, const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const FActiveGameplayEffectHandle& GameplayEffectHandle)
+	: NodePool(NodePool)
+	, WorldContextHandle(WorldContextHandle)
 	, WeakComponent(WeakComponent)
 	, GameplayEffectHandle(GameplayEffectHandle)
 {
@@ -78,37 +176,25 @@ FText FGASGameplayEffectNode::GatherName() const
 }
 
 FText FGASGameplayEffectNode::GatherDuration() const
+{
+	// Only reached when there is no effect to take a timer from
+	return LOCTEXT("None", "None");
+}
+
+bool FGASGameplayEffectNode::GatherTimer(FGASCountdown& InOutCountdown, float& OutPeriod) const
 {
 	const UWorld* World = GetWorld();
 	const FActiveGameplayEffect* GameplayEffect = GetGameplayEffect();
 	if (!World ||
 		!GameplayEffect)
 	{
-		return LOCTEXT("None", "None");
-	}
-
-	FText Result = LOCTEXT("GameplayEffectInfiniteDuration", "Infinite Duration");
-
-	FNumberFormattingOptions NumberFormatOptions;
-	NumberFormatOptions.MaximumFractionalDigits = 2;
-
-	if (GameplayEffect->GetDuration() > 0.f)
-	{
-		Result = FText::Format(
-			LOCTEXT("GameplayEffectDurationFormat", "Duration: {0}, Remaining: {1}"),
-			FText::AsNumber(GameplayEffect->GetDuration(), &NumberFormatOptions),
-			FText::AsNumber(GameplayEffect->GetTimeRemaining(World->GetTimeSeconds()), &NumberFormatOptions));
+		return false;
 	}
 
-	if (GameplayEffect->GetPeriod() > 0.f)
-	{
-		Result = FText::Format(
-			LOCTEXT("GameplayEffectPeriodFormat", "{0}, Period: {1}"),
-			Result,
-			FText::AsNumber(GameplayEffect->GetPeriod(), &NumberFormatOptions));
-	}
+	InOutCountdown.Sync(World, GameplayEffect->StartWorldTime, GameplayEffect->GetDuration());
+	OutPeriod = GameplayEffect->GetPeriod();
 
-	return Result;
+	return true;
 }
 
 FText FGASGameplayEffectNode::GatherStack() const
@@ -250,7 +336,26 @@ const UClass* FGASGameplayEffectNode::GatherSourceAssetClass() const
 	return GameplayEffect->Spec.Def->GetClass();
 }
 
-void FGASGameplayEffectNode::CreateChildren()
+void FGASGameplayEffectNode::DeferChildren()
+{
+	MappedModifiers.Reset();
+	ChildNodes.Reset();
+
+	const FActiveGameplayEffect* GameplayEffect = GetGameplayEffect();
+	if (GameplayEffect &&
+		GameplayEffect->Spec.Def &&
+		GameplayEffect->Spec.Modifiers.Num() > 0)
+	{
+		if (!ModifiersPlaceholder)
+		{
+			ModifiersPlaceholder = NodePool.Make<FGASGameplayEffectNodeBase>();
+		}
+
+		ChildNodes.Add(ModifiersPlaceholder);
+	}
+}
+
+void FGASGameplayEffectNode::CreateChildren(const EGASGameplayEffectFields Fields)
 {
 	const FActiveGameplayEffect* GameplayEffect = GetGameplayEffect();
 	if (!GameplayEffect)
@@ -285,12 +390,12 @@ void FGASGameplayEffectNode::CreateChildren()
 
 		if (const TSharedPtr<FGASGameplayEffectNodeBase>& ModifierNode = MappedModifiers.FindRef(Index))
 		{
-			ModifierNode->Update();
+			ModifierNode->Update(Fields);
 			continue;
 		}
 
-		TSharedRef<FGASGameplayEffectModifierNode> NewItem = MakeShared<FGASGameplayEffectModifierNode>(WeakComponent, GameplayEffectHandle, Index);
-		NewItem->Update();
+		TSharedRef<FGASGameplayEffectModifierNode> NewItem = NodePool.Make<FGASGameplayEffectModifierNode>(WeakComponent, GameplayEffectHandle, Index);
+		NewItem->Update(Fields);
 		MappedModifiers.Add(Index, NewItem);
 	}
 
@@ -332,6 +437,184 @@ const FActiveGameplayEffect* FGASGameplayEffectNode::GetGameplayEffect() const
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+FGASGameplayEffectGroupNode::FGASGameplayEffectGroupNode(const FGASNodePool& NodePool, const FName WorldContextHandle, const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const UGameplayEffect* Def, FShouldGatherChildren ShouldGatherInstanceChildren)
+	: NodePool(NodePool)
+	, WorldContextHandle(WorldContextHandle)
+	, WeakComponent(WeakComponent)
+	, Def(Def)
+	, ShouldGatherInstanceChildren(MoveTemp(ShouldGatherInstanceChildren))
+{
+}
+
+void FGASGameplayEffectGroupNode::ResetInstances()
+{
+	Instances.Reset();
+	NumInhibited = 0;
+	TotalStacks = 0;
+	bHasTimedInstances = false;
+}
+
+void FGASGameplayEffectGroupNode::AddInstance(const FActiveGameplayEffect& ActiveGameplayEffect, const float WorldTime)
+{
+	const float Level = ActiveGameplayEffect.Spec.GetLevel();
+	MinLevel = Instances.Num() > 0 ? FMath::Min(MinLevel, Level) : Level;
+	MaxLevel = Instances.Num() > 0 ? FMath::Max(MaxLevel, Level) : Level;
+
+	if (ActiveGameplayEffect.GetDuration() > 0.f)
+	{
+		const float TimeRemaining = ActiveGameplayEffect.GetTimeRemaining(WorldTime);
+		MinTimeRemaining = bHasTimedInstances ? FMath::Min(MinTimeRemaining, TimeRemaining) : TimeRemaining;
+		MaxTimeRemaining = bHasTimedInstances ? FMath::Max(MaxTimeRemaining, TimeRemaining) : TimeRemaining;
+		bHasTimedInstances = true;
+	}
+
+	NumInhibited += ActiveGameplayEffect.bIsInhibited ? 1 : 0;
+	TotalStacks += ActiveGameplayEffect.Spec.GetStackCount();
+
+	Instances.Add(ActiveGameplayEffect.Handle);
+}
+
+FText FGASGameplayEffectGroupNode::GatherName() const
+{
+	const UAbilitySystemComponent* Component = WeakComponent.Get();
+	if (!Component)
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	return FText::FromString(Component->CleanupName(GetNameSafe(Def.Get())));
+}
+
+FText FGASGameplayEffectGroupNode::GatherDuration() const
+{
+	if (!bHasTimedInstances)
+	{
+		return LOCTEXT("GameplayEffectInfiniteDuration", "Infinite Duration");
+	}
+
+	FNumberFormattingOptions NumberFormatOptions;
+	NumberFormatOptions.MaximumFractionalDigits = 2;
+
+	return FText::Format(
+		LOCTEXT("GameplayEffectGroupRemainingFormat", "Remaining: {0} - {1}"),
+		FText::AsNumber(MinTimeRemaining, &NumberFormatOptions),
+		FText::AsNumber(MaxTimeRemaining, &NumberFormatOptions));
+}
+
+FText FGASGameplayEffectGroupNode::GatherStack() const
+{
+	return FText::Format(
+		LOCTEXT("GameplayEffectGroupStacksFormat", "Instances: {0}, Stacks: {1}"),
+		Instances.Num(),
+		TotalStacks);
+}
+
+FText FGASGameplayEffectGroupNode::GatherLevel() const
+{
+	if (MinLevel == MaxLevel)
+	{
+		return FText::AsNumber(MinLevel);
+	}
+
+	return FText::Format(
+		LOCTEXT("GameplayEffectGroupLevelFormat", "{0} - {1}"),
+		FText::AsNumber(MinLevel),
+		FText::AsNumber(MaxLevel));
+}
+
+FText FGASGameplayEffectGroupNode::GatherState() const
+{
+	if (NumInhibited == 0)
+	{
+		return LOCTEXT("GameplayEffectActive", "Active");
+	}
+
+	if (NumInhibited == Instances.Num())
+	{
+		return LOCTEXT("GameplayEffectBlocked", "Blocked");
+	}
+
+	return FText::Format(
+		LOCTEXT("GameplayEffectGroupBlockedFormat", "Blocked: {0}/{1}"),
+		NumInhibited,
+		Instances.Num());
+}
+
+bool FGASGameplayEffectGroupNode::GatherBlocked() const
+{
+	return
+		Instances.Num() > 0 &&
+		NumInhibited == Instances.Num();
+}
+
+EGameplayEffectStateType::Type FGASGameplayEffectGroupNode::GatherStateType() const
+{
+	if (GatherBlocked())
+	{
+		return EGameplayEffectStateType::Inhibited;
+	}
+
+	if (!bHasTimedInstances)
+	{
+		return EGameplayEffectStateType::Infinite;
+	}
+
+	return EGameplayEffectStateType::Active;
+}
+
+const UClass* FGASGameplayEffectGroupNode::GatherSourceAssetClass() const
+{
+	const UGameplayEffect* Effect = Def.Get();
+	return Effect ? Effect->GetClass() : nullptr;
+}
+
+void FGASGameplayEffectGroupNode::DeferChildren()
+{
+	MappedInstances.Reset();
+	ChildNodes.Reset();
+
+	if (Instances.Num() > 0)
+	{
+		if (!InstancesPlaceholder)
+		{
+			InstancesPlaceholder = NodePool.Make<FGASGameplayEffectNodeBase>();
+		}
+
+		ChildNodes.Add(InstancesPlaceholder);
+	}
+}
+
+void FGASGameplayEffectGroupNode::CreateChildren(const EGASGameplayEffectFields Fields)
+{
+	ChildNodes.Reset();
+
+	TSet<FActiveGameplayEffectHandle> UnusedInstances;
+	MappedInstances.GetKeys(UnusedInstances);
+
+	for (const FActiveGameplayEffectHandle& Handle : Instances)
+	{
+		UnusedInstances.Remove(Handle);
+
+		TSharedPtr<FGASGameplayEffectNodeBase>& InstanceNode = MappedInstances.FindOrAdd(Handle);
+		if (!InstanceNode)
+		{
+			InstanceNode = NodePool.Make<FGASGameplayEffectNode>(NodePool, WorldContextHandle, WeakComponent, Handle);
+		}
+
+		InstanceNode->Update(Fields, ShouldGatherInstanceChildren(InstanceNode));
+		ChildNodes.Add(InstanceNode);
+	}
+
+	for (const FActiveGameplayEffectHandle& UnusedInstance : UnusedInstances)
+	{
+		MappedInstances.Remove(UnusedInstance);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
 FGASGameplayEffectModifierNode::FGASGameplayEffectModifierNode(const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const FActiveGameplayEffectHandle& GameplayEffectHandle, const int32 ModifierIndex)
 	: WeakComponent(WeakComponent)
 	, GameplayEffectHandle(GameplayEffectHandle)
@@ -429,6 +712,335 @@ const FGameplayModifierInfo* FGASGameplayEffectModifierNode::GetModifierInfo(con
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+FGASGameplayEffectSnapshotNode::FGASGameplayEffectSnapshotNode(const FGASNodePool& NodePool)
+	: NodePool(NodePool)
+{
+}
+
+void FGASGameplayEffectSnapshotNode::SetSnapshot(const FGASWorldSnapshot& World, const FGASEffectSnapshot& InEffect)
+{
+	if (Effect.Def != InEffect.Def ||
+		!Def.IsValid())
+	{
+		const UClass* DefClass = FGASWorldSnapshot::ResolveClass(InEffect.Def);
+		Def = DefClass ? Cast<UGameplayEffect>(DefClass->GetDefaultObject()) : nullptr;
+
+		// Modifier rows hold on to the definition they were made for
+		ChildNodes.Reset();
+	}
+
+	Effect = InEffect;
+	WorldTime = World.WorldTime;
+	LocalTime = World.LocalTime;
+	TimeDilation = World.TimeDilation;
+}
+
+FText FGASGameplayEffectSnapshotNode::GatherName() const
+{
+	if (Effect.Def.IsNone())
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	return FText::FromString(FGASWorldSnapshot::GetCleanName(Effect.Def));
+}
+
+bool FGASGameplayEffectSnapshotNode::GatherTimer(FGASCountdown& InOutCountdown, float& OutPeriod) const
+{
+	InOutCountdown.SyncRemote(WorldTime, LocalTime, TimeDilation, Effect.StartWorldTime, Effect.Duration);
+	OutPeriod = Effect.Period;
+
+	return true;
+}
+
+FText FGASGameplayEffectSnapshotNode::GatherStack() const
+{
+	// The instigator of an aggregated stack stays on the other side
+	if (Effect.StackCount <= 1)
+	{
+		return {};
+	}
+
+	return FText::Format(LOCTEXT("GameplayEffectStacks", "Stacks: {0}"), Effect.StackCount);
+}
+
+FText FGASGameplayEffectSnapshotNode::GatherLevel() const
+{
+	return FText::AsNumber(Effect.Level);
+}
+
+FText FGASGameplayEffectSnapshotNode::GatherPrediction() const
+{
+	if (!Effect.bPredicted)
+	{
+		return {};
+	}
+
+	if (Effect.bPredictedLocally)
+	{
+		return LOCTEXT("GameplayEffectPredictionGenerated", "Predicted and Waiting");
+	}
+
+	return LOCTEXT("GameplayEffectPredictedCaughtUp", "Predicted and Caught Up");
+}
+
+FText FGASGameplayEffectSnapshotNode::GatherGrantedTags() const
+{
+	const UGameplayEffect* EffectDef = Def.Get();
+	if (!EffectDef)
+	{
+		return {};
+	}
+
+	// Only the definition's tags, same as the flat view
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	return FText::FromString(EffectDef->GetGrantedTags().ToStringSimple());
+#else
+	return FText::FromString(EffectDef->InheritableOwnedTagsContainer.CombinedTags.ToStringSimple());
+#endif
+}
+
+FText FGASGameplayEffectSnapshotNode::GatherState() const
+{
+	if (Effect.bInhibited)
+	{
+		return LOCTEXT("GameplayEffectBlocked", "Blocked");
+	}
+
+	return LOCTEXT("GameplayEffectActive", "Active");
+}
+
+bool FGASGameplayEffectSnapshotNode::GatherBlocked() const
+{
+	return Effect.bInhibited;
+}
+
+EGameplayEffectStateType::Type FGASGameplayEffectSnapshotNode::GatherStateType() const
+{
+	if (Effect.bInhibited)
+	{
+		return EGameplayEffectStateType::Inhibited;
+	}
+
+	if (Effect.Duration <= 0.f)
+	{
+		return EGameplayEffectStateType::Infinite;
+	}
+
+	return EGameplayEffectStateType::Active;
+}
+
+const UClass* FGASGameplayEffectSnapshotNode::GatherSourceAssetClass() const
+{
+	return FGASWorldSnapshot::ResolveClass(Effect.Def);
+}
+
+void FGASGameplayEffectSnapshotNode::DeferChildren()
+{
+	ChildNodes.Reset();
+
+	if (GetNumModifiers() > 0)
+	{
+		if (!ModifiersPlaceholder)
+		{
+			ModifiersPlaceholder = NodePool.Make<FGASGameplayEffectNodeBase>();
+		}
+
+		ChildNodes.Add(ModifiersPlaceholder);
+	}
+}
+
+void FGASGameplayEffectSnapshotNode::CreateChildren(const EGASGameplayEffectFields Fields)
+{
+	const int32 NumModifiers = GetNumModifiers();
+
+	// Modifiers of one effect never change order, so they are kept by index
+	if (ChildNodes.Num() > 0 &&
+		ChildNodes[0] == ModifiersPlaceholder)
+	{
+		ChildNodes.Reset();
+	}
+
+	ChildNodes.SetNum(NumModifiers);
+	for (int32 Index = 0; Index < NumModifiers; ++Index)
+	{
+		if (!ChildNodes[Index])
+		{
+			ChildNodes[Index] = NodePool.Make<FGASGameplayEffectSnapshotModifierNode>(Def, Index);
+		}
+
+		FGASGameplayEffectSnapshotModifierNode& ModifierNode = static_cast<FGASGameplayEffectSnapshotModifierNode&>(*ChildNodes[Index]);
+		ModifierNode.SetMagnitude(Effect.Modifiers[Index]);
+		ModifierNode.Update(Fields);
+	}
+}
+
+int32 FGASGameplayEffectSnapshotNode::GetNumModifiers() const
+{
+	const UGameplayEffect* EffectDef = Def.Get();
+	return EffectDef ? FMath::Min(Effect.Modifiers.Num(), EffectDef->Modifiers.Num()) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FGASGameplayEffectSnapshotModifierNode::FGASGameplayEffectSnapshotModifierNode(const TWeakObjectPtr<const UGameplayEffect>& Def, const int32 ModifierIndex)
+	: Def(Def)
+	, ModifierIndex(ModifierIndex)
+{
+}
+
+FText FGASGameplayEffectSnapshotModifierNode::GatherName() const
+{
+	const UGameplayEffect* Effect = Def.Get();
+	if (!Effect ||
+		!Effect->Modifiers.IsValidIndex(ModifierIndex))
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	return FText::FromString(Effect->Modifiers[ModifierIndex].Attribute.AttributeName);
+}
+
+FText FGASGameplayEffectSnapshotModifierNode::GatherDuration() const
+{
+	const UGameplayEffect* Effect = Def.Get();
+	if (!Effect ||
+		!Effect->Modifiers.IsValidIndex(ModifierIndex))
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	const UEnum* Enum = StaticEnum<EGameplayModOp::Type>();
+	return
+		FText::Format(
+			LOCTEXT("GameplayEffectModifier", "Modifier: {0}, Value: {1}"),
+			FText::FromString(Enum->GetNameStringByValue(Effect->Modifiers[ModifierIndex].ModifierOp)),
+			Magnitude);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FText FGASGameplayEffectFlatRow::GetName() const
+{
+	const UGameplayEffect* Effect = Def.Get();
+	if (!Effect)
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	if (!IsModifier())
+	{
+		return FText::FromString(UAbilitySystemComponent::CleanupName(GetNameSafe(Effect)));
+	}
+
+	if (!Effect->Modifiers.IsValidIndex(ModifierIndex))
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	return FText::FromString(Effect->Modifiers[ModifierIndex].Attribute.AttributeName);
+}
+
+FText FGASGameplayEffectFlatRow::GetState() const
+{
+	if (IsModifier())
+	{
+		return {};
+	}
+
+	return bInhibited
+		? LOCTEXT("GameplayEffectBlocked", "Blocked")
+		: LOCTEXT("GameplayEffectActive", "Active");
+}
+
+FText FGASGameplayEffectFlatRow::GetDuration() const
+{
+	if (IsModifier())
+	{
+		const UGameplayEffect* Effect = Def.Get();
+		if (!Effect ||
+			!Effect->Modifiers.IsValidIndex(ModifierIndex))
+		{
+			return LOCTEXT("None", "None");
+		}
+
+		const UEnum* Enum = StaticEnum<EGameplayModOp::Type>();
+		return
+			FText::Format(
+				LOCTEXT("GameplayEffectModifier", "Modifier: {0}, Value: {1}"),
+				FText::FromString(Enum->GetNameStringByValue(Effect->Modifiers[ModifierIndex].ModifierOp)),
+				Magnitude);
+	}
+
+	return FormatDuration(Duration, Countdown.GetRemaining(), Period);
+}
+
+FText FGASGameplayEffectFlatRow::GetStack() const
+{
+	if (IsModifier() ||
+		StackCount <= 1)
+	{
+		return {};
+	}
+
+	return FText::Format(LOCTEXT("GameplayEffectStacks", "Stacks: {0}"), StackCount);
+}
+
+FText FGASGameplayEffectFlatRow::GetLevel() const
+{
+	if (IsModifier())
+	{
+		return {};
+	}
+
+	return FText::AsNumber(Level);
+}
+
+FText FGASGameplayEffectFlatRow::GetPrediction() const
+{
+	if (IsModifier() ||
+		!bPredicted)
+	{
+		return {};
+	}
+
+	return bPredictedLocally
+		? LOCTEXT("GameplayEffectPredictionGenerated", "Predicted and Waiting")
+		: LOCTEXT("GameplayEffectPredictedCaughtUp", "Predicted and Caught Up");
+}
+
+FText FGASGameplayEffectFlatRow::GetGrantedTags() const
+{
+	const UGameplayEffect* Effect = Def.Get();
+	if (IsModifier() ||
+		!Effect)
+	{
+		return {};
+	}
+
+	// Only the definition's tags - dynamic tags live on the spec, which a flat row doesn't keep
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	return FText::FromString(Effect->GetGrantedTags().ToStringSimple());
+#else
+	return FText::FromString(Effect->InheritableOwnedTagsContainer.CombinedTags.ToStringSimple());
+#endif
+}
+
+FLinearColor FGASGameplayEffectFlatRow::GetColor() const
+{
+	return GetDiffColor(DiffChange, bInhibited
+		? FStyleColors::Error.GetSpecifiedColor()
+		: FSlateColor::UseForeground().GetColor(FWidgetStyle()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
 void SGASGameplayEffectTreeItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
 {
 	WidgetInfo = InArgs._WidgetInfoToVisualize;
@@ -590,4 +1202,94 @@ void SGASGameplayEffectTreeItem::HandleHyperlinkNavigate() const
 	WidgetInfo->NavigateToSource();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SGASGameplayEffectFlatItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Row = InArgs._Row;
+	HighlightText = InArgs._HighlightText;
+	SetPadding(0.f);
+
+	check(Row);
+
+	SMultiColumnTableRow<const FGASGameplayEffectFlatRow*>::Construct(SMultiColumnTableRow<const FGASGameplayEffectFlatRow*>::FArguments().Padding(0.f), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SGASGameplayEffectFlatItem::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectNameColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetName, HAlign_Left, ETextJustify::Left, true);
+	}
+
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectStateColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetState, HAlign_Left, ETextJustify::Center);
+	}
+
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectDurationColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetDuration, HAlign_Left, ETextJustify::Left);
+	}
+
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectStackColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetStack, HAlign_Left, ETextJustify::Left);
+	}
+
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectLevelColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetLevel, HAlign_Center, ETextJustify::Center);
+	}
+
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectPredictionColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetPrediction, HAlign_Center, ETextJustify::Center);
+	}
+
+	if (ColumnName == SGASGameplayEffectsTab::GameplayEffectGrantedTagsColumn)
+	{
+		return CreateTextColumn(&FGASGameplayEffectFlatRow::GetGrantedTags, HAlign_Left, ETextJustify::Left);
+	}
+
+	return SNullWidget::NullWidget;
+}
+
+TSharedRef<SWidget> SGASGameplayEffectFlatItem::CreateTextColumn(
+	FText (FGASGameplayEffectFlatRow::*Getter)() const,
+	const EHorizontalAlignment HorizontalAlignment,
+	const ETextJustify::Type Justification,
+	const bool bIndentModifiers) const
+{
+	// The row pointer is stable for the widget's lifetime, but the data behind it is rewritten on every refresh
+	const FGASGameplayEffectFlatRow* RowData = Row;
+
+	return
+		SNew(SBorder)
+		.HAlign(HorizontalAlignment)
+		.VAlign(VAlign_Center)
+		.Padding_Lambda([RowData, bIndentModifiers]
+		{
+			const float Indent = bIndentModifiers && RowData->IsModifier() ? 16.f : 0.f;
+			return FMargin(2.f + Indent, 0.f, 2.f, 0.f);
+		})
+		.Visibility(EVisibility::SelfHitTestInvisible)
+		.BorderBackgroundColor(FLinearColor::Transparent)
+		.ColorAndOpacity_Lambda([RowData]
+		{
+			return RowData->GetColor();
+		})
+		[
+			SNew(STextBlock)
+			.Text_Lambda([RowData, Getter]
+			{
+				return (RowData->*Getter)();
+			})
+			.HighlightText(HighlightText)
+			.Justification(Justification)
+		];
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "ActiveGameplayEffectHandle.h"
 #include "GASAttachEditorAbilityAccessors.h"
+#include "GASAttachEditorCountdown.h"
+#include "GASAttachEditorNodePool.h"
+#include "GASAttachSnapshot.h"
 #include "Widgets/SGASGameplayEffectsTab.h"
 
 class UAbilitySystemComponent;
@@ -18,11 +21,19 @@ public:
 	FGASGameplayEffectNodeBase() = default;
 	virtual ~FGASGameplayEffectNodeBase() = default;
 
-	void Update();
+	/** With bGatherChildren unset, modifier rows are only kept for a while after being last needed. */
+	void Update(EGASGameplayEffectFields Fields = EGASGameplayEffectFields::All, bool bGatherChildren = true);
+
+	/** Builds the modifier rows now, for a row being expanded or searched. Free if already done this frame. */
+	void GatherChildren();
+
+	/** Tints the row by how it differs from the base it's compared with */
+	void SetDiffChange(EGASDiffChange InDiffChange);
 
 public:
 	FORCEINLINE FText GetName() const { return Name; }
-	FORCEINLINE FText GetDurationText() const { return DurationText; }
+	/** Timed rows count down at paint time, between refreshes */
+	FText GetDurationText() const;
 	FORCEINLINE FText GetStackText() const { return StackText; }
 	FORCEINLINE FText GetLevelText() const { return LevelText; }
 	FORCEINLINE FText GetPrediction() const { return Prediction; }
@@ -37,6 +48,8 @@ public:
 protected:
 	virtual FText GatherName() const { return {}; }
 	virtual FText GatherDuration() const { return {}; }
+	// Rows with a timer return true and have their duration text built from it instead of GatherDuration
+	virtual bool GatherTimer(FGASCountdown& InOutCountdown, float& OutPeriod) const { return false; }
 	virtual FText GatherStack() const { return {}; }
 	virtual FText GatherLevel() const { return {}; }
 	virtual FText GatherPrediction() const { return {}; }
@@ -46,7 +59,9 @@ protected:
 	virtual EGameplayEffectStateType::Type GatherStateType() const { return EGameplayEffectStateType::Active; }
 	// Modifier rows have no asset of their own; only the effect itself overrides this
 	virtual const UClass* GatherSourceAssetClass() const { return nullptr; }
-	virtual void CreateChildren() {}
+	virtual void CreateChildren(EGASGameplayEffectFields Fields) {}
+	// Drops the children that are no longer needed, leaving a placeholder if there would be any
+	virtual void DeferChildren() {}
 
 public:
 	const TArray<TSharedPtr<FGASGameplayEffectNodeBase>>& GetChildNodes() const;
@@ -54,6 +69,9 @@ public:
 private:
 	FText Name;
 	FText DurationText;
+	FGASCountdown Countdown;
+	float Period = 0.f;
+	bool bHasTimer = false;
 	FText StackText;
 	FText LevelText;
 	FText Prediction;
@@ -61,6 +79,7 @@ private:
 	FText StateText;
 	FLinearColor Tint;
 	bool bIsBlocked = false;
+	EGASDiffChange DiffChange = EGASDiffChange::Unchanged;
 	EGameplayEffectStateType::Type StateType = EGameplayEffectStateType::Active;
 
 	// Resolved once and kept, so the source link still works after PIE ends
@@ -68,6 +87,12 @@ private:
 
 	void FixupColor();
 
+	EGASGameplayEffectFields ChildFields = EGASGameplayEffectFields::All;
+	uint64 ChildrenGatherFrame = 0;
+	double ChildrenWantedTime = 0.0;
+
+	static constexpr double ChildrenTimeout = 5.0;
+
 protected:
 	TArray<TSharedPtr<FGASGameplayEffectNodeBase>> ChildNodes;
 };
@@ -75,11 +100,12 @@ protected:
 class FGASGameplayEffectNode : public FGASGameplayEffectNodeBase
 {
 public:
-	explicit FGASGameplayEffectNode(const FName WorldContextHandle, const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const FActiveGameplayEffectHandle& GameplayEffect);
+	explicit FGASGameplayEffectNode(const FGASNodePool& NodePool, const FName WorldContextHandle, const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const FActiveGameplayEffectHandle& GameplayEffect);
 
 protected:
 	virtual FText GatherName() const override;
 	virtual FText GatherDuration() const override;
+	virtual bool GatherTimer(FGASCountdown& InOutCountdown, float& OutPeriod) const override;
 	virtual FText GatherStack() const override;
 	virtual FText GatherLevel() const override;
 	virtual FText GatherPrediction() const override;
@@ -88,18 +114,80 @@ protected:
 	virtual bool GatherBlocked() const override;
 	virtual EGameplayEffectStateType::Type GatherStateType() const override;
 	virtual const UClass* GatherSourceAssetClass() const override;
-	virtual void CreateChildren() override;
+	virtual void CreateChildren(EGASGameplayEffectFields Fields) override;
+	virtual void DeferChildren() override;
 
 private:
 	UWorld* GetWorld() const;
 	const FActiveGameplayEffect* GetGameplayEffect() const;
 
 private:
+	// Modifier nodes come from the same pool as their effect
+	const FGASNodePool NodePool;
 	const FName WorldContextHandle;
 	const TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
 	const FActiveGameplayEffectHandle GameplayEffectHandle;
 
 	TMap<int32, TSharedPtr<FGASGameplayEffectNodeBase>> MappedModifiers;
+
+	// Stands in for the modifiers while they are not gathered, so the row can still be expanded
+	TSharedPtr<FGASGameplayEffectNodeBase> ModifiersPlaceholder;
+};
+
+/**
+ * All active effects sharing one definition, summarized in a single row.
+ *
+ * The tab feeds the instances in with AddInstance, which only reads a few numbers off each of them;
+ * the per-instance rows are built when the group is expanded or searched.
+ */
+class FGASGameplayEffectGroupNode : public FGASGameplayEffectNodeBase
+{
+public:
+	using FShouldGatherChildren = TFunction<bool(const TSharedPtr<FGASGameplayEffectNodeBase>&)>;
+
+	explicit FGASGameplayEffectGroupNode(const FGASNodePool& NodePool, const FName WorldContextHandle, const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const UGameplayEffect* Def, FShouldGatherChildren ShouldGatherInstanceChildren);
+
+	/** Forgets the instances of the last refresh; the tab adds this refresh's right after. */
+	void ResetInstances();
+	void AddInstance(const FActiveGameplayEffect& ActiveGameplayEffect, float WorldTime);
+
+	FORCEINLINE int32 GetNumInstances() const { return Instances.Num(); }
+
+protected:
+	virtual FText GatherName() const override;
+	virtual FText GatherDuration() const override;
+	virtual FText GatherStack() const override;
+	virtual FText GatherLevel() const override;
+	virtual FText GatherState() const override;
+	virtual bool GatherBlocked() const override;
+	virtual EGameplayEffectStateType::Type GatherStateType() const override;
+	virtual const UClass* GatherSourceAssetClass() const override;
+	virtual void CreateChildren(EGASGameplayEffectFields Fields) override;
+	virtual void DeferChildren() override;
+
+private:
+	// Instance nodes come from the same pool as their group
+	const FGASNodePool NodePool;
+	const FName WorldContextHandle;
+	const TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
+	const TWeakObjectPtr<const UGameplayEffect> Def;
+
+	// Instances are told whether to build their modifiers the same way the tab decides for top-level rows
+	const FShouldGatherChildren ShouldGatherInstanceChildren;
+
+	TArray<FActiveGameplayEffectHandle> Instances;
+	int32 NumInhibited = 0;
+	int32 TotalStacks = 0;
+	float MinLevel = 0.f;
+	float MaxLevel = 0.f;
+	float MinTimeRemaining = 0.f;
+	float MaxTimeRemaining = 0.f;
+	bool bHasTimedInstances = false;
+
+	TMap<FActiveGameplayEffectHandle, TSharedPtr<FGASGameplayEffectNodeBase>> MappedInstances;
+
+	// Stands in for the instances while they are not gathered, so the row can still be expanded
+	TSharedPtr<FGASGameplayEffectNodeBase> InstancesPlaceholder;
 };
 
 class FGASGameplayEffectModifierNode : public FGASGameplayEffectNodeBase
@@ -122,6 +210,68 @@ private:
 	const int32 ModifierIndex;
 };
 
+/**
+ * An active effect of another process, as of its latest snapshot.
+ *
+ * The tab hands it the snapshot with SetSnapshot before each Update. The definition is resolved in this
+ * process by class path, for the name, granted tags and modifier names - rows of classes this process
+ * doesn't have still show their numbers.
+ */
+class FGASGameplayEffectSnapshotNode : public FGASGameplayEffectNodeBase
+{
+public:
+	explicit FGASGameplayEffectSnapshotNode(const FGASNodePool& NodePool);
+
+	void SetSnapshot(const FGASWorldSnapshot& World, const FGASEffectSnapshot& InEffect);
+
+protected:
+	virtual FText GatherName() const override;
+	virtual bool GatherTimer(FGASCountdown& InOutCountdown, float& OutPeriod) const override;
+	virtual FText GatherStack() const override;
+	virtual FText GatherLevel() const override;
+	virtual FText GatherPrediction() const override;
+	virtual FText GatherGrantedTags() const override;
+	virtual FText GatherState() const override;
+	virtual bool GatherBlocked() const override;
+	virtual EGameplayEffectStateType::Type GatherStateType() const override;
+	virtual const UClass* GatherSourceAssetClass() const override;
+	virtual void CreateChildren(EGASGameplayEffectFields Fields) override;
+	virtual void DeferChildren() override;
+
+private:
+	int32 GetNumModifiers() const;
+
+private:
+	const FGASNodePool NodePool;
+
+	FGASEffectSnapshot Effect;
+	TWeakObjectPtr<const UGameplayEffect> Def;
+
+	double WorldTime = 0.0;
+	double LocalTime = 0.0;
+	float TimeDilation = 1.f;
+
+	// Stands in for the modifiers while they are not gathered, so the row can still be expanded
+	TSharedPtr<FGASGameplayEffectNodeBase> ModifiersPlaceholder;
+};
+
+class FGASGameplayEffectSnapshotModifierNode : public FGASGameplayEffectNodeBase
+{
+public:
+	explicit FGASGameplayEffectSnapshotModifierNode(const TWeakObjectPtr<const UGameplayEffect>& Def, int32 ModifierIndex);
+
+	void SetMagnitude(float InMagnitude) { Magnitude = InMagnitude; }
+
+protected:
+	virtual FText GatherName() const override;
+	virtual FText GatherDuration() const override;
+
+private:
+	const TWeakObjectPtr<const UGameplayEffect> Def;
+	const int32 ModifierIndex;
+	float Magnitude = 0.f;
+};
+
 class SGASGameplayEffectTreeItem : public SMultiColumnTableRow<TSharedPtr<FGASGameplayEffectNodeBase>>
 {
 public:
@@ -151,4 +301,33 @@ private:
 private:
 	TSharedPtr<FGASGameplayEffectNodeBase> WidgetInfo;
 	TAttribute<FText> HighlightText;
+};
+
+class SGASGameplayEffectFlatItem : public SMultiColumnTableRow<const FGASGameplayEffectFlatRow*>
+{
+public:
+	SLATE_BEGIN_ARGS(SGASGameplayEffectFlatItem)
+	{}
+		SLATE_ARGUMENT(const FGASGameplayEffectFlatRow*, Row)
+		SLATE_ATTRIBUTE(FText, HighlightText)
+	SLATE_END_ARGS()
+
+public:
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+
+	//~ Begin SMultiColumnTableRow Interface
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+	//~ End SMultiColumnTableRow Interface
+
+private:
+	TSharedRef<SWidget> CreateTextColumn(
+		FText (FGASGameplayEffectFlatRow::*Getter)() const,
+		EHorizontalAlignment HorizontalAlignment,
+		ETextJustify::Type Justification,
+		bool bIndentModifiers = false) const;
+
+private:
+	// Points into the tab's row array; the tab rebuilds the list whenever another row lands in this slot
+	const FGASGameplayEffectFlatRow* Row = nullptr;
+	TAttribute<FText> HighlightText;
 };
\ No newline at end of file
@@ -3,19 +3,24 @@
 #include "SGASGameplayEffectsTab.h"
 
 #include "SGASGameplayEffectItem.h"
+#include "GASAttachEditorDiff.h"
 #include "GASAttachEditorSettings.h"
+#include "GASAttachSnapshot.h"
 
 #include "AbilitySystemComponent.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
 
 const TCHAR* SGASGameplayEffectsTab::VisibleStatesKey = TEXT("GameplayEffects.VisibleStates");
 const TCHAR* SGASGameplayEffectsTab::SortModeKey = TEXT("GameplayEffects.SortMode");
 const TCHAR* SGASGameplayEffectsTab::HiddenColumnsKey = TEXT("GameplayEffects.HiddenColumns");
+const TCHAR* SGASGameplayEffectsTab::FlatViewKey = TEXT("GameplayEffects.FlatView");
+const TCHAR* SGASGameplayEffectsTab::GroupByEffectKey = TEXT("GameplayEffects.GroupByEffect");
 
 const FName SGASGameplayEffectsTab::GameplayEffectNameColumn = "GameplayEffect_Name";
 const FName SGASGameplayEffectsTab::GameplayEffectStateColumn = "GameplayEffect_State";
@@ -28,6 +33,7 @@ const FName SGASGameplayEffectsTab::GameplayEffectGrantedTagsColumn = "GameplayE
 void SGASGameplayEffectsTab::Construct(const FArguments& InArgs)
 {
 	SearchFilter = MakeShared<FGASGameplayEffectTextFilter>(FGASGameplayEffectTextFilter::FItemToStringArray::CreateSP(this, &SGASGameplayEffectsTab::PopulateSearchStrings));
+	FlatSearchFilter = MakeShared<FGASGameplayEffectFlatTextFilter>(FGASGameplayEffectFlatTextFilter::FItemToStringArray::CreateSP(this, &SGASGameplayEffectsTab::PopulateFlatSearchStrings));
 
 	LoadSettings();
 
@@ -54,6 +60,17 @@ void SGASGameplayEffectsTab::Construct(const FArguments& InArgs)
 			[
 				CreateStateSettingsCheckBox(EGameplayEffectStateType::Infinite)
 			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(8.f, 0.f, 0.f, 0.f)
+			[
+				CreateFlatViewCheckBox()
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				CreateGroupByEffectCheckBox()
+			]
 		]
 		+ SVerticalBox::Slot()
 		.AutoHeight()
@@ -64,88 +81,187 @@ void SGASGameplayEffectsTab::Construct(const FArguments& InArgs)
 		+ SVerticalBox::Slot()
 		.FillHeight(1.f)
 		[
-			SNew(SBorder)
-			.Padding(0.f)
+			SNew(SWidgetSwitcher)
+			.WidgetIndex_Lambda([this]
+			{
+				return bFlatView ? 1 : 0;
+			})
+			+ SWidgetSwitcher::Slot()
 			[
-				SAssignNew(GameplayEffectsTree, SGameplayEffectsTree)
-				.TreeItemsSource(&FilteredGameplayEffectsList)
-				.OnGenerateRow_Lambda([this](TSharedPtr<FGASGameplayEffectNodeBase> Item, const TSharedRef<STableViewBase>& OwnerTable)
-				{
-					return
-						SNew(SGASGameplayEffectTreeItem, OwnerTable)
-						.WidgetInfoToVisualize(Item)
-						.HighlightText(this, &SGASGameplayEffectsTab::GetHighlightText);
-				})
-				.OnGetChildren_Lambda([this](TSharedPtr<FGASGameplayEffectNodeBase> Item, TArray<TSharedPtr<FGASGameplayEffectNodeBase>>& OutChildren)
-				{
-					// A directly matching effect shows all of its modifiers; otherwise only the matching ones
-					const bool bParentMatches = MatchesText(*Item);
-					for (const TSharedPtr<FGASGameplayEffectNodeBase>& ChildNode : Item->GetChildNodes())
+				SNew(SBorder)
+				.Padding(0.f)
+				[
+					SAssignNew(GameplayEffectsTree, SGameplayEffectsTree)
+					.TreeItemsSource(&FilteredGameplayEffectsList)
+					.OnGenerateRow_Lambda([this](TSharedPtr<FGASGameplayEffectNodeBase> Item, const TSharedRef<STableViewBase>& OwnerTable)
+					{
+						GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GenerateRow, RefreshCost);
+
+						return
+							SNew(SGASGameplayEffectTreeItem, OwnerTable)
+							.WidgetInfoToVisualize(Item)
+							.HighlightText(this, &SGASGameplayEffectsTab::GetHighlightText);
+					})
+					.OnGetChildren_Lambda([this](TSharedPtr<FGASGameplayEffectNodeBase> Item, TArray<TSharedPtr<FGASGameplayEffectNodeBase>>& OutChildren)
 					{
-						if (bParentMatches ||
-							PassesTextFilter(ChildNode))
+						// A directly matching effect shows all of its modifiers; otherwise only the matching ones
+						const bool bParentMatches = MatchesText(*Item);
+						for (const TSharedPtr<FGASGameplayEffectNodeBase>& ChildNode : Item->GetChildNodes())
 						{
-							OutChildren.Add(ChildNode);
+							if (bParentMatches ||
+								PassesTextFilter(ChildNode))
+							{
+								OutChildren.Add(ChildNode);
+							}
 						}
-					}
-				})
-				.HighlightParentNodesForSelection(true)
-				.HeaderRow
-				(
-					SAssignNew(HeaderRow, SHeaderRow)
-					.CanSelectGeneratedColumn(true)
-					.HiddenColumnsList(HiddenColumns)
-					.OnHiddenColumnsListChanged(FSimpleDelegate::CreateSP(this, &SGASGameplayEffectsTab::SaveHiddenColumns))
-
-					+ SHeaderRow::Column(GameplayEffectNameColumn)
-					.SortMode_Lambda([this]
+					})
+					.OnExpansionChanged_Lambda([this](TSharedPtr<FGASGameplayEffectNodeBase> Item, const bool bExpanded)
 					{
-						return SortMode;
+						if (Item &&
+							bExpanded)
+						{
+							Item->GatherChildren();
+							GameplayEffectsTree->RequestTreeRefresh();
+						}
 					})
-					.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+					.HighlightParentNodesForSelection(true)
+					.HeaderRow(CreateHeaderRow(HeaderRow))
+				]
+			]
+			+ SWidgetSwitcher::Slot()
+			[
+				SNew(SBorder)
+				.Padding(0.f)
+				[
+					SAssignNew(FlatList, SGameplayEffectsFlatList)
+					.ListItemsSource(&FilteredFlatRows)
+					.OnGenerateRow_Lambda([this](const FGASGameplayEffectFlatRow* Item, const TSharedRef<STableViewBase>& OwnerTable)
 					{
-						SortMode = InSortMode;
-						SaveSettings();
-						SortGameplayEffects();
+						GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GenerateRow, RefreshCost);
+
+						return
+							SNew(SGASGameplayEffectFlatItem, OwnerTable)
+							.Row(Item)
+							.HighlightText(this, &SGASGameplayEffectsTab::GetHighlightText);
 					})
-					.DefaultLabel(LOCTEXT("GameplayEffectNameColumn", "Name"))
-					.DefaultTooltip(LOCTEXT("GameplayEffectNameColumnToolTip", "Gameplay Effect Name / Bonus Attribute"))
-					.FillWidth(.2f)
-
-					+ SHeaderRow::Column(GameplayEffectStateColumn)
-					.DefaultLabel(LOCTEXT("GameplayEffectStateColumn", "State"))
-					.FillWidth(.1f)
-
-					+ SHeaderRow::Column(GameplayEffectDurationColumn)
-					.DefaultLabel(LOCTEXT("GameplayEffectDurationColumn", "Duration"))
-					.FillWidth(.3f)
-
-					+ SHeaderRow::Column(GameplayEffectStackColumn)
-					.DefaultLabel(LOCTEXT("GameplayEffectStackColumn", "Stack"))
-					.FillWidth(.1f)
-
-					+ SHeaderRow::Column(GameplayEffectLevelColumn)
-					.DefaultLabel(LOCTEXT("GameplayEffectLevelColumn", "Level"))
-					.FillWidth(.1f)
-
-					+ SHeaderRow::Column(GameplayEffectPredictionColumn)
-					.DefaultLabel(LOCTEXT("GameplayEffectPredictionColumn", "Prediction"))
-					.DefaultTooltip(LOCTEXT("GameplayEffectPredictionColumnToolTip", "Client prediction state of this effect"))
-					.FillWidth(.15f)
-
-					+ SHeaderRow::Column(GameplayEffectGrantedTagsColumn)
-					.DefaultLabel(LOCTEXT("GameplayEffectGrantedTagsColumn", "Granted Tags"))
-					.FillWidth(.2f)
-				)
+					.HeaderRow(CreateHeaderRow(FlatHeaderRow))
+				]
 			]
 		]
 	];
 }
 
+TSharedRef<SHeaderRow> SGASGameplayEffectsTab::CreateHeaderRow(TSharedPtr<SHeaderRow>& OutHeaderRow)
+{
+	const bool bFlatHeaderRow = &OutHeaderRow == &FlatHeaderRow;
+
+	return
+		SAssignNew(OutHeaderRow, SHeaderRow)
+		.CanSelectGeneratedColumn(true)
+		.HiddenColumnsList(HiddenColumns)
+		.OnHiddenColumnsListChanged(FSimpleDelegate::CreateSP(this, &SGASGameplayEffectsTab::SaveHiddenColumns, bFlatHeaderRow))
+
+		+ SHeaderRow::Column(GameplayEffectNameColumn)
+		.SortMode_Lambda([this]
+		{
+			return SortMode;
+		})
+		.OnSort_Lambda([this](const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+		{
+			SortMode = InSortMode;
+			SaveSettings();
+
+			if (bFlatView &&
+				bShowingSnapshot)
+			{
+				RefreshLastSnapshot();
+			}
+			else if (bFlatView)
+			{
+				RefreshFlat(WeakComponent.Get(), LastWorldContextHandle);
+			}
+			else
+			{
+				SortGameplayEffects();
+			}
+		})
+		.DefaultLabel(LOCTEXT("GameplayEffectNameColumn", "Name"))
+		.DefaultTooltip(LOCTEXT("GameplayEffectNameColumnToolTip", "Gameplay Effect Name / Bonus Attribute"))
+		.FillWidth(.2f)
+
+		+ SHeaderRow::Column(GameplayEffectStateColumn)
+		.DefaultLabel(LOCTEXT("GameplayEffectStateColumn", "State"))
+		.FillWidth(.1f)
+
+		+ SHeaderRow::Column(GameplayEffectDurationColumn)
+		.DefaultLabel(LOCTEXT("GameplayEffectDurationColumn", "Duration"))
+		.FillWidth(.3f)
+
+		+ SHeaderRow::Column(GameplayEffectStackColumn)
+		.DefaultLabel(LOCTEXT("GameplayEffectStackColumn", "Stack"))
+		.FillWidth(.1f)
+
+		+ SHeaderRow::Column(GameplayEffectLevelColumn)
+		.DefaultLabel(LOCTEXT("GameplayEffectLevelColumn", "Level"))
+		.FillWidth(.1f)
+
+		+ SHeaderRow::Column(GameplayEffectPredictionColumn)
+		.DefaultLabel(LOCTEXT("GameplayEffectPredictionColumn", "Prediction"))
+		.DefaultTooltip(LOCTEXT("GameplayEffectPredictionColumnToolTip", "Client prediction state of this effect"))
+		.FillWidth(.15f)
+
+		+ SHeaderRow::Column(GameplayEffectGrantedTagsColumn)
+		.DefaultLabel(LOCTEXT("GameplayEffectGrantedTagsColumn", "Granted Tags"))
+		.FillWidth(.2f);
+}
+
 void SGASGameplayEffectsTab::Refresh(UAbilitySystemComponent* Component, const FName WorldContextHandle)
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GameplayEffectsRefresh, RefreshCost);
+
+	WeakComponent = Component;
+	LastWorldContextHandle = WorldContextHandle;
+
+	bShowingSnapshot = false;
+	MappedSnapshotEffects.Reset();
+	LastSnapshotComponent = FGASComponentSnapshot();
+	LastSnapshotDiff = FGASComponentDiff();
+	bHasSnapshotComponent = false;
+	bHasSnapshotDiff = false;
+
+	if (bFlatView)
+	{
+		RefreshFlat(Component, WorldContextHandle);
+	}
+	else
+	{
+		RefreshTree(Component, WorldContextHandle);
+	}
+}
+
+void SGASGameplayEffectsTab::RefreshTree(UAbilitySystemComponent* Component, const FName WorldContextHandle)
+{
+	// The flat view's rows are not kept around while the tree is shown
+	ResetFlatRows();
+
 	GameplayEffectsList.Reset();
 
+	// Rows skipped by the window would keep going without the fields asked for
+	const EGASGameplayEffectFields PreviousFields = GatheredFields;
+	GatheredFields = GetGatherFields();
+
+	RowWindow.BeginRefresh(ShouldUpdateEveryRow() || EnumHasAnyFlags(GatheredFields, ~PreviousFields));
+
+	if (bGroupByEffect)
+	{
+		RefreshGroups(Component, WorldContextHandle);
+		SortGameplayEffects();
+		return;
+	}
+
+	// Instance nodes of the grouped view are owned by their groups
+	MappedGroups.Reset();
+
 	TSet<FActiveGameplayEffectHandle> UnusedAbilities;
 	MappedGameplayEffects.GetKeys(UnusedAbilities);
 
@@ -158,12 +274,15 @@ void SGASGameplayEffectsTab::Refresh(UAbilitySystemComponent* Component, const F
 			UnusedAbilities.Remove(ActiveGameplayEffect.Handle);
 			if (const TSharedPtr<FGASGameplayEffectNodeBase>& AbilityNode = MappedGameplayEffects.FindRef(ActiveGameplayEffect.Handle))
 			{
-				AbilityNode->Update();
+				if (RowWindow.ShouldUpdate(GameplayEffectsTree->WidgetFromItem(AbilityNode).IsValid()))
+				{
+					AbilityNode->Update(GatheredFields, ShouldGatherChildren(AbilityNode));
+				}
 				continue;
 			}
 
-			TSharedRef<FGASGameplayEffectNode> NewItem = MakeShared<FGASGameplayEffectNode>(WorldContextHandle, Component, ActiveGameplayEffect.Handle);
-			NewItem->Update();
+			TSharedRef<FGASGameplayEffectNode> NewItem = NodePool.Make<FGASGameplayEffectNode>(NodePool, WorldContextHandle, Component, ActiveGameplayEffect.Handle);
+			NewItem->Update(GatheredFields, ShouldGatherChildren(NewItem));
 
 			MappedGameplayEffects.Add(ActiveGameplayEffect.Handle, NewItem);
 		}
@@ -179,6 +298,371 @@ void SGASGameplayEffectsTab::Refresh(UAbilitySystemComponent* Component, const F
 	SortGameplayEffects();
 }
 
+void SGASGameplayEffectsTab::RefreshGroups(UAbilitySystemComponent* Component, const FName WorldContextHandle)
+{
+	// Instance nodes now live inside their group
+	MappedGameplayEffects.Reset();
+
+	for (const TPair<TObjectKey<UGameplayEffect>, TSharedPtr<FGASGameplayEffectGroupNode>>& It : MappedGroups)
+	{
+		It.Value->ResetInstances();
+	}
+
+	if (Component)
+	{
+		const UWorld* World = nullptr;
+		if (const FWorldContext* WorldContext = GEngine->GetWorldContextFromHandle(WorldContextHandle))
+		{
+			World = WorldContext->World();
+		}
+		const float WorldTime = World ? World->GetTimeSeconds() : 0.f;
+
+		// Only a few numbers are read per instance; nodes and text are per group
+		for (auto It = Component->GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+		{
+			const FActiveGameplayEffect& ActiveGameplayEffect = *It;
+			const UGameplayEffect* Def = ActiveGameplayEffect.Spec.Def;
+
+			TSharedPtr<FGASGameplayEffectGroupNode>& GroupNode = MappedGroups.FindOrAdd(Def);
+			if (!GroupNode)
+			{
+				GroupNode = NodePool.Make<FGASGameplayEffectGroupNode>(NodePool, WorldContextHandle, Component, Def,
+					[this](const TSharedPtr<FGASGameplayEffectNodeBase>& InstanceNode)
+					{
+						return ShouldGatherChildren(InstanceNode);
+					});
+			}
+
+			GroupNode->AddInstance(ActiveGameplayEffect, WorldTime);
+		}
+	}
+
+	for (auto It = MappedGroups.CreateIterator(); It; ++It)
+	{
+		const TSharedPtr<FGASGameplayEffectGroupNode> GroupNode = It.Value();
+		if (GroupNode->GetNumInstances() == 0)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		GroupNode->Update(GatheredFields, ShouldGatherChildren(GroupNode));
+		GameplayEffectsList.Add(GroupNode);
+	}
+}
+
+void SGASGameplayEffectsTab::RefreshFlat(UAbilitySystemComponent* Component, const FName WorldContextHandle)
+{
+	// The tree's nodes are not kept around while the flat view is shown
+	MappedGameplayEffects.Reset();
+	MappedGroups.Reset();
+	GameplayEffectsList.Reset();
+	FilteredGameplayEffectsList.Reset();
+
+	BeginFlatRefresh();
+
+	FlatRows.Reset();
+	SortedFlatEffects.Reset();
+
+	int32 NumRows = 0;
+	if (Component)
+	{
+		for (auto It = Component->GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+		{
+			SortedFlatEffects.Add(&*It);
+			NumRows += 1 + It->Spec.Modifiers.Num();
+		}
+	}
+
+	if (SortMode != EColumnSortMode::None)
+	{
+		GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_Sort);
+
+		const bool bAscending = SortMode == EColumnSortMode::Ascending;
+		SortedFlatEffects.Sort([bAscending](const FActiveGameplayEffect& A, const FActiveGameplayEffect& B)
+		{
+			// Lexical FName compare - no string is built per comparison
+			const int32 Result = GetFNameSafe(A.Spec.Def).Compare(GetFNameSafe(B.Spec.Def));
+			return bAscending ? Result < 0 : Result > 0;
+		});
+	}
+
+	const UWorld* World = nullptr;
+	if (const FWorldContext* WorldContext = GEngine->GetWorldContextFromHandle(WorldContextHandle))
+	{
+		World = WorldContext->World();
+	}
+
+	FlatRows.Reserve(NumRows);
+
+	for (const FActiveGameplayEffect* ActiveGameplayEffect : SortedFlatEffects)
+	{
+		const FGameplayEffectSpec& Spec = ActiveGameplayEffect->Spec;
+
+		const int32 EffectIndex = FlatRows.AddDefaulted();
+		{
+			FGASGameplayEffectFlatRow& Row = FlatRows[EffectIndex];
+			Row.Handle = ActiveGameplayEffect->Handle;
+			Row.HandleId = GetTypeHash(ActiveGameplayEffect->Handle);
+			Row.Def = Spec.Def;
+			Row.Duration = ActiveGameplayEffect->GetDuration();
+			Row.Countdown.Sync(World, ActiveGameplayEffect->StartWorldTime, Row.Duration);
+			Row.Period = ActiveGameplayEffect->GetPeriod();
+			Row.Level = Spec.GetLevel();
+			Row.StackCount = Spec.GetStackCount();
+			Row.bInhibited = ActiveGameplayEffect->bIsInhibited;
+			Row.bPredicted = ActiveGameplayEffect->PredictionKey.IsValidKey();
+			Row.bPredictedLocally = ActiveGameplayEffect->PredictionKey.WasLocallyGenerated();
+
+			if (Row.bInhibited)
+			{
+				Row.StateType = EGameplayEffectStateType::Inhibited;
+			}
+			else if (Row.Duration <= 0.f)
+			{
+				Row.StateType = EGameplayEffectStateType::Infinite;
+			}
+		}
+
+		if (!Spec.Def)
+		{
+			continue;
+		}
+
+		const int32 NumModifiers = FMath::Min(Spec.Modifiers.Num(), Spec.Def->Modifiers.Num());
+		for (int32 ModifierIndex = 0; ModifierIndex < NumModifiers; ++ModifierIndex)
+		{
+			FGASGameplayEffectFlatRow& Row = FlatRows.AddDefaulted_GetRef();
+			Row.Handle = ActiveGameplayEffect->Handle;
+			Row.HandleId = FlatRows[EffectIndex].HandleId;
+			Row.Def = Spec.Def;
+			Row.ParentIndex = EffectIndex;
+			Row.ModifierIndex = ModifierIndex;
+			Row.Magnitude = Spec.Modifiers[ModifierIndex].GetEvaluatedMagnitude();
+			Row.bInhibited = FlatRows[EffectIndex].bInhibited;
+			Row.StateType = FlatRows[EffectIndex].StateType;
+		}
+	}
+
+	EndFlatRefresh();
+}
+
+void SGASGameplayEffectsTab::Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff)
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GameplayEffectsRefresh, RefreshCost);
+
+	WeakComponent = nullptr;
+	LastWorldContextHandle = NAME_None;
+
+	// Called again with what was kept by RefreshLastSnapshot
+	if (&World != &LastSnapshotWorld)
+	{
+		LastSnapshotWorld.Frame = World.Frame;
+		LastSnapshotWorld.WorldTime = World.WorldTime;
+		LastSnapshotWorld.TimeDilation = World.TimeDilation;
+		LastSnapshotWorld.LocalTime = World.LocalTime;
+		LastSnapshotWorld.Source = World.Source;
+	}
+
+	if (Component != &LastSnapshotComponent)
+	{
+		bHasSnapshotComponent = Component != nullptr;
+		LastSnapshotComponent = Component ? *Component : FGASComponentSnapshot();
+	}
+
+	if (Diff != &LastSnapshotDiff)
+	{
+		bHasSnapshotDiff = Diff != nullptr;
+		LastSnapshotDiff = Diff ? *Diff : FGASComponentDiff();
+	}
+
+	// Live nodes read from a component that isn't there
+	if (!bShowingSnapshot)
+	{
+		bShowingSnapshot = true;
+		MappedGameplayEffects.Reset();
+		MappedGroups.Reset();
+	}
+
+	if (bFlatView)
+	{
+		MappedSnapshotEffects.Reset();
+		RefreshSnapshotFlat(World, Component, Diff);
+	}
+	else
+	{
+		RefreshSnapshotTree(World, Component, Diff);
+	}
+}
+
+void SGASGameplayEffectsTab::RefreshSnapshotTree(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff)
+{
+	ResetFlatRows();
+
+	GameplayEffectsList.Reset();
+
+	const EGASGameplayEffectFields PreviousFields = GatheredFields;
+	GatheredFields = GetGatherFields();
+
+	RowWindow.BeginRefresh(ShouldUpdateEveryRow() || EnumHasAnyFlags(GatheredFields, ~PreviousFields));
+
+	TSet<uint32> UnusedEffects;
+	MappedSnapshotEffects.GetKeys(UnusedEffects);
+
+	if (Component)
+	{
+		for (const FGASEffectSnapshot& Effect : Component->Effects)
+		{
+			const EGASDiffChange DiffChange = Diff ? GetDiffChange(Diff->FindEffect(Effect.Def)) : EGASDiffChange::Unchanged;
+
+			UnusedEffects.Remove(Effect.Handle);
+			if (const TSharedPtr<FGASGameplayEffectSnapshotNode>& EffectNode = MappedSnapshotEffects.FindRef(Effect.Handle))
+			{
+				if (RowWindow.ShouldUpdate(GameplayEffectsTree->WidgetFromItem(EffectNode).IsValid()))
+				{
+					EffectNode->SetSnapshot(World, Effect);
+					EffectNode->Update(GatheredFields, ShouldGatherChildren(EffectNode));
+				}
+				EffectNode->SetDiffChange(DiffChange);
+				continue;
+			}
+
+			TSharedRef<FGASGameplayEffectSnapshotNode> NewItem = NodePool.Make<FGASGameplayEffectSnapshotNode>(NodePool);
+			NewItem->SetSnapshot(World, Effect);
+			NewItem->Update(GatheredFields, ShouldGatherChildren(NewItem));
+			NewItem->SetDiffChange(DiffChange);
+
+			MappedSnapshotEffects.Add(Effect.Handle, NewItem);
+		}
+	}
+
+	for (const uint32 UnusedEffect : UnusedEffects)
+	{
+		MappedSnapshotEffects.Remove(UnusedEffect);
+	}
+
+	for (const TPair<uint32, TSharedPtr<FGASGameplayEffectSnapshotNode>>& It : MappedSnapshotEffects)
+	{
+		GameplayEffectsList.Add(It.Value);
+	}
+
+	SortGameplayEffects();
+}
+
+void SGASGameplayEffectsTab::RefreshSnapshotFlat(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff)
+{
+	GameplayEffectsList.Reset();
+	FilteredGameplayEffectsList.Reset();
+
+	BeginFlatRefresh();
+
+	FlatRows.Reset();
+	SortedFlatEffects.Reset();
+
+	struct FSnapshotEffect
+	{
+		const FGASEffectSnapshot* Effect;
+		const UGameplayEffect* Def;
+	};
+
+	TArray<FSnapshotEffect> SortedEffects;
+	int32 NumRows = 0;
+	if (Component)
+	{
+		SortedEffects.Reserve(Component->Effects.Num());
+		for (const FGASEffectSnapshot& Effect : Component->Effects)
+		{
+			const UClass* DefClass = FGASWorldSnapshot::ResolveClass(Effect.Def);
+			SortedEffects.Add({ &Effect, DefClass ? Cast<UGameplayEffect>(DefClass->GetDefaultObject()) : nullptr });
+			NumRows += 1 + Effect.Modifiers.Num();
+		}
+	}
+
+	if (SortMode != EColumnSortMode::None)
+	{
+		GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_Sort);
+
+		const bool bAscending = SortMode == EColumnSortMode::Ascending;
+		SortedEffects.Sort([bAscending](const FSnapshotEffect& A, const FSnapshotEffect& B)
+		{
+			const int32 Result = GetFNameSafe(A.Def).Compare(GetFNameSafe(B.Def));
+			return bAscending ? Result < 0 : Result > 0;
+		});
+	}
+
+	FlatRows.Reserve(NumRows);
+
+	for (const FSnapshotEffect& SortedEffect : SortedEffects)
+	{
+		const FGASEffectSnapshot& Effect = *SortedEffect.Effect;
+
+		const int32 EffectIndex = FlatRows.AddDefaulted();
+		{
+			FGASGameplayEffectFlatRow& Row = FlatRows[EffectIndex];
+			Row.HandleId = Effect.Handle;
+			Row.Def = SortedEffect.Def;
+			Row.Duration = Effect.Duration;
+			Row.Countdown.SyncRemote(World.WorldTime, World.LocalTime, World.TimeDilation, Effect.StartWorldTime, Effect.Duration);
+			Row.Period = Effect.Period;
+			Row.Level = Effect.Level;
+			Row.StackCount = Effect.StackCount;
+			Row.bInhibited = Effect.bInhibited;
+			Row.bPredicted = Effect.bPredicted;
+			Row.bPredictedLocally = Effect.bPredictedLocally;
+			Row.DiffChange = Diff ? GetDiffChange(Diff->FindEffect(Effect.Def)) : EGASDiffChange::Unchanged;
+
+			if (Row.bInhibited)
+			{
+				Row.StateType = EGameplayEffectStateType::Inhibited;
+			}
+			else if (Row.Duration <= 0.f)
+			{
+				Row.StateType = EGameplayEffectStateType::Infinite;
+			}
+		}
+
+		if (!SortedEffect.Def)
+		{
+			continue;
+		}
+
+		const int32 NumModifiers = FMath::Min(Effect.Modifiers.Num(), SortedEffect.Def->Modifiers.Num());
+		for (int32 ModifierIndex = 0; ModifierIndex < NumModifiers; ++ModifierIndex)
+		{
+			FGASGameplayEffectFlatRow& Row = FlatRows.AddDefaulted_GetRef();
+			Row.HandleId = Effect.Handle;
+			Row.Def = SortedEffect.Def;
+			Row.ParentIndex = EffectIndex;
+			Row.ModifierIndex = ModifierIndex;
+			Row.Magnitude = Effect.Modifiers[ModifierIndex];
+			Row.bInhibited = FlatRows[EffectIndex].bInhibited;
+			Row.StateType = FlatRows[EffectIndex].StateType;
+			Row.DiffChange = FlatRows[EffectIndex].DiffChange;
+		}
+	}
+
+	EndFlatRefresh();
+}
+
+void SGASGameplayEffectsTab::RefreshAfterViewChange()
+{
+	if (bShowingSnapshot)
+	{
+		RefreshLastSnapshot();
+		return;
+	}
+
+	Refresh(WeakComponent.Get(), LastWorldContextHandle);
+}
+
+void SGASGameplayEffectsTab::RefreshLastSnapshot()
+{
+	Refresh(
+		LastSnapshotWorld,
+		bHasSnapshotComponent ? &LastSnapshotComponent : nullptr,
+		bHasSnapshotDiff ? &LastSnapshotDiff : nullptr);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -189,12 +673,33 @@ TSharedRef<SWidget> SGASGameplayEffectsTab::CreateSearchBox()
 		SAssignNew(SearchBox, SSearchBox)
 		.HintText(LOCTEXT("GameplayEffectSearchHint", "Search effects, states and granted tags"))
 		.DelayChangeNotificationsWhileTyping(true)
-		.OnTextChanged_Lambda([this](const FText& NewText)
-		{
-			SearchFilter->SetRawFilterText(NewText);
-			SearchBox->SetError(SearchFilter->GetFilterErrorText());
-			ApplyFilter();
-		});
+		.OnTextChanged(this, &SGASGameplayEffectsTab::SetSearchText);
+}
+
+void SGASGameplayEffectsTab::SetSearchText(const FText& InSearchText)
+{
+	if (!SearchBox->GetText().EqualTo(InSearchText))
+	{
+		SearchBox->SetText(InSearchText);
+	}
+
+	SearchFilter->SetRawFilterText(InSearchText);
+	FlatSearchFilter->SetRawFilterText(InSearchText);
+	SearchBox->SetError(SearchFilter->GetFilterErrorText());
+
+	if (bFlatView)
+	{
+		ApplyFlatFilter();
+	}
+	else if (EnumHasAnyFlags(GetGatherFields(), ~GatheredFields))
+	{
+		// Searching looks at fields hidden columns skipped - gather them, the refresh filters as well
+		RefreshGatherFields();
+	}
+	else
+	{
+		ApplyFilter();
+	}
 }
 
 TSharedRef<SCheckBox> SGASGameplayEffectsTab::CreateStateSettingsCheckBox(const EGameplayEffectStateType::Type StateType)
@@ -237,7 +742,15 @@ TSharedRef<SCheckBox> SGASGameplayEffectsTab::CreateStateSettingsCheckBox(const
 			}
 
 			SaveSettings();
-			ApplyFilter();
+
+			if (bFlatView)
+			{
+				ApplyFlatFilter();
+			}
+			else
+			{
+				ApplyFilter();
+			}
 		})
 		[
 			SNew(SBox)
@@ -250,8 +763,70 @@ TSharedRef<SCheckBox> SGASGameplayEffectsTab::CreateStateSettingsCheckBox(const
 		];
 }
 
+TSharedRef<SCheckBox> SGASGameplayEffectsTab::CreateFlatViewCheckBox()
+{
+	return
+		SNew(SCheckBox)
+		.Padding(FMargin(4.f, 0.f))
+		.ToolTipText(LOCTEXT("GameplayEffectFlatViewToolTip", "Show effects and their modifiers as one flat list of plain rows. Scales with the visible rows rather than the number of effects - use it for components carrying thousands of effects."))
+		.IsChecked_Lambda([this]
+		{
+			return bFlatView ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		})
+		.OnCheckStateChanged_Lambda([this](const ECheckBoxState NewValue)
+		{
+			bFlatView = NewValue == ECheckBoxState::Checked;
+			SaveSettings();
+
+			RefreshAfterViewChange();
+		})
+		[
+			SNew(SBox)
+			.MinDesiredWidth(80.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("GameplayEffectFlatView", "Flat View"))
+			]
+		];
+}
+
+TSharedRef<SCheckBox> SGASGameplayEffectsTab::CreateGroupByEffectCheckBox()
+{
+	return
+		SNew(SCheckBox)
+		.Padding(FMargin(4.f, 0.f))
+		.ToolTipText(LOCTEXT("GameplayEffectGroupByEffectToolTip", "Show one row per Gameplay Effect class, with its instance count, total stacks, remaining time and level range. Expand a row for its instances."))
+		.IsEnabled_Lambda([this]
+		{
+			return !bFlatView;
+		})
+		.IsChecked_Lambda([this]
+		{
+			return bGroupByEffect ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		})
+		.OnCheckStateChanged_Lambda([this](const ECheckBoxState NewValue)
+		{
+			bGroupByEffect = NewValue == ECheckBoxState::Checked;
+			SaveSettings();
+
+			RefreshAfterViewChange();
+		})
+		[
+			SNew(SBox)
+			.MinDesiredWidth(80.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("GameplayEffectGroupByEffect", "Group by Effect"))
+			]
+		];
+}
+
 void SGASGameplayEffectsTab::SortGameplayEffects()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Sort, RefreshCost);
+
 	if (SortMode == EColumnSortMode::Ascending)
 	{
 		GameplayEffectsList.Sort([](const TSharedPtr<FGASGameplayEffectNodeBase>& A, const TSharedPtr<FGASGameplayEffectNodeBase>& B)
@@ -291,6 +866,22 @@ bool SGASGameplayEffectsTab::IsFilterActive() const
 	return !SearchFilter->GetRawFilterText().IsEmpty();
 }
 
+bool SGASGameplayEffectsTab::ShouldGatherChildren(const TSharedPtr<FGASGameplayEffectNodeBase>& Node) const
+{
+	return
+		IsFilterActive() ||
+		GameplayEffectsTree->IsItemExpanded(Node);
+}
+
+bool SGASGameplayEffectsTab::ShouldUpdateEveryRow() const
+{
+	// Filtering by state or text decides about rows nobody is looking at
+	constexpr uint8 AllStateTypes = EGameplayEffectStateType::Active | EGameplayEffectStateType::Inhibited | EGameplayEffectStateType::Infinite;
+	return
+		IsFilterActive() ||
+		(VisibleStateTypes & AllStateTypes) != AllStateTypes;
+}
+
 bool SGASGameplayEffectsTab::MatchesText(const FGASGameplayEffectNodeBase& Node) const
 {
 	return SearchFilter->PassesFilter(Node);
@@ -321,6 +912,8 @@ bool SGASGameplayEffectsTab::PassesTextFilter(const TSharedPtr<FGASGameplayEffec
 
 void SGASGameplayEffectsTab::ApplyFilter()
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Filter, RefreshCost);
+
 	FilteredGameplayEffectsList.Reset();
 
 	const bool bFilterActive = IsFilterActive();
@@ -336,6 +929,12 @@ void SGASGameplayEffectsTab::ApplyFilter()
 			continue;
 		}
 
+		// The search looks at modifiers of collapsed rows too
+		if (bFilterActive)
+		{
+			GameplayEffectNode->GatherChildren();
+		}
+
 		if (!PassesTextFilter(GameplayEffectNode))
 		{
 			continue;
@@ -353,6 +952,149 @@ void SGASGameplayEffectsTab::ApplyFilter()
 	GameplayEffectsTree->RequestTreeRefresh();
 }
 
+void SGASGameplayEffectsTab::PopulateFlatSearchStrings(const FGASGameplayEffectFlatRow& Row, TArray<FString>& OutSearchStrings) const
+{
+	OutSearchStrings.Add(Row.GetName().ToString());
+	OutSearchStrings.Add(Row.GetState().ToString());
+	OutSearchStrings.Add(Row.GetGrantedTags().ToString());
+}
+
+bool SGASGameplayEffectsTab::FlatRowPassesTextFilter(const int32 RowIndex) const
+{
+	if (FlatSearchFilter->PassesFilter(FlatRows[RowIndex]))
+	{
+		return true;
+	}
+
+	for (int32 Index = RowIndex + 1; Index < FlatRows.Num() && FlatRows[Index].IsModifier(); ++Index)
+	{
+		if (FlatSearchFilter->PassesFilter(FlatRows[Index]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SGASGameplayEffectsTab::ApplyFlatFilter()
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Filter, RefreshCost);
+
+	FilteredFlatRows.Reset();
+
+	const bool bFilterActive = IsFilterActive();
+
+	bool bEffectVisible = false;
+	bool bEffectMatches = false;
+	for (int32 Index = 0; Index < FlatRows.Num(); ++Index)
+	{
+		const FGASGameplayEffectFlatRow& Row = FlatRows[Index];
+
+		if (!Row.IsModifier())
+		{
+			bEffectVisible =
+				(VisibleStateTypes & Row.StateType) != 0 &&
+				(!bFilterActive || FlatRowPassesTextFilter(Index));
+
+			bEffectMatches =
+				bEffectVisible &&
+				(!bFilterActive || FlatSearchFilter->PassesFilter(Row));
+
+			if (bEffectVisible)
+			{
+				FilteredFlatRows.Add(&Row);
+			}
+			continue;
+		}
+
+		// A directly matching effect shows all of its modifiers; otherwise only the matching ones
+		if (bEffectVisible &&
+			(bEffectMatches || FlatSearchFilter->PassesFilter(Row)))
+		{
+			FilteredFlatRows.Add(&Row);
+		}
+	}
+
+	FlatList->RequestListRefresh();
+}
+
+void SGASGameplayEffectsTab::BeginFlatRefresh()
+{
+	SelectedFlatRowKeys.Reset();
+	for (const FGASGameplayEffectFlatRow* Row : FlatList->GetSelectedItems())
+	{
+		SelectedFlatRowKeys.Add(Row->GetKey());
+	}
+
+	const float ScrollOffset = static_cast<float>(FlatList->GetScrollOffset());
+	const int32 TopIndex = FMath::FloorToInt32(ScrollOffset);
+
+	bHasTopFlatRow = FilteredFlatRows.IsValidIndex(TopIndex);
+	if (bHasTopFlatRow)
+	{
+		TopFlatRowKey = FilteredFlatRows[TopIndex]->GetKey();
+		TopFlatRowFraction = ScrollOffset - TopIndex;
+	}
+}
+
+void SGASGameplayEffectsTab::EndFlatRefresh()
+{
+	ApplyFlatFilter();
+
+	bool bLayoutChanged =
+		FlatRows.GetData() != FlatRowsData ||
+		FlatRowKeys.Num() != FlatRows.Num();
+
+	FlatRowKeys.SetNumUninitialized(FlatRows.Num());
+	for (int32 Index = 0; Index < FlatRows.Num(); ++Index)
+	{
+		const uint64 Key = FlatRows[Index].GetKey();
+		bLayoutChanged |= FlatRowKeys[Index] != Key;
+		FlatRowKeys[Index] = Key;
+	}
+	FlatRowsData = FlatRows.GetData();
+
+	// Same rows in the same slots - the widgets already show the right ones
+	if (!bLayoutChanged)
+	{
+		return;
+	}
+
+	FlatList->RebuildList();
+	FlatList->ClearSelection();
+
+	for (int32 Index = 0; Index < FilteredFlatRows.Num(); ++Index)
+	{
+		const FGASGameplayEffectFlatRow* Row = FilteredFlatRows[Index];
+		const uint64 Key = Row->GetKey();
+
+		if (SelectedFlatRowKeys.Contains(Key))
+		{
+			FlatList->SetItemSelection(Row, true, ESelectInfo::Direct);
+		}
+
+		if (bHasTopFlatRow &&
+			Key == TopFlatRowKey)
+		{
+			FlatList->SetScrollOffset(static_cast<float>(Index) + TopFlatRowFraction);
+		}
+	}
+}
+
+void SGASGameplayEffectsTab::ResetFlatRows()
+{
+	if (FlatRows.Num() > 0)
+	{
+		FlatRows.Empty();
+		FilteredFlatRows.Empty();
+		SortedFlatEffects.Empty();
+		FlatRowKeys.Empty();
+		FlatRowsData = nullptr;
+		FlatList->RebuildList();
+	}
+}
+
 void SGASGameplayEffectsTab::LoadSettings()
 {
 	TSet<FName> HiddenColumnSet;
@@ -361,24 +1103,89 @@ void SGASGameplayEffectsTab::LoadSettings()
 
 	VisibleStateTypes = uint8(FGASAttachEditorSettings::LoadInt(VisibleStatesKey, EGameplayEffectStateType::MAX));
 	SortMode = FGASAttachEditorSettings::LoadSortMode(SortModeKey);
+	bFlatView = FGASAttachEditorSettings::LoadBool(FlatViewKey, false);
+	bGroupByEffect = FGASAttachEditorSettings::LoadBool(GroupByEffectKey, false);
 }
 
 void SGASGameplayEffectsTab::SaveSettings() const
 {
 	FGASAttachEditorSettings::SaveInt(VisibleStatesKey, VisibleStateTypes);
 	FGASAttachEditorSettings::SaveSortMode(SortModeKey, SortMode);
+	FGASAttachEditorSettings::SaveBool(FlatViewKey, bFlatView);
+	FGASAttachEditorSettings::SaveBool(GroupByEffectKey, bGroupByEffect);
 }
 
-void SGASGameplayEffectsTab::SaveHiddenColumns()
+void SGASGameplayEffectsTab::SaveHiddenColumns(const bool bFlatHeaderRow)
 {
-	if (!HeaderRow)
+	const TSharedPtr<SHeaderRow>& ChangedHeaderRow = bFlatHeaderRow ? FlatHeaderRow : HeaderRow;
+	const TSharedPtr<SHeaderRow>& OtherHeaderRow = bFlatHeaderRow ? HeaderRow : FlatHeaderRow;
+	if (!ChangedHeaderRow ||
+		bSyncingHiddenColumns)
 	{
 		return;
 	}
 
-	HiddenColumns = HeaderRow->GetHiddenColumnIds();
+	HiddenColumns = ChangedHeaderRow->GetHiddenColumnIds();
+
+	// Both views share one set of hidden columns
+	if (OtherHeaderRow)
+	{
+		TGuardValue<bool> SyncGuard(bSyncingHiddenColumns, true);
+		for (const SHeaderRow::FColumn& Column : OtherHeaderRow->GetColumns())
+		{
+			OtherHeaderRow->SetShowGeneratedColumn(Column.ColumnId, !HiddenColumns.Contains(Column.ColumnId));
+		}
+	}
 
 	FGASAttachEditorSettings::SaveNameSet(HiddenColumnsKey, TSet<FName>(HiddenColumns));
+
+	// A column that was just shown has nothing to display until its field is gathered
+	if (!bFlatView &&
+		EnumHasAnyFlags(GetGatherFields(), ~GatheredFields))
+	{
+		RefreshGatherFields();
+	}
+}
+
+void SGASGameplayEffectsTab::RefreshGatherFields()
+{
+	// A snapshot has every field already, but its rows are made anew with them like live ones
+	if (bShowingSnapshot)
+	{
+		RefreshLastSnapshot();
+		return;
+	}
+
+	RefreshTree(WeakComponent.Get(), LastWorldContextHandle);
+}
+
+EGASGameplayEffectFields SGASGameplayEffectsTab::GetGatherFields() const
+{
+	static const TPair<FName, EGASGameplayEffectFields> ColumnFields[] =
+	{
+		{ GameplayEffectDurationColumn, EGASGameplayEffectFields::Duration },
+		{ GameplayEffectStackColumn, EGASGameplayEffectFields::Stack },
+		{ GameplayEffectLevelColumn, EGASGameplayEffectFields::Level },
+		{ GameplayEffectPredictionColumn, EGASGameplayEffectFields::Prediction },
+		{ GameplayEffectGrantedTagsColumn, EGASGameplayEffectFields::GrantedTags },
+	};
+
+	EGASGameplayEffectFields Fields = EGASGameplayEffectFields::None;
+	for (const TPair<FName, EGASGameplayEffectFields>& ColumnField : ColumnFields)
+	{
+		if (!HiddenColumns.Contains(ColumnField.Key))
+		{
+			Fields |= ColumnField.Value;
+		}
+	}
+
+	// Granted tags are searched even while their column is hidden
+	if (IsFilterActive())
+	{
+		Fields |= EGASGameplayEffectFields::GrantedTags;
+	}
+
+	return Fields;
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -3,9 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GASAttachEditorNodePool.h"
+#include "GASAttachEditorStats.h"
+#include "GASAttachEditorCountdown.h"
+#include "GASAttachEditorRefreshScheduler.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachSnapshotDiff.h"
 #include "Widgets/SCompoundWidget.h"
 #include "ActiveGameplayEffectHandle.h"
 #include "Misc/TextFilter.h"
+#include "UObject/ObjectKey.h"
+#include "Widgets/Views/SListView.h"
 #include "Widgets/Views/STreeView.h"
 #include "Widgets/Views/SHeaderRow.h"
 
@@ -13,9 +21,16 @@ class SCheckBox;
 class SSearchBox;
 class UAbilitySystemComponent;
 class FGASGameplayEffectNodeBase;
+class FGASGameplayEffectGroupNode;
+class FGASGameplayEffectSnapshotNode;
+struct FActiveGameplayEffect;
+struct FGASGameplayEffectFlatRow;
+class UGameplayEffect;
 
 using SGameplayEffectsTree = STreeView<TSharedPtr<FGASGameplayEffectNodeBase>>;
+using SGameplayEffectsFlatList = SListView<const FGASGameplayEffectFlatRow*>;
 using FGASGameplayEffectTextFilter = TTextFilter<const FGASGameplayEffectNodeBase&>;
+using FGASGameplayEffectFlatTextFilter = TTextFilter<const FGASGameplayEffectFlatRow&>;
 
 namespace EGameplayEffectStateType
 {
@@ -28,6 +43,70 @@ namespace EGameplayEffectStateType
 	};
 };
 
+/**
+ * Node fields a refresh may skip, one per column that feeds on them.
+ *
+ * Name and state are always gathered - sorting, state filtering and row colors depend on them.
+ */
+enum class EGASGameplayEffectFields : uint8
+{
+	None		= 0,
+	Duration	= 1 << 0,
+	Stack		= 1 << 1,
+	Level		= 1 << 2,
+	Prediction	= 1 << 3,
+	GrantedTags	= 1 << 4,
+	All			= Duration | Stack | Level | Prediction | GrantedTags,
+};
+ENUM_CLASS_FLAGS(EGASGameplayEffectFields);
+
+/**
+ * One row of the flat effects view - either an active effect or one of its modifiers.
+ *
+ * Plain data kept in one contiguous array owned by the tab, with modifiers pointing back at their
+ * effect by index. Nothing is allocated per row and no text is built during a refresh - the row
+ * widget formats its cells on demand, so that cost only exists for rows that are on screen.
+ *
+ * The array is rewritten on every refresh, so a row pointer says where a row is, not which one it is;
+ * GetKey does, and the tab rebuilds the list whenever the keys in the array's slots change.
+ */
+struct FGASGameplayEffectFlatRow
+{
+	FActiveGameplayEffectHandle Handle;
+	// The handle as a snapshot carries it, so live and snapshot rows are told apart the same way
+	uint32 HandleId = 0;
+	TWeakObjectPtr<const UGameplayEffect> Def;
+
+	int32 ParentIndex = INDEX_NONE;
+	int32 ModifierIndex = INDEX_NONE;
+
+	float Duration = 0.f;
+	FGASCountdown Countdown;
+	float Period = 0.f;
+	float Level = 0.f;
+	float Magnitude = 0.f;
+	int32 StackCount = 0;
+
+	EGameplayEffectStateType::Type StateType = EGameplayEffectStateType::Active;
+	bool bInhibited = false;
+	bool bPredicted = false;
+	bool bPredictedLocally = false;
+	// Against the capture viewer's base; modifiers take their effect's
+	EGASDiffChange DiffChange = EGASDiffChange::Unchanged;
+
+	FORCEINLINE bool IsModifier() const { return ParentIndex != INDEX_NONE; }
+	FORCEINLINE uint64 GetKey() const { return (static_cast<uint64>(HandleId) << 32) | static_cast<uint32>(ModifierIndex + 1); }
+
+	FText GetName() const;
+	FText GetState() const;
+	FText GetDuration() const;
+	FText GetStack() const;
+	FText GetLevel() const;
+	FText GetPrediction() const;
+	FText GetGrantedTags() const;
+	FLinearColor GetColor() const;
+};
+
 class SGASGameplayEffectsTab : public SCompoundWidget
 {
 public:
@@ -42,14 +121,41 @@ public:
 public:
 	void Refresh(UAbilitySystemComponent* Component, FName WorldContextHandle);
 
+	/**
+	 * Shows a component of another process, as of its latest snapshot; grouping by effect falls back to the plain tree for those.
+	 * Effects in Diff are tinted.
+	 */
+	void Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff = nullptr);
+
+	/** Same as typing into the search box */
+	void SetSearchText(const FText& InSearchText);
+
+	const FGASCostCounter& GetRefreshCost() const { return RefreshCost; }
+	const FGASNodePool& GetNodePool() const { return NodePool; }
+
 private:
 	TSharedRef<SWidget> CreateSearchBox();
 	TSharedRef<SCheckBox> CreateStateSettingsCheckBox(EGameplayEffectStateType::Type StateType);
+	TSharedRef<SCheckBox> CreateFlatViewCheckBox();
+	TSharedRef<SCheckBox> CreateGroupByEffectCheckBox();
+	TSharedRef<SHeaderRow> CreateHeaderRow(TSharedPtr<SHeaderRow>& OutHeaderRow);
 
 	void SortGameplayEffects();
 
+	void RefreshTree(UAbilitySystemComponent* Component, FName WorldContextHandle);
+	void RefreshGroups(UAbilitySystemComponent* Component, FName WorldContextHandle);
+	void RefreshGatherFields();
+	EGASGameplayEffectFields GetGatherFields() const;
+	void RefreshFlat(UAbilitySystemComponent* Component, FName WorldContextHandle);
+	void RefreshSnapshotTree(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff);
+	void RefreshSnapshotFlat(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff);
+
+	/** Switching views, sorting or gathering more fields rebuilds straight away, from the last snapshot if one is shown */
+	void RefreshAfterViewChange();
+	void RefreshLastSnapshot();
+
 private:
-	void SaveHiddenColumns();
+	void SaveHiddenColumns(bool bFlatHeaderRow);
 
 	void LoadSettings();
 	void SaveSettings() const;
@@ -57,15 +163,29 @@ private:
 	static const TCHAR* VisibleStatesKey;
 	static const TCHAR* SortModeKey;
 	static const TCHAR* HiddenColumnsKey;
+	static const TCHAR* FlatViewKey;
+	static const TCHAR* GroupByEffectKey;
 
 	void PopulateSearchStrings(const FGASGameplayEffectNodeBase& Node, TArray<FString>& OutSearchStrings) const;
 	FText GetHighlightText() const;
 
 	bool IsFilterActive() const;
+	bool ShouldGatherChildren(const TSharedPtr<FGASGameplayEffectNodeBase>& Node) const;
+	bool ShouldUpdateEveryRow() const;
 	bool MatchesText(const FGASGameplayEffectNodeBase& Node) const;
 	bool PassesTextFilter(const TSharedPtr<FGASGameplayEffectNodeBase>& Node) const;
 	void ApplyFilter();
 
+	void PopulateFlatSearchStrings(const FGASGameplayEffectFlatRow& Row, TArray<FString>& OutSearchStrings) const;
+	bool FlatRowPassesTextFilter(int32 RowIndex) const;
+	void ApplyFlatFilter();
+
+	/** Remembers the selected and the topmost row by key, before the rows they point at are rewritten */
+	void BeginFlatRefresh();
+	/** Rebuilds the list if any slot now holds another row, and puts the selection and scrolling back on the same rows */
+	void EndFlatRefresh();
+	void ResetFlatRows();
+
 private:
 	TSharedPtr<SGameplayEffectsTree> GameplayEffectsTree;
 	TSharedPtr<SHeaderRow> HeaderRow;
@@ -73,6 +193,13 @@ private:
 	TSharedPtr<SSearchBox> SearchBox;
 	TSharedPtr<FGASGameplayEffectTextFilter> SearchFilter;
 
+	TSharedPtr<SGameplayEffectsFlatList> FlatList;
+	TSharedPtr<SHeaderRow> FlatHeaderRow;
+	TSharedPtr<FGASGameplayEffectFlatTextFilter> FlatSearchFilter;
+
+	bool bFlatView = false;
+	bool bGroupByEffect = false;
+	bool bSyncingHiddenColumns = false;
 	uint8 VisibleStateTypes = EGameplayEffectStateType::MAX;
 	EColumnSortMode::Type SortMode = EColumnSortMode::Ascending;
 
@@ -80,6 +207,36 @@ private:
 	TArray<TSharedPtr<FGASGameplayEffectNodeBase>> GameplayEffectsList;
 	TArray<TSharedPtr<FGASGameplayEffectNodeBase>> FilteredGameplayEffectsList;
 	TMap<FActiveGameplayEffectHandle, TSharedPtr<FGASGameplayEffectNodeBase>> MappedGameplayEffects;
+	TMap<TObjectKey<UGameplayEffect>, TSharedPtr<FGASGameplayEffectGroupNode>> MappedGroups;
+	TMap<uint32, TSharedPtr<FGASGameplayEffectSnapshotNode>> MappedSnapshotEffects;
+	FGASNodePool NodePool { TEXT("GameplayEffects") };
+	EGASGameplayEffectFields GatheredFields = EGASGameplayEffectFields::All;
+	FGASCostCounter RefreshCost;
+	FGASRowUpdateWindow RowWindow;
+
+	// Flat view - contiguous rows, modifiers follow their effect and point back at it by index
+	TArray<FGASGameplayEffectFlatRow> FlatRows;
+	TArray<const FGASGameplayEffectFlatRow*> FilteredFlatRows;
+	TArray<const FActiveGameplayEffect*> SortedFlatEffects;
+	// What the list's widgets were made for, slot by slot
+	TArray<uint64> FlatRowKeys;
+	const FGASGameplayEffectFlatRow* FlatRowsData = nullptr;
+	TSet<uint64> SelectedFlatRowKeys;
+	bool bHasTopFlatRow = false;
+	uint64 TopFlatRowKey = 0;
+	float TopFlatRowFraction = 0.f;
+
+	// Kept so switching views can rebuild straight away instead of waiting for the next refresh
+	TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
+	FName LastWorldContextHandle;
+	bool bShowingSnapshot = false;
+
+	// The same for a snapshot, copied as callers don't keep theirs; of the world only its times are needed
+	FGASWorldSnapshot LastSnapshotWorld;
+	FGASComponentSnapshot LastSnapshotComponent;
+	FGASComponentDiff LastSnapshotDiff;
+	bool bHasSnapshotComponent = false;
+	bool bHasSnapshotDiff = false;
 
 public:
 	static const FName GameplayEffectNameColumn;
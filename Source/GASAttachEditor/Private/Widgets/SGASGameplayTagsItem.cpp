@@ -2,6 +2,7 @@
 
 #include "SGASGameplayTagsItem.h"
 #include "AbilitySystemComponent.h"
+#include "GASAttachEditorDiff.h"
 #include "GameplayTagsManager.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Widgets/Input/SButton.h"
@@ -15,6 +16,13 @@ FGASTagNode::FGASTagNode(const TWeakObjectPtr<UAbilitySystemComponent>& WeakComp
 {
 }
 
+FGASTagNode::FGASTagNode(const FGameplayTag& Tag, const int32 SnapshotCount)
+	: Tag(Tag)
+	, bFromSnapshot(true)
+	, SnapshotCount(SnapshotCount)
+{
+}
+
 void FGASTagNode::Update()
 {
 	Name = GatherName();
@@ -24,6 +32,19 @@ void FGASTagNode::Update()
 
 FText FGASTagNode::GatherName() const
 {
+	if (bFromSnapshot)
+	{
+		if (SnapshotCount == INDEX_NONE)
+		{
+			return FText::FromString(Tag.ToString());
+		}
+
+		return FText::Format(
+			LOCTEXT("TagNameFormat", "{0} [{1}]"),
+			FText::FromString(Tag.ToString()),
+			FText::AsNumber(SnapshotCount));
+	}
+
 	const UAbilitySystemComponent* Component = WeakComponent.Get();
 	if (!Component)
 	{
@@ -39,7 +60,8 @@ FText FGASTagNode::GatherName() const
 FText FGASTagNode::GatherToolTip() const
 {
 	UAbilitySystemComponent* Component = WeakComponent.Get();
-	if (!Component)
+	if (!Component &&
+		!bFromSnapshot)
 	{
 		return LOCTEXT("None", "None");
 	}
@@ -68,6 +90,12 @@ FText FGASTagNode::GatherToolTip() const
 
 	ToolTipSections.Insert(Header, 0);
 
+	// The abilities of a snapshot are not around to be asked
+	if (!Component)
+	{
+		return FText::Join(FText::FromString(TEXT("\n\n")), ToolTipSections);
+	}
+
 	TArray<FText> TagAbilityNames;
 	for (const FGameplayAbilitySpec& AbilitySpec : Component->GetActivatableAbilities())
 	{
@@ -119,6 +147,11 @@ FString FGASTagNode::GatherTagName() const
 	return Tag.ToString();
 }
 
+FSlateColor FGASTagNode::GetColor() const
+{
+	return GetDiffColor(DiffChange, FLinearColor::White);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -148,6 +181,7 @@ void SGASTagViewItem::Construct(const FArguments& InArgs)
 			SNew(STextBlock)
 			.Text(MakeAttributeSP(TagNode.Get(), &FGASTagNode::GetName))
 			.TextStyle(&TextStyle)
+			.ColorAndOpacity(MakeAttributeSP(TagNode.Get(), &FGASTagNode::GetColor))
 		]
 	];
 }
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Widgets/Views/STileView.h"
 #include "GameplayTagContainer.h"
+#include "GASAttachSnapshotDiff.h"
 
 class UAbilitySystemComponent;
 
@@ -12,10 +13,16 @@ class FGASTagNode : public TSharedFromThis<FGASTagNode>
 {
 public:
 	explicit FGASTagNode(const TWeakObjectPtr<UAbilitySystemComponent>& WeakComponent, const FGameplayTag& Tag, FName PropertyName);
+	/** A tag of another process' snapshot; blocked tags come without a count */
+	explicit FGASTagNode(const FGameplayTag& Tag, int32 SnapshotCount);
 
 	void Update();
 
+	/** Tints the tag by how it differs from the base it's compared with */
+	void SetDiffChange(const EGASDiffChange InDiffChange) { DiffChange = InDiffChange; }
+
 	FText GetName() const { return Name; }
+	FSlateColor GetColor() const;
 	FText GetToolTip() const { return ToolTip; }
 	FString GetTagName() const { return TagName; }
 
@@ -33,6 +40,10 @@ private:
 	const TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
 	const FGameplayTag Tag;
 	const FName PropertyName;
+
+	const bool bFromSnapshot = false;
+	const int32 SnapshotCount = INDEX_NONE;
+	EGASDiffChange DiffChange = EGASDiffChange::Unchanged;
 };
 
 class SGASTagViewItem : public SCompoundWidget
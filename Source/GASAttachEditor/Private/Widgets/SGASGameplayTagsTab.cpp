@@ -5,6 +5,8 @@
 #include "SGASGameplayTagsItem.h"
 #include "AbilitySystemComponent.h"
 #include "GASAttachEditorAbilityAccessors.h"
+#include "GASAttachEditorDiff.h"
+#include "GASAttachSnapshot.h"
 #include "Widgets/Layout/SWrapBox.h"
 
 #define LOCTEXT_NAMESPACE "GASAttachEditor"
@@ -86,56 +88,152 @@ void SGASGameplayTagsTab::Construct(const FArguments& InArgs)
 
 void SGASGameplayTagsTab::Refresh(UAbilitySystemComponent* Component)
 {
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GameplayTagsRefresh, RefreshCost);
+
 	static const FName OwnedTagsProperty = FGASAbilityAccessors::GetActivationOwnedTagsPropertyName();
 	static const FName BlockedTagsProperty = FGASAbilityAccessors::GetActivationBlockedTagsPropertyName();
 
+	SetShowingSnapshot(false);
+
 	WeakComponent = Component;
 
-	const auto FillTags = [Component](const FGameplayTagContainer& Tags, FGameplayTagContainer& CurrentTags, const TSharedPtr<SWrapBox>& TagsBox, FGameplayTagContainer& TagsContainer, const bool bOwnedTags)
 	{
-		if (CurrentTags != Tags)
+		FGameplayTagContainer Tags;
+		if (Component)
 		{
-			CurrentTags = Tags;
-			TagsBox->ClearChildren();
-			TagsContainer = CurrentTags;
+			Component->GetOwnedGameplayTags(Tags);
+		}
+		FillTags(Tags, CurrentOwnedTags, OwnedTagsBox, OwnedTagsContainer, [this, Component](const FGameplayTag& Tag)
+		{
+			return NodePool.Make<FGASTagNode>(Component, Tag, OwnedTagsProperty);
+		});
+	}
 
-			for (const FGameplayTag& Tag : CurrentTags)
-			{
-				TSharedRef<FGASTagNode> TagNode = MakeShared<FGASTagNode>(Component, Tag, bOwnedTags ? OwnedTagsProperty : BlockedTagsProperty);
-				TagNode->Update();
 
-				TagsBox->AddSlot()
-				[
-					SNew(SGASTagViewItem)
-					.TagNode(TagNode)
-				];
-			}
+	{
+		FGameplayTagContainer Tags;
+		if (Component)
+		{
+			Component->GetBlockedAbilityTags(Tags);
 		}
-	};
+		FillTags(Tags, CurrentBlockedTags, BlockedTagsBox, BlockedTagsContainer, [this, Component](const FGameplayTag& Tag)
+		{
+			return NodePool.Make<FGASTagNode>(Component, Tag, BlockedTagsProperty);
+		});
+	}
+}
+
+void SGASGameplayTagsTab::Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff)
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GameplayTagsRefresh, RefreshCost);
+
+	SetShowingSnapshot(true);
+
+	WeakComponent = nullptr;
 
 	{
+		// Tags this process doesn't know can't be shown as tags
 		FGameplayTagContainer Tags;
+		TMap<FGameplayTag, int32> TagCounts;
+		TMap<FGameplayTag, EGASDiffChange> TagChanges;
 		if (Component)
 		{
-			Component->GetOwnedGameplayTags(Tags);
+			for (const FGASTagSnapshot& TagSnapshot : Component->OwnedTags)
+			{
+				const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagSnapshot.Tag, false);
+				if (Tag.IsValid())
+				{
+					Tags.AddTag(Tag);
+					TagCounts.Add(Tag, TagSnapshot.Count);
+
+					const EGASDiffChange DiffChange = Diff ? GetDiffChange(Diff->FindTag(TagSnapshot.Tag)) : EGASDiffChange::Unchanged;
+					if (DiffChange != EGASDiffChange::Unchanged)
+					{
+						TagChanges.Add(Tag, DiffChange);
+					}
+				}
+			}
 		}
-		FillTags(Tags, CurrentOwnedTags, OwnedTagsBox, OwnedTagsContainer, true);
-	}
 
+		if (!TagChanges.OrderIndependentCompareEqual(CurrentOwnedTagChanges))
+		{
+			CurrentOwnedTagChanges = MoveTemp(TagChanges);
+			CurrentOwnedTags.Reset();
+		}
+
+		FillTags(Tags, CurrentOwnedTags, OwnedTagsBox, OwnedTagsContainer, [this, &TagCounts](const FGameplayTag& Tag)
+		{
+			TSharedRef<FGASTagNode> TagNode = NodePool.Make<FGASTagNode>(Tag, TagCounts.FindRef(Tag));
+			TagNode->SetDiffChange(CurrentOwnedTagChanges.FindRef(Tag));
+			return TagNode;
+		});
+	}
 
 	{
 		FGameplayTagContainer Tags;
 		if (Component)
 		{
-			Component->GetBlockedAbilityTags(Tags);
+			for (const FName TagName : Component->BlockedTags)
+			{
+				const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+				if (Tag.IsValid())
+				{
+					Tags.AddTag(Tag);
+				}
+			}
 		}
-		FillTags(Tags, CurrentBlockedTags, BlockedTagsBox, BlockedTagsContainer, false);
+		FillTags(Tags, CurrentBlockedTags, BlockedTagsBox, BlockedTagsContainer, [this](const FGameplayTag& Tag)
+		{
+			return NodePool.Make<FGASTagNode>(Tag, INDEX_NONE);
+		});
+	}
+}
+
+void SGASGameplayTagsTab::FillTags(const FGameplayTagContainer& Tags, FGameplayTagContainer& CurrentTags, const TSharedPtr<SWrapBox>& TagsBox, FGameplayTagContainer& TagsContainer, TFunctionRef<TSharedRef<FGASTagNode>(const FGameplayTag&)> MakeNode)
+{
+	if (CurrentTags == Tags)
+	{
+		return;
 	}
+
+	CurrentTags = Tags;
+	TagsBox->ClearChildren();
+	TagsContainer = CurrentTags;
+
+	for (const FGameplayTag& Tag : CurrentTags)
+	{
+		TSharedRef<FGASTagNode> TagNode = MakeNode(Tag);
+		TagNode->Update();
+
+		TagsBox->AddSlot()
+		[
+			SNew(SGASTagViewItem)
+			.TagNode(TagNode)
+		];
+	}
+}
+
+void SGASGameplayTagsTab::SetShowingSnapshot(const bool bInShowingSnapshot)
+{
+	if (bShowingSnapshot == bInShowingSnapshot)
+	{
+		return;
+	}
+
+	bShowingSnapshot = bInShowingSnapshot;
+
+	// Same tags on the other side still need their rows made anew
+	CurrentOwnedTags.Reset();
+	CurrentBlockedTags.Reset();
+	CurrentOwnedTagChanges.Reset();
+	OwnedTagsBox->ClearChildren();
+	BlockedTagsBox->ClearChildren();
 }
 
 FReply SGASGameplayTagsTab::OnSelectTags(const FGeometry& Geometry, const FPointerEvent& PointerEvent, const bool bOwnedTags)
 {
-	if (PointerEvent.GetEffectingButton() != EKeys::RightMouseButton)
+	if (PointerEvent.GetEffectingButton() != EKeys::RightMouseButton ||
+		!WeakComponent.IsValid())
 	{
 		return FReply::Handled();
 	}
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GASAttachEditorNodePool.h"
+#include "GASAttachEditorStats.h"
 #include "Widgets/SCompoundWidget.h"
 #include "GameplayTagContainer.h"
 
@@ -11,7 +13,12 @@
 #endif
 
 class SWrapBox;
+class FGASTagNode;
 class UAbilitySystemComponent;
+struct FGASWorldSnapshot;
+struct FGASComponentSnapshot;
+struct FGASComponentDiff;
+enum class EGASDiffChange : uint8;
 
 class SGASGameplayTagsTab : public SCompoundWidget
 {
@@ -26,10 +33,22 @@ public:
 
 	void Refresh(UAbilitySystemComponent* Component);
 
+	/** Shows a component of another process, as of its latest snapshot; its tags can't be edited from here. Owned tags in Diff are tinted */
+	void Refresh(const FGASWorldSnapshot& World, const FGASComponentSnapshot* Component, const FGASComponentDiff* Diff = nullptr);
+
+	const FGASCostCounter& GetRefreshCost() const { return RefreshCost; }
+	const FGASNodePool& GetNodePool() const { return NodePool; }
+
 private:
 	FReply OnSelectTags(const FGeometry& Geometry, const FPointerEvent& PointerEvent, bool bOwnedTags);
 	void RefreshTagList(bool bOwnedTags);
 
+	/** Rebuilds the tag box only when the tags changed */
+	void FillTags(const FGameplayTagContainer& Tags, FGameplayTagContainer& CurrentTags, const TSharedPtr<SWrapBox>& TagsBox, FGameplayTagContainer& TagsContainer, TFunctionRef<TSharedRef<FGASTagNode>(const FGameplayTag&)> MakeNode);
+
+	/** Live and snapshot rows read from different places, so switching between them starts over */
+	void SetShowingSnapshot(bool bInShowingSnapshot);
+
 private:
 	TSharedPtr<SWrapBox> OwnedTagsBox;
 	TSharedPtr<SWrapBox> BlockedTagsBox;
@@ -37,6 +56,8 @@ private:
 private:
 	FGameplayTagContainer CurrentOwnedTags;
 	FGameplayTagContainer CurrentBlockedTags;
+	// Of the tags that differ from the compared base; the tags are rebuilt when these change too
+	TMap<FGameplayTag, EGASDiffChange> CurrentOwnedTagChanges;
 
 #if WITH_EDITOR
 	TArray<SGameplayTagWidget::FEditableGameplayTagContainerDatum> EditableOwnedContainers;
@@ -50,4 +71,7 @@ private:
 	FGameplayTagContainer OldBlockedTagsContainer;
 
 	TWeakObjectPtr<UAbilitySystemComponent> WeakComponent;
+	bool bShowingSnapshot = false;
+	FGASNodePool NodePool { TEXT("GameplayTags") };
+	FGASCostCounter RefreshCost;
 };
\ No newline at end of file
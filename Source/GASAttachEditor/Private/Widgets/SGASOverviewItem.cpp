@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASOverviewItem.h"
+#include "Widgets/SGASOverviewTab.h"
+
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+void SGASOverviewItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Row = InArgs._Row;
+	Store = InArgs._Store;
+	HighlightText = InArgs._HighlightText;
+	SetPadding(0.f);
+
+	check(Row && Store);
+
+	SMultiColumnTableRow<const int32*>::Construct(SMultiColumnTableRow<const int32*>::FArguments().Padding(0.f), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SGASOverviewItem::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	// Every column reads the store while painting, so a refresh never has to touch the generated rows
+	if (ColumnName == SGASOverviewTab::OverviewNameColumn)
+	{
+		return
+			SNew(SBox)
+			.Padding(FMargin(4.f, 0.f))
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SGASOverviewItem::GetNameText)
+				.HighlightText(HighlightText)
+			];
+	}
+
+	TAttribute<FText> Text;
+	if (ColumnName == SGASOverviewTab::OverviewActiveEffectsColumn)
+	{
+		Text = TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(this, &SGASOverviewItem::GetCountText, &FGASOverviewStore::ActiveEffects));
+	}
+	else if (ColumnName == SGASOverviewTab::OverviewActiveAbilitiesColumn)
+	{
+		Text = TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(this, &SGASOverviewItem::GetCountText, &FGASOverviewStore::ActiveAbilities));
+	}
+	else if (ColumnName == SGASOverviewTab::OverviewOwnedTagsColumn)
+	{
+		Text = TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(this, &SGASOverviewItem::GetCountText, &FGASOverviewStore::OwnedTags));
+	}
+	else
+	{
+		Text = TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(this, &SGASOverviewItem::GetAttributeText, ColumnName));
+	}
+
+	return
+		SNew(SBox)
+		.Padding(FMargin(4.f, 0.f))
+		.HAlign(HAlign_Right)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(Text)
+			.Justification(ETextJustify::Right)
+		];
+}
+
+FText SGASOverviewItem::GetNameText() const
+{
+	return IsRowValid() ? Store->Names[*Row] : FText::GetEmpty();
+}
+
+FText SGASOverviewItem::GetCountText(const TArray<int32> FGASOverviewStore::*Column) const
+{
+	if (!IsRowValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	return FText::AsNumber((Store->*Column)[*Row]);
+}
+
+FText SGASOverviewItem::GetAttributeText(const FName AttributeColumn) const
+{
+	if (!IsRowValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	const int32 ColumnIndex = Store->AttributeColumns.IndexOfByKey(AttributeColumn);
+	if (ColumnIndex == INDEX_NONE)
+	{
+		return FText::GetEmpty();
+	}
+
+	const float Value = Store->AttributeValues[ColumnIndex][*Row];
+	if (FMath::IsNaN(Value))
+	{
+		return LOCTEXT("OverviewNoAttribute", "-");
+	}
+
+	static const FNumberFormattingOptions Options = FNumberFormattingOptions()
+		.SetMaximumFractionalDigits(2);
+
+	return FText::AsNumber(Value, &Options);
+}
+
+bool SGASOverviewItem::IsRowValid() const
+{
+	return Store->Names.IsValidIndex(*Row);
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
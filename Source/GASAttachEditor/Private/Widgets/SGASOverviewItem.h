@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Views/STableRow.h"
+
+struct FGASOverviewStore;
+
+class SGASOverviewItem : public SMultiColumnTableRow<const int32*>
+{
+public:
+	SLATE_BEGIN_ARGS(SGASOverviewItem)
+		: _Row(nullptr)
+		, _Store(nullptr)
+	{}
+		SLATE_ARGUMENT(const int32*, Row)
+		SLATE_ARGUMENT(const FGASOverviewStore*, Store)
+		SLATE_ATTRIBUTE(FText, HighlightText)
+	SLATE_END_ARGS()
+
+public:
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+
+	//~ Begin SMultiColumnTableRow Interface
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+	//~ End SMultiColumnTableRow Interface
+
+private:
+	FText GetNameText() const;
+	FText GetCountText(const TArray<int32> FGASOverviewStore::*Column) const;
+	FText GetAttributeText(FName AttributeColumn) const;
+
+	bool IsRowValid() const;
+
+private:
+	// Points into the tab's row ids; the tab rebuilds the list whenever that array reallocates
+	const int32* Row = nullptr;
+	const FGASOverviewStore* Store = nullptr;
+	TAttribute<FText> HighlightText;
+};
\ No newline at end of file
@@ -0,0 +1,545 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASOverviewTab.h"
+
+#include "SGASOverviewItem.h"
+#include "SGASRankingPanel.h"
+#include "GASAttachEditorSettings.h"
+#include "GASAttachEditorComponentIndex.h"
+
+#include "AbilitySystemComponent.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+
+#include <limits>
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+// Value of an attribute column for components that don't have that attribute
+static constexpr float MissingAttribute = std::numeric_limits<float>::quiet_NaN();
+
+const TCHAR* SGASOverviewTab::AttributesKey = TEXT("Overview.Attributes");
+const TCHAR* SGASOverviewTab::HiddenColumnsKey = TEXT("Overview.HiddenColumns");
+
+const FName SGASOverviewTab::OverviewNameColumn = "Overview_Name";
+const FName SGASOverviewTab::OverviewActiveEffectsColumn = "Overview_ActiveEffects";
+const FName SGASOverviewTab::OverviewActiveAbilitiesColumn = "Overview_ActiveAbilities";
+const FName SGASOverviewTab::OverviewOwnedTagsColumn = "Overview_OwnedTags";
+
+void FGASOverviewStore::SetNum(const int32 NumRows)
+{
+	Components.SetNum(NumRows);
+	Names.SetNum(NumRows);
+	SearchNames.SetNum(NumRows);
+	ActiveEffects.SetNumZeroed(NumRows);
+	ActiveAbilities.SetNumZeroed(NumRows);
+	OwnedTags.SetNumZeroed(NumRows);
+
+	AttributeValues.SetNum(AttributeColumns.Num());
+	for (TArray<float>& Values : AttributeValues)
+	{
+		Values.SetNumUninitialized(NumRows);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SGASOverviewTab::Construct(const FArguments& InArgs)
+{
+	Index = InArgs._Index;
+	OnComponentPicked = InArgs._OnComponentPicked;
+
+	TSet<FName> HiddenColumnSet;
+	FGASAttachEditorSettings::LoadNameSet(HiddenColumnsKey, HiddenColumnSet);
+	HiddenColumns = HiddenColumnSet.Array();
+
+	TSet<FName> ChosenAttributeSet;
+	FGASAttachEditorSettings::LoadNameSet(AttributesKey, ChosenAttributeSet);
+	ChosenAttributes = ChosenAttributeSet.Array();
+	ChosenAttributes.Sort(FNameLexicalLess());
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SAssignNew(SearchBox, SSearchBox)
+				.HintText(LOCTEXT("OverviewSearchHint", "Search Actors"))
+				.OnTextChanged(this, &SGASOverviewTab::OnSearchTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			[
+				CreateAttributesComboButton()
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+			+ SSplitter::Slot()
+			.Value(.7f)
+			[
+				SNew(SBorder)
+				.Padding(0.f)
+				[
+					SAssignNew(OverviewList, SGASOverviewList)
+					.ListItemsSource(&FilteredRows)
+					.SelectionMode(ESelectionMode::Single)
+					.OnGenerateRow_Lambda([this](const int32* Item, const TSharedRef<STableViewBase>& OwnerTable)
+					{
+						GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GenerateRow, RefreshCost);
+
+						return
+							SNew(SGASOverviewItem, OwnerTable)
+							.Row(Item)
+							.Store(&Store)
+							.HighlightText_Lambda([this]
+							{
+								return SearchBox->GetText();
+							})
+							.ToolTipText(LOCTEXT("OverviewRowToolTip", "Double-click to inspect this actor in the other tabs"));
+					})
+					.OnMouseButtonDoubleClick_Lambda([this](const int32* Item)
+					{
+						if (Item &&
+							Store.Components.IsValidIndex(*Item))
+						{
+							OnComponentPicked.ExecuteIfBound(Store.Components[*Item]);
+						}
+					})
+					.HeaderRow(CreateHeaderRow())
+				]
+			]
+			+ SSplitter::Slot()
+			.Value(.3f)
+			[
+				SNew(SGASRankingPanel)
+				.Index(Index)
+				.OnComponentPicked(OnComponentPicked)
+			]
+		]
+	];
+
+	for (const FName AttributeKey : ChosenAttributes)
+	{
+		AddAttributeColumn(AttributeKey);
+	}
+}
+
+TSharedRef<SHeaderRow> SGASOverviewTab::CreateHeaderRow()
+{
+	return
+		SAssignNew(HeaderRow, SHeaderRow)
+		.CanSelectGeneratedColumn(true)
+		.HiddenColumnsList(HiddenColumns)
+		.OnHiddenColumnsListChanged_Lambda([this]
+		{
+			HiddenColumns = HeaderRow->GetHiddenColumnIds();
+			SaveSettings();
+		})
+
+		+ SHeaderRow::Column(OverviewNameColumn)
+		.DefaultLabel(LOCTEXT("OverviewNameColumn", "Actor"))
+		.DefaultTooltip(LOCTEXT("OverviewNameColumnToolTip", "Avatar, or owner while there is no avatar, and net role"))
+		.ShouldGenerateWidget(true)
+		.SortMode(this, &SGASOverviewTab::GetSortMode, OverviewNameColumn)
+		.OnSort(this, &SGASOverviewTab::OnSort)
+		.FillWidth(.3f)
+
+		+ SHeaderRow::Column(OverviewActiveEffectsColumn)
+		.DefaultLabel(LOCTEXT("OverviewActiveEffectsColumn", "Effects"))
+		.DefaultTooltip(LOCTEXT("OverviewActiveEffectsColumnToolTip", "Number of active gameplay effects"))
+		.SortMode(this, &SGASOverviewTab::GetSortMode, OverviewActiveEffectsColumn)
+		.OnSort(this, &SGASOverviewTab::OnSort)
+		.FillWidth(.1f)
+
+		+ SHeaderRow::Column(OverviewActiveAbilitiesColumn)
+		.DefaultLabel(LOCTEXT("OverviewActiveAbilitiesColumn", "Active Abilities"))
+		.DefaultTooltip(LOCTEXT("OverviewActiveAbilitiesColumnToolTip", "Number of granted abilities that are currently active"))
+		.SortMode(this, &SGASOverviewTab::GetSortMode, OverviewActiveAbilitiesColumn)
+		.OnSort(this, &SGASOverviewTab::OnSort)
+		.FillWidth(.1f)
+
+		+ SHeaderRow::Column(OverviewOwnedTagsColumn)
+		.DefaultLabel(LOCTEXT("OverviewOwnedTagsColumn", "Owned Tags"))
+		.DefaultTooltip(LOCTEXT("OverviewOwnedTagsColumnToolTip", "Number of gameplay tags the component owns"))
+		.SortMode(this, &SGASOverviewTab::GetSortMode, OverviewOwnedTagsColumn)
+		.OnSort(this, &SGASOverviewTab::OnSort)
+		.FillWidth(.1f);
+}
+
+TSharedRef<SWidget> SGASOverviewTab::CreateAttributesComboButton()
+{
+	return
+		SNew(SComboButton)
+		.ContentPadding(2.f)
+		.VAlign(VAlign_Center)
+		.ToolTipText(LOCTEXT("OverviewAttributesToolTip", "Choose which attributes get a column. Persists across editor restarts."))
+		.OnGetMenuContent(this, &SGASOverviewTab::BuildAttributesMenu)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this]
+			{
+				return FText::Format(LOCTEXT("OverviewAttributesFormat", "Attributes: {0}"), ChosenAttributes.Num());
+			})
+		];
+}
+
+TSharedRef<SWidget> SGASOverviewTab::BuildAttributesMenu()
+{
+	FMenuBuilder MenuBuilder(false, nullptr);
+
+	// Chosen attributes whose set was not seen yet are still listed, so they can be taken off again
+	TArray<FName> SortedAttributes;
+	KnownAttributes.GetKeys(SortedAttributes);
+	for (const FName AttributeKey : ChosenAttributes)
+	{
+		SortedAttributes.AddUnique(AttributeKey);
+	}
+	SortedAttributes.Sort(FNameLexicalLess());
+
+	// One section per attribute set; the keys sort by set first
+	bool bSectionOpen = false;
+	FString CurrentSetName;
+	for (const FName AttributeKey : SortedAttributes)
+	{
+		FString SetName;
+		AttributeKey.ToString().Split(TEXT("."), &SetName, nullptr);
+
+		if (!bSectionOpen ||
+			SetName != CurrentSetName)
+		{
+			if (bSectionOpen)
+			{
+				MenuBuilder.EndSection();
+			}
+
+			MenuBuilder.BeginSection(NAME_None, FText::FromString(FName::NameToDisplayString(SetName, false)));
+			CurrentSetName = SetName;
+			bSectionOpen = true;
+		}
+
+		MenuBuilder.AddMenuEntry(
+			GetAttributeLabel(AttributeKey),
+			FText::FromName(AttributeKey),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateSP(this, &SGASOverviewTab::ToggleAttributeColumn, AttributeKey),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateSP(this, &SGASOverviewTab::IsAttributeColumnShown, AttributeKey)),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton);
+	}
+
+	if (bSectionOpen)
+	{
+		MenuBuilder.EndSection();
+	}
+	else
+	{
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("OverviewNoAttributes", "No attribute sets seen yet"),
+			FText::GetEmpty(),
+			FSlateIcon(),
+			FUIAction(FExecuteAction(), FCanExecuteAction::CreateLambda([] { return false; })));
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SGASOverviewTab::AddAttributeColumn(const FName AttributeKey)
+{
+	HeaderRow->AddColumn(
+		SHeaderRow::Column(AttributeKey)
+		.DefaultLabel(GetAttributeLabel(AttributeKey))
+		.DefaultTooltip(FText::FromName(AttributeKey))
+		.FillWidth(.1f)
+		.SortMode(this, &SGASOverviewTab::GetSortMode, AttributeKey)
+		.OnSort(this, &SGASOverviewTab::OnSort));
+}
+
+void SGASOverviewTab::ToggleAttributeColumn(const FName AttributeKey)
+{
+	if (ChosenAttributes.Remove(AttributeKey) > 0)
+	{
+		HeaderRow->RemoveColumn(AttributeKey);
+
+		if (SortColumn == AttributeKey)
+		{
+			SortColumn = NAME_None;
+			SortMode = EColumnSortMode::None;
+		}
+	}
+	else
+	{
+		ChosenAttributes.Add(AttributeKey);
+		AddAttributeColumn(AttributeKey);
+	}
+
+	SaveSettings();
+
+	// The new column has nothing to show until it is gathered
+	Refresh();
+}
+
+bool SGASOverviewTab::IsAttributeColumnShown(const FName AttributeKey) const
+{
+	return ChosenAttributes.Contains(AttributeKey);
+}
+
+void SGASOverviewTab::ResolveAttributeColumns()
+{
+	Store.AttributeColumns.Reset();
+	Store.Attributes.Reset();
+
+	for (const FName AttributeKey : ChosenAttributes)
+	{
+		Store.AttributeColumns.Add(AttributeKey);
+		Store.Attributes.Add(KnownAttributes.FindRef(AttributeKey));
+	}
+}
+
+void SGASOverviewTab::ScanAttributeSets(const UAbilitySystemComponent* Component)
+{
+	for (const UAttributeSet* Set : Component->GetSpawnedAttributes())
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		UClass* SetClass = Set->GetClass();
+
+		bool bAlreadyScanned = false;
+		ScannedSetClasses.Add(SetClass, &bAlreadyScanned);
+		if (bAlreadyScanned)
+		{
+			continue;
+		}
+
+		for (FStructProperty* Property : TFieldRange<FStructProperty>(SetClass))
+		{
+			if (!ensure(Property) ||
+				!Property->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				continue;
+			}
+
+			const FName AttributeKey(*FString::Printf(TEXT("%s.%s"), *SetClass->GetName(), *Property->GetName()));
+			KnownAttributes.Add(AttributeKey, FGameplayAttribute(Property));
+		}
+	}
+}
+
+void SGASOverviewTab::Refresh()
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_OverviewRefresh, RefreshCost);
+
+	if (!Index)
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<const FGASComponentIndexEntry>>& Entries = Index->GetEntries();
+	const int32 NumRows = Entries.Num();
+
+	// Attributes chosen in an earlier session resolve as soon as their set shows up
+	for (const TSharedPtr<const FGASComponentIndexEntry>& Entry : Entries)
+	{
+		if (const UAbilitySystemComponent* Component = Entry->Component.Get())
+		{
+			ScanAttributeSets(Component);
+		}
+	}
+
+	ResolveAttributeColumns();
+	Store.SetNum(NumRows);
+
+	const int32 NumAttributes = Store.Attributes.Num();
+
+	for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+	{
+		const FGASComponentIndexEntry& Entry = *Entries[RowIndex];
+		UAbilitySystemComponent* Component = Entry.Component.Get();
+
+		Store.Components[RowIndex] = Entry.Component;
+		Store.Names[RowIndex] = Entry.DisplayName;
+		Store.SearchNames[RowIndex] = Entry.Name;
+
+		if (!Component)
+		{
+			Store.ActiveEffects[RowIndex] = 0;
+			Store.ActiveAbilities[RowIndex] = 0;
+			Store.OwnedTags[RowIndex] = 0;
+
+			for (int32 ColumnIndex = 0; ColumnIndex < NumAttributes; ++ColumnIndex)
+			{
+				Store.AttributeValues[ColumnIndex][RowIndex] = MissingAttribute;
+			}
+			continue;
+		}
+
+		Store.ActiveEffects[RowIndex] = Component->GetActiveGameplayEffects().GetNumGameplayEffects();
+
+		int32 NumActiveAbilities = 0;
+		for (const FGameplayAbilitySpec& AbilitySpec : Component->GetActivatableAbilities())
+		{
+			NumActiveAbilities += AbilitySpec.IsActive() ? 1 : 0;
+		}
+		Store.ActiveAbilities[RowIndex] = NumActiveAbilities;
+
+		OwnedTagsScratch.Reset();
+		Component->GetOwnedGameplayTags(OwnedTagsScratch);
+		Store.OwnedTags[RowIndex] = OwnedTagsScratch.Num();
+
+		for (int32 ColumnIndex = 0; ColumnIndex < NumAttributes; ++ColumnIndex)
+		{
+			const FGameplayAttribute& Attribute = Store.Attributes[ColumnIndex];
+			Store.AttributeValues[ColumnIndex][RowIndex] =
+				Attribute.IsValid() && Component->HasAttributeSetForAttribute(Attribute)
+					? Component->GetNumericAttribute(Attribute)
+					: MissingAttribute;
+		}
+	}
+
+	// The list items point into the row ids, they only need rebuilding when those move
+	if (RowIds.Num() != NumRows)
+	{
+		RowIds.SetNumUninitialized(NumRows);
+		for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+		{
+			RowIds[RowIndex] = RowIndex;
+		}
+
+		OverviewList->RebuildList();
+	}
+
+	SortList();
+}
+
+void SGASOverviewTab::OnSearchTextChanged(const FText& InSearchText)
+{
+	SearchString = InSearchText.ToString();
+	SortList();
+}
+
+void SGASOverviewTab::OnSort(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+{
+	SortColumn = ColumnId;
+	SortMode = InSortMode;
+	SortList();
+}
+
+EColumnSortMode::Type SGASOverviewTab::GetSortMode(const FName ColumnId) const
+{
+	return SortColumn == ColumnId ? SortMode : EColumnSortMode::None;
+}
+
+void SGASOverviewTab::SortList()
+{
+	FilteredRows.Reset();
+
+	{
+		GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Filter, RefreshCost);
+
+		for (const int32& RowId : RowIds)
+		{
+			if (SearchString.IsEmpty() ||
+				Store.SearchNames[RowId].Contains(SearchString))
+			{
+				FilteredRows.Add(&RowId);
+			}
+		}
+	}
+
+	if (SortMode != EColumnSortMode::None &&
+		!SortColumn.IsNone())
+	{
+		GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Sort, RefreshCost);
+
+		const bool bAscending = SortMode == EColumnSortMode::Ascending;
+
+		// Each comparison reads straight out of one column
+		const auto SortByColumn = [this, bAscending](const auto& Column)
+		{
+			FilteredRows.StableSort([&Column, bAscending](const int32& A, const int32& B)
+			{
+				return bAscending ? Column[A] < Column[B] : Column[B] < Column[A];
+			});
+		};
+
+		if (SortColumn == OverviewNameColumn)
+		{
+			SortByColumn(Store.SearchNames);
+		}
+		else if (SortColumn == OverviewActiveEffectsColumn)
+		{
+			SortByColumn(Store.ActiveEffects);
+		}
+		else if (SortColumn == OverviewActiveAbilitiesColumn)
+		{
+			SortByColumn(Store.ActiveAbilities);
+		}
+		else if (SortColumn == OverviewOwnedTagsColumn)
+		{
+			SortByColumn(Store.OwnedTags);
+		}
+		else
+		{
+			const int32 ColumnIndex = Store.AttributeColumns.IndexOfByKey(SortColumn);
+			if (Store.AttributeValues.IsValidIndex(ColumnIndex))
+			{
+				// Components without the attribute go last either way
+				const TArray<float>& Column = Store.AttributeValues[ColumnIndex];
+				FilteredRows.StableSort([&Column, bAscending](const int32& A, const int32& B)
+				{
+					const float ValueA = Column[A];
+					const float ValueB = Column[B];
+					if (FMath::IsNaN(ValueA) || FMath::IsNaN(ValueB))
+					{
+						return !FMath::IsNaN(ValueA) && FMath::IsNaN(ValueB);
+					}
+
+					return bAscending ? ValueA < ValueB : ValueB < ValueA;
+				});
+			}
+		}
+	}
+
+	OverviewList->RequestListRefresh();
+}
+
+void SGASOverviewTab::SaveSettings() const
+{
+	FGASAttachEditorSettings::SaveNameSet(AttributesKey, TSet<FName>(ChosenAttributes));
+	FGASAttachEditorSettings::SaveNameSet(HiddenColumnsKey, TSet<FName>(HiddenColumns));
+}
+
+FText SGASOverviewTab::GetAttributeLabel(const FName AttributeKey)
+{
+	FString PropertyName;
+	if (!AttributeKey.ToString().Split(TEXT("."), nullptr, &PropertyName))
+	{
+		PropertyName = AttributeKey.ToString();
+	}
+
+	return FText::FromString(FName::NameToDisplayString(PropertyName, false));
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachEditorStats.h"
+#include "SGASActorPicker.h"
+#include "AttributeSet.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+class SSearchBox;
+class FGASComponentIndex;
+class UAbilitySystemComponent;
+
+using SGASOverviewList = SListView<const int32*>;
+
+/**
+ * One row per component of the inspected world, stored a column at a time.
+ *
+ * A refresh rewrites the columns in place in a single pass over the component index, and the rows only
+ * read them back while painting, so there are no per-row objects to allocate, diff or keep alive.
+ */
+struct FGASOverviewStore
+{
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> Components;
+	TArray<FText> Names;
+	TArray<FString> SearchNames;
+	TArray<int32> ActiveEffects;
+	TArray<int32> ActiveAbilities;
+	TArray<int32> OwnedTags;
+
+	// Column ids of the chosen attributes, and one value column for each of them.
+	// Components without the attribute hold NaN.
+	TArray<FName> AttributeColumns;
+	TArray<FGameplayAttribute> Attributes;
+	TArray<TArray<float>> AttributeValues;
+
+	int32 Num() const { return Components.Num(); }
+	void SetNum(int32 NumRows);
+};
+
+/**
+ * Every Ability System Component of the inspected world at a glance.
+ *
+ * Which attributes get a column is picked from the attribute sets seen so far and persists across editor
+ * restarts. Double-clicking a row inspects that component in the other tabs.
+ */
+class SGASOverviewTab : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASOverviewTab)
+		: _Index(nullptr)
+	{}
+		SLATE_ARGUMENT(const FGASComponentIndex*, Index)
+		SLATE_EVENT(FOnGASComponentPicked, OnComponentPicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Re-reads every component of the index */
+	void Refresh();
+
+	const FGASCostCounter& GetRefreshCost() const { return RefreshCost; }
+
+	static const FName OverviewNameColumn;
+	static const FName OverviewActiveEffectsColumn;
+	static const FName OverviewActiveAbilitiesColumn;
+	static const FName OverviewOwnedTagsColumn;
+
+private:
+	TSharedRef<SHeaderRow> CreateHeaderRow();
+	TSharedRef<SWidget> CreateAttributesComboButton();
+	TSharedRef<SWidget> BuildAttributesMenu();
+
+	void AddAttributeColumn(FName AttributeKey);
+	void ToggleAttributeColumn(FName AttributeKey);
+	bool IsAttributeColumnShown(FName AttributeKey) const;
+	void ResolveAttributeColumns();
+
+	void ScanAttributeSets(const UAbilitySystemComponent* Component);
+
+	void OnSearchTextChanged(const FText& InSearchText);
+	void OnSort(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type InSortMode);
+	EColumnSortMode::Type GetSortMode(FName ColumnId) const;
+
+	void SortList();
+
+	void SaveSettings() const;
+
+	static FText GetAttributeLabel(FName AttributeKey);
+
+	static const TCHAR* AttributesKey;
+	static const TCHAR* HiddenColumnsKey;
+
+private:
+	const FGASComponentIndex* Index = nullptr;
+	FOnGASComponentPicked OnComponentPicked;
+
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SHeaderRow> HeaderRow;
+	TSharedPtr<SGASOverviewList> OverviewList;
+
+	FGASOverviewStore Store;
+
+	// Row i of the store is &RowIds[i], so a list item keeps pointing at the same component across refreshes
+	TArray<int32> RowIds;
+	TArray<const int32*> FilteredRows;
+
+	FString SearchString;
+	FName SortColumn;
+	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+
+	// Chosen attribute keys ("AttributeSet.Property"), in column order
+	TArray<FName> ChosenAttributes;
+	TArray<FName> HiddenColumns;
+
+	// Attributes seen on any component so far, for the attributes menu; each set class is only walked once
+	TMap<FName, FGameplayAttribute> KnownAttributes;
+	TSet<TObjectKey<UClass>> ScannedSetClasses;
+
+	FGameplayTagContainer OwnedTagsScratch;
+
+	FGASCostCounter RefreshCost;
+};
\ No newline at end of file
@@ -0,0 +1,184 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASRankingPanel.h"
+
+#include "GASAttachEditorSettings.h"
+#include "GASAttachEditorComponentIndex.h"
+
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+const TCHAR* SGASRankingPanel::MetricKey = TEXT("Overview.RankingMetric");
+
+void SGASRankingPanel::Construct(const FArguments& InArgs)
+{
+	Index = InArgs._Index;
+	OnComponentPicked = InArgs._OnComponentPicked;
+	Metric = EGASRankingMetric(FMath::Clamp(FGASAttachEditorSettings::LoadInt(MetricKey, 0), 0, int32(EGASRankingMetric::Num) - 1));
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("RankingTitle", "Heaviest Components"))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(8.f, 0.f, 0.f, 0.f)
+			[
+				CreateMetricComboButton()
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SBorder)
+			.Padding(0.f)
+			[
+				SAssignNew(RankingList, SGASRankingList)
+				.ListItemsSource(&TopEntries)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow_Lambda([this](TSharedPtr<const FGASComponentIndexEntry> Item, const TSharedRef<STableViewBase>& OwnerTable)
+				{
+					// The same entry keeps its row while it moves up and down, so rank and value are read while painting
+					return
+						SNew(STableRow<TSharedPtr<const FGASComponentIndexEntry>>, OwnerTable)
+						.Padding(FMargin(2.f, 1.f))
+						.ToolTipText(LOCTEXT("RankingRowToolTip", "Double-click to inspect this actor in the other tabs"))
+						[
+							SNew(SHorizontalBox)
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							[
+								SNew(SBox)
+								.MinDesiredWidth(30.f)
+								[
+									SNew(STextBlock)
+									.Text_Lambda([this, Item]
+									{
+										return FText::AsNumber(TopEntries.IndexOfByKey(Item) + 1);
+									})
+								]
+							]
+							+ SHorizontalBox::Slot()
+							.FillWidth(1.f)
+							[
+								SNew(STextBlock)
+								.Text(Item->DisplayName)
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.Padding(8.f, 0.f)
+							[
+								SNew(STextBlock)
+								.Text_Lambda([this, Item]
+								{
+									return FText::AsNumber(Ranking.GetValue(Metric, *Item));
+								})
+							]
+						];
+				})
+				.OnMouseButtonDoubleClick_Lambda([this](TSharedPtr<const FGASComponentIndexEntry> Item)
+				{
+					if (Item)
+					{
+						OnComponentPicked.ExecuteIfBound(Item->Component);
+					}
+				})
+			]
+		]
+	];
+}
+
+void SGASRankingPanel::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (Index &&
+		Ranking.Update(*Index))
+	{
+		RebuildTop();
+	}
+}
+
+TSharedRef<SWidget> SGASRankingPanel::CreateMetricComboButton()
+{
+	return
+		SNew(SComboButton)
+		.ContentPadding(2.f)
+		.VAlign(VAlign_Center)
+		.ToolTipText(LOCTEXT("RankingMetricToolTip", "What to rank the components of the world by"))
+		.OnGetMenuContent(this, &SGASRankingPanel::BuildMetricMenu)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this]
+			{
+				return FText::Format(LOCTEXT("RankingMetricFormat", "By: {0}"), FGASComponentRanking::GetMetricName(Metric));
+			})
+		];
+}
+
+TSharedRef<SWidget> SGASRankingPanel::BuildMetricMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	for (uint8 MetricIndex = 0; MetricIndex < uint8(EGASRankingMetric::Num); ++MetricIndex)
+	{
+		const EGASRankingMetric MenuMetric = EGASRankingMetric(MetricIndex);
+
+		MenuBuilder.AddMenuEntry(
+			FGASComponentRanking::GetMetricName(MenuMetric),
+			FText::GetEmpty(),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateSP(this, &SGASRankingPanel::SetMetric, MenuMetric),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([this, MenuMetric]
+				{
+					return Metric == MenuMetric;
+				})),
+			NAME_None,
+			EUserInterfaceActionType::RadioButton);
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SGASRankingPanel::SetMetric(const EGASRankingMetric InMetric)
+{
+	Metric = InMetric;
+	FGASAttachEditorSettings::SaveInt(MetricKey, int32(Metric));
+
+	// Every metric is sampled all the time, switching is only a matter of reading another heap
+	RebuildTop();
+}
+
+void SGASRankingPanel::RebuildTop()
+{
+	Ranking.GetTop(Metric, NumRanked, TopEntries);
+
+	// A component carrying none of it is not heavy
+	while (TopEntries.Num() > 0 &&
+		Ranking.GetValue(Metric, *TopEntries.Last()) == 0)
+	{
+		TopEntries.Pop();
+	}
+
+	RankingList->RequestListRefresh();
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachEditorComponentRanking.h"
+#include "SGASActorPicker.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class FGASComponentIndex;
+struct FGASComponentIndexEntry;
+
+using SGASRankingList = SListView<TSharedPtr<const FGASComponentIndexEntry>>;
+
+/**
+ * The heaviest components of the inspected world by one metric at a time.
+ *
+ * Only ticks while visible; the ranking underneath re-samples a slice of the world every few frames, so
+ * keeping the panel open costs about the same with a handful of components as with thousands.
+ */
+class SGASRankingPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASRankingPanel)
+		: _Index(nullptr)
+	{}
+		SLATE_ARGUMENT(const FGASComponentIndex*, Index)
+		SLATE_EVENT(FOnGASComponentPicked, OnComponentPicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	//~ Begin SCompoundWidget Interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	//~ End SCompoundWidget Interface
+
+private:
+	TSharedRef<SWidget> CreateMetricComboButton();
+	TSharedRef<SWidget> BuildMetricMenu();
+	void SetMetric(EGASRankingMetric InMetric);
+
+	void RebuildTop();
+
+	static const TCHAR* MetricKey;
+	static constexpr int32 NumRanked = 25;
+
+private:
+	const FGASComponentIndex* Index = nullptr;
+	FOnGASComponentPicked OnComponentPicked;
+
+	FGASComponentRanking Ranking;
+	EGASRankingMetric Metric = EGASRankingMetric::ActiveEffects;
+
+	TSharedPtr<SGASRankingList> RankingList;
+	TArray<TSharedPtr<const FGASComponentIndexEntry>> TopEntries;
+};
\ No newline at end of file
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASWorldMatrixItem.h"
+#include "Widgets/SGASWorldMatrixTab.h"
+
+#include "Styling/StyleColors.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+void SGASWorldMatrixItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Row = InArgs._Row;
+	Columns = InArgs._Columns;
+	SetPadding(0.f);
+
+	check(Row.IsValid() && Columns);
+
+	SMultiColumnTableRow<TSharedPtr<FGASWorldMatrixRow>>::Construct(SMultiColumnTableRow<TSharedPtr<FGASWorldMatrixRow>>::FArguments().Padding(0.f), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SGASWorldMatrixItem::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (ColumnName == SGASWorldMatrixTab::WorldMatrixFieldColumn)
+	{
+		return
+			SNew(SBox)
+			.Padding(FMargin(4.f, 0.f))
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(Row->Label)
+				.ColorAndOpacity_Lambda([this]
+				{
+					return Row->HasDisagreement() ? FSlateColor(FStyleColors::Error.GetSpecifiedColor()) : FSlateColor::UseForeground();
+				})
+			];
+	}
+
+	return
+		SNew(SBox)
+		.Padding(FMargin(4.f, 0.f))
+		.HAlign(HAlign_Right)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Justification(ETextJustify::Right)
+			.Text_Lambda([this, ColumnName]
+			{
+				return Row->GetValueText(FindColumn(ColumnName));
+			})
+			.ColorAndOpacity_Lambda([this, ColumnName]
+			{
+				return Row->Disagrees(FindColumn(ColumnName)) ? FSlateColor(FStyleColors::Error.GetSpecifiedColor()) : FSlateColor::UseForeground();
+			})
+		];
+}
+
+int32 SGASWorldMatrixItem::FindColumn(const FName ColumnId) const
+{
+	return Columns->IndexOfByPredicate([ColumnId](const FGASWorldMatrixColumn& Column)
+	{
+		return Column.ColumnId == ColumnId;
+	});
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Views/STableRow.h"
+
+struct FGASWorldMatrixRow;
+struct FGASWorldMatrixColumn;
+
+class SGASWorldMatrixItem : public SMultiColumnTableRow<TSharedPtr<FGASWorldMatrixRow>>
+{
+public:
+	SLATE_BEGIN_ARGS(SGASWorldMatrixItem)
+		: _Columns(nullptr)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<FGASWorldMatrixRow>, Row)
+		SLATE_ARGUMENT(const TArray<FGASWorldMatrixColumn>*, Columns)
+	SLATE_END_ARGS()
+
+public:
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+
+	//~ Begin SMultiColumnTableRow Interface
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+	//~ End SMultiColumnTableRow Interface
+
+private:
+	int32 FindColumn(FName ColumnId) const;
+
+private:
+	TSharedPtr<FGASWorldMatrixRow> Row;
+
+	// The tab's world columns; they may change order between refreshes, so cells look themselves up by id
+	const TArray<FGASWorldMatrixColumn>* Columns = nullptr;
+};
\ No newline at end of file
@@ -0,0 +1,369 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGASWorldMatrixTab.h"
+
+#include "SGASWorldMatrixItem.h"
+#include "GASAttachEditorSettings.h"
+#include "GASAttachEditorWorldCorrelation.h"
+
+#include "AbilitySystemComponent.h"
+#include "Algo/Compare.h"
+#include "Engine/Engine.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#include <limits>
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+// Value of a cell whose world has no counterpart, or whose counterpart lacks the field
+static constexpr float MissingValue = std::numeric_limits<float>::quiet_NaN();
+
+const TCHAR* SGASWorldMatrixTab::OnlyDisagreementsKey = TEXT("WorldMatrix.OnlyDisagreements");
+
+const FName SGASWorldMatrixTab::WorldMatrixFieldColumn = "WorldMatrix_Field";
+
+bool FGASWorldMatrixRow::Disagrees(const int32 Column) const
+{
+	if (Column <= 0 ||
+		!Values.IsValidIndex(Column))
+	{
+		return false;
+	}
+
+	const float Authority = Values[0];
+	const float Value = Values[Column];
+	if (FMath::IsNaN(Authority) || FMath::IsNaN(Value))
+	{
+		return FMath::IsNaN(Authority) != FMath::IsNaN(Value);
+	}
+
+	return !FMath::IsNearlyEqual(Authority, Value);
+}
+
+bool FGASWorldMatrixRow::HasDisagreement() const
+{
+	for (int32 Column = 1; Column < Values.Num(); ++Column)
+	{
+		if (Disagrees(Column))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FText FGASWorldMatrixRow::GetValueText(const int32 Column) const
+{
+	if (!Values.IsValidIndex(Column) ||
+		FMath::IsNaN(Values[Column]))
+	{
+		return LOCTEXT("WorldMatrixNoValue", "-");
+	}
+
+	static const FNumberFormattingOptions Options = FNumberFormattingOptions()
+		.SetMaximumFractionalDigits(2);
+
+	return FText::AsNumber(Values[Column], &Options);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SGASWorldMatrixTab::Construct(const FArguments& InArgs)
+{
+	bOnlyDisagreements = FGASAttachEditorSettings::LoadBool(OnlyDisagreementsKey, false);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SCheckBox)
+			.Padding(FMargin(4.f, 0.f))
+			.IsChecked_Lambda([this]
+			{
+				return bOnlyDisagreements ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			})
+			.OnCheckStateChanged_Lambda([this](ECheckBoxState)
+			{
+				bOnlyDisagreements = !bOnlyDisagreements;
+				FGASAttachEditorSettings::SaveBool(OnlyDisagreementsKey, bOnlyDisagreements);
+				ApplyFilter();
+			})
+			[
+				SNew(SBox)
+				.MinDesiredWidth(80.f)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("WorldMatrixOnlyDisagreements", "Only Disagreements"))
+					.ToolTipText(LOCTEXT("WorldMatrixOnlyDisagreementsToolTip", "Only show the fields where a client differs from the server"))
+				]
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SBorder)
+			.Padding(0.f)
+			[
+				SAssignNew(MatrixList, SGASWorldMatrixList)
+				.ListItemsSource(&FilteredRows)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow_Lambda([this](TSharedPtr<FGASWorldMatrixRow> Item, const TSharedRef<STableViewBase>& OwnerTable)
+				{
+					GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_GenerateRow, RefreshCost);
+
+					return
+						SNew(SGASWorldMatrixItem, OwnerTable)
+						.Row(Item)
+						.Columns(&Columns);
+				})
+				.HeaderRow
+				(
+					SAssignNew(HeaderRow, SHeaderRow)
+					+ SHeaderRow::Column(WorldMatrixFieldColumn)
+					.DefaultLabel(LOCTEXT("WorldMatrixFieldColumn", "Field"))
+					.FillWidth(.3f)
+				)
+			]
+		]
+	];
+}
+
+void SGASWorldMatrixTab::Refresh(const UAbilitySystemComponent* Component, const FGASWorldCorrelation& Correlation)
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_WorldMatrixRefresh, RefreshCost);
+
+	TArray<FGASWorldMatrixColumn> NewColumns;
+	GatherColumns(Component, Correlation, NewColumns);
+
+	const bool bColumnsChanged =
+		NewColumns.Num() != Columns.Num() ||
+		!Algo::CompareByPredicate(NewColumns, Columns, [](const FGASWorldMatrixColumn& A, const FGASWorldMatrixColumn& B)
+		{
+			return A.ColumnId == B.ColumnId;
+		});
+
+	Columns = MoveTemp(NewColumns);
+
+	if (bColumnsChanged)
+	{
+		RebuildHeaderColumns();
+	}
+
+	++SeenStamp;
+
+	// The fixed rows are always there, even with no counterpart anywhere
+	TouchRow("ActiveEffects", EGASWorldMatrixRowType::ActiveEffects, LOCTEXT("WorldMatrixActiveEffects", "Active Effects"));
+	TouchRow("ActiveAbilities", EGASWorldMatrixRowType::ActiveAbilities, LOCTEXT("WorldMatrixActiveAbilities", "Active Abilities"));
+	TouchRow("OwnedTags", EGASWorldMatrixRowType::OwnedTags, LOCTEXT("WorldMatrixOwnedTags", "Owned Tags"));
+
+	for (int32 Column = 0; Column < Columns.Num(); ++Column)
+	{
+		if (const UAbilitySystemComponent* ColumnComponent = Columns[Column].Component.Get())
+		{
+			GatherColumn(Column, ColumnComponent);
+		}
+	}
+
+	for (auto It = MappedRows.CreateIterator(); It; ++It)
+	{
+		FGASWorldMatrixRow& Row = *It.Value();
+		if (Row.SeenStamp != SeenStamp)
+		{
+			It.RemoveCurrent();
+			bRowsChanged = true;
+			continue;
+		}
+
+		// A tag missing from a world that has the actor is a zero count, not a missing value
+		if (Row.Type == EGASWorldMatrixRowType::Tag)
+		{
+			for (int32 Column = 0; Column < Columns.Num(); ++Column)
+			{
+				if (FMath::IsNaN(Row.Values[Column]) &&
+					Columns[Column].Component.IsValid())
+				{
+					Row.Values[Column] = 0.f;
+				}
+			}
+		}
+	}
+
+	if (bRowsChanged)
+	{
+		bRowsChanged = false;
+
+		MappedRows.GenerateValueArray(SortedRows);
+		SortedRows.Sort([](const TSharedPtr<FGASWorldMatrixRow>& A, const TSharedPtr<FGASWorldMatrixRow>& B)
+		{
+			if (A->Type != B->Type)
+			{
+				return A->Type < B->Type;
+			}
+
+			return A->Label.CompareTo(B->Label) < 0;
+		});
+	}
+
+	ApplyFilter();
+}
+
+void SGASWorldMatrixTab::GatherColumns(const UAbilitySystemComponent* Component, const FGASWorldCorrelation& Correlation, TArray<FGASWorldMatrixColumn>& OutColumns) const
+{
+	struct FWorldEntry
+	{
+		const FWorldContext* WorldContext;
+		bool bServer;
+	};
+
+	TArray<FWorldEntry> Worlds;
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		const UWorld* World = WorldContext.World();
+		if (!World ||
+			(WorldContext.WorldType != EWorldType::PIE && WorldContext.WorldType != EWorldType::Game))
+		{
+			continue;
+		}
+
+		const ENetMode NetMode = World->GetNetMode();
+		Worlds.Add({ &WorldContext, NetMode == NM_DedicatedServer || NetMode == NM_ListenServer });
+	}
+
+	// The authority goes first, everything else is compared against it
+	Worlds.StableSort([](const FWorldEntry& A, const FWorldEntry& B)
+	{
+		if (A.bServer != B.bServer)
+		{
+			return A.bServer;
+		}
+
+		return A.WorldContext->PIEInstance < B.WorldContext->PIEInstance;
+	});
+
+	for (const FWorldEntry& Entry : Worlds)
+	{
+		FGASWorldMatrixColumn& Column = OutColumns.AddDefaulted_GetRef();
+		Column.WorldContextHandle = Entry.WorldContext->ContextHandle;
+		Column.ColumnId = FName(*FString::Printf(TEXT("WorldMatrix_%s"), *Column.WorldContextHandle.ToString()));
+		Column.Title = FGASWorldCorrelation::GetWorldName(Column.WorldContextHandle);
+		Column.Component = Component ? Correlation.FindCounterpart(Component, Entry.WorldContext->World()) : nullptr;
+	}
+}
+
+void SGASWorldMatrixTab::RebuildHeaderColumns()
+{
+	HeaderRow->ClearColumns();
+
+	HeaderRow->AddColumn(
+		SHeaderRow::Column(WorldMatrixFieldColumn)
+		.DefaultLabel(LOCTEXT("WorldMatrixFieldColumn", "Field"))
+		.FillWidth(.3f));
+
+	for (const FGASWorldMatrixColumn& Column : Columns)
+	{
+		HeaderRow->AddColumn(
+			SHeaderRow::Column(Column.ColumnId)
+			.DefaultLabel(Column.Title)
+			.FillWidth(.7f / Columns.Num()));
+	}
+
+	// The generated rows only have cells for the columns they were built with
+	MatrixList->RebuildList();
+}
+
+FGASWorldMatrixRow& SGASWorldMatrixTab::TouchRow(const FName Key, const EGASWorldMatrixRowType Type, const FText& Label)
+{
+	TSharedPtr<FGASWorldMatrixRow>& Row = MappedRows.FindOrAdd(Key);
+	if (!Row)
+	{
+		Row = MakeShared<FGASWorldMatrixRow>();
+		Row->Type = Type;
+		Row->Label = Label;
+		bRowsChanged = true;
+	}
+
+	// First touch this refresh, the values of the last one are stale
+	if (Row->SeenStamp != SeenStamp)
+	{
+		Row->SeenStamp = SeenStamp;
+		Row->Values.Init(MissingValue, Columns.Num());
+	}
+
+	return *Row;
+}
+
+void SGASWorldMatrixTab::GatherColumn(const int32 Column, const UAbilitySystemComponent* Component)
+{
+	TouchRow("ActiveEffects", EGASWorldMatrixRowType::ActiveEffects, FText::GetEmpty()).Values[Column] =
+		Component->GetActiveGameplayEffects().GetNumGameplayEffects();
+
+	int32 NumActiveAbilities = 0;
+	for (const FGameplayAbilitySpec& AbilitySpec : Component->GetActivatableAbilities())
+	{
+		NumActiveAbilities += AbilitySpec.IsActive() ? 1 : 0;
+	}
+	TouchRow("ActiveAbilities", EGASWorldMatrixRowType::ActiveAbilities, FText::GetEmpty()).Values[Column] = NumActiveAbilities;
+
+	OwnedTagsScratch.Reset();
+	Component->GetOwnedGameplayTags(OwnedTagsScratch);
+	TouchRow("OwnedTags", EGASWorldMatrixRowType::OwnedTags, FText::GetEmpty()).Values[Column] = OwnedTagsScratch.Num();
+
+	for (const FGameplayTag& Tag : OwnedTagsScratch)
+	{
+		FGASWorldMatrixRow& Row = TouchRow(Tag.GetTagName(), EGASWorldMatrixRowType::Tag, FText::FromName(Tag.GetTagName()));
+		Row.Tag = Tag;
+		Row.Values[Column] = Component->GetTagCount(Tag);
+	}
+
+	for (const UAttributeSet* Set : Component->GetSpawnedAttributes())
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		for (FStructProperty* Property : TFieldRange<FStructProperty>(Set->GetClass()))
+		{
+			if (!ensure(Property) ||
+				!Property->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				continue;
+			}
+
+			const FGameplayAttribute Attribute(Property);
+			const FName Key(*FString::Printf(TEXT("%s.%s"), *Set->GetClass()->GetName(), *Property->GetName()));
+
+			FGASWorldMatrixRow& Row = TouchRow(Key, EGASWorldMatrixRowType::Attribute, FText::FromString(FName::NameToDisplayString(Property->GetName(), false)));
+			Row.Attribute = Attribute;
+			Row.Values[Column] = Component->GetNumericAttribute(Attribute);
+		}
+	}
+}
+
+void SGASWorldMatrixTab::ApplyFilter()
+{
+	GAS_ATTACH_EDITOR_SCOPE_COST(STAT_GASAttachEditor_Filter, RefreshCost);
+
+	FilteredRows.Reset();
+	for (const TSharedPtr<FGASWorldMatrixRow>& Row : SortedRows)
+	{
+		if (!bOnlyDisagreements ||
+			Row->HasDisagreement())
+		{
+			FilteredRows.Add(Row);
+		}
+	}
+
+	MatrixList->RequestListRefresh();
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachEditorStats.h"
+#include "AttributeSet.h"
+#include "GameplayTagContainer.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+class FGASWorldCorrelation;
+class UAbilitySystemComponent;
+
+enum class EGASWorldMatrixRowType : uint8
+{
+	ActiveEffects,
+	ActiveAbilities,
+	OwnedTags,
+	Attribute,
+	Tag,
+};
+
+/** One inspected world, the column its values go into */
+struct FGASWorldMatrixColumn
+{
+	FName ColumnId;
+	FName WorldContextHandle;
+	FText Title;
+	TWeakObjectPtr<UAbilitySystemComponent> Component;
+};
+
+/** One field of the actor, with its value in every world */
+struct FGASWorldMatrixRow
+{
+	EGASWorldMatrixRowType Type = EGASWorldMatrixRowType::ActiveEffects;
+	FText Label;
+	FGameplayAttribute Attribute;
+	FGameplayTag Tag;
+
+	// One per column, NaN where that world has no counterpart or the counterpart lacks the field
+	TArray<float> Values;
+
+	/** Column 0 is the authority; every other column is compared against it */
+	bool Disagrees(int32 Column) const;
+	bool HasDisagreement() const;
+
+	FText GetValueText(int32 Column) const;
+
+private:
+	friend class SGASWorldMatrixTab;
+	uint32 SeenStamp = 0;
+};
+
+using SGASWorldMatrixList = SListView<TSharedPtr<FGASWorldMatrixRow>>;
+
+/**
+ * The selected actor in every game world side by side - the server first, then each PIE client.
+ *
+ * Counterparts come from the world correlation, and all worlds are gathered in one pass per refresh.
+ * Cells that differ from the server are highlighted, and the rows can be narrowed down to those.
+ */
+class SGASWorldMatrixTab : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASWorldMatrixTab)
+	{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void Refresh(const UAbilitySystemComponent* Component, const FGASWorldCorrelation& Correlation);
+
+	const FGASCostCounter& GetRefreshCost() const { return RefreshCost; }
+
+	static const FName WorldMatrixFieldColumn;
+
+private:
+	void GatherColumns(const UAbilitySystemComponent* Component, const FGASWorldCorrelation& Correlation, TArray<FGASWorldMatrixColumn>& OutColumns) const;
+	void RebuildHeaderColumns();
+
+	FGASWorldMatrixRow& TouchRow(FName Key, EGASWorldMatrixRowType Type, const FText& Label);
+	void GatherColumn(int32 Column, const UAbilitySystemComponent* Component);
+
+	void ApplyFilter();
+
+	static const TCHAR* OnlyDisagreementsKey;
+
+private:
+	TSharedPtr<SHeaderRow> HeaderRow;
+	TSharedPtr<SGASWorldMatrixList> MatrixList;
+
+	TArray<FGASWorldMatrixColumn> Columns;
+
+	TMap<FName, TSharedPtr<FGASWorldMatrixRow>> MappedRows;
+	TArray<TSharedPtr<FGASWorldMatrixRow>> SortedRows;
+	TArray<TSharedPtr<FGASWorldMatrixRow>> FilteredRows;
+
+	uint32 SeenStamp = 0;
+	bool bRowsChanged = false;
+	bool bOnlyDisagreements = false;
+
+	FGameplayTagContainer OwnedTagsScratch;
+
+	FGASCostCounter RefreshCost;
+};
\ No newline at end of file
@@ -11,6 +11,7 @@ class SDockTab;
 class FMenuBuilder;
 class FUICommandList;
 class FToolBarBuilder;
+class SGASCaptureViewer;
 
 class FGASAttachEditorModule : public IModuleInterface
 {
@@ -20,15 +21,28 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
+	/** Brings up the Ability System Capture Viewer tab on Filename */
+	GASATTACHEDITOR_API void OpenCaptureViewer(const FString& Filename);
+
+	/** The capture viewer on its own, for a host without tabs - the GASCaptureViewer program */
+	GASATTACHEDITOR_API TSharedRef<SWidget> MakeCaptureViewer(const FString& Filename, bool bStandalone);
+
 private:
 	TSharedRef<SDockTab> OnSpawnGASEditorTab(const FSpawnTabArgs& SpawnTabArgs);
+	TSharedRef<SDockTab> OnSpawnGASCaptureViewerTab(const FSpawnTabArgs& SpawnTabArgs);
 
 #if WITH_EDITOR
 	TSharedRef<SDockTab> OnSpawnGASTriggersTab(const FSpawnTabArgs& SpawnTabArgs);
+	void OnEndPIE(bool bIsSimulating);
 #endif
 
 private:
 	TSharedPtr<FUICommandList> PluginCommands;
 	TWeakPtr<SDockTab> GASEditorTab;
 	TWeakPtr<SDockTab> GASTriggersTab;
+	TWeakPtr<SGASCaptureViewer> CaptureViewer;
+
+#if WITH_EDITOR
+	FDelegateHandle EndPIEHandle;
+#endif
 };
\ No newline at end of file
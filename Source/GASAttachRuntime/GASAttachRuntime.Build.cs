@@ -0,0 +1,34 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+using UnrealBuildTool;
+
+public class GASAttachRuntime : ModuleRules
+{
+	public GASAttachRuntime(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+			);
+
+		// Kept to what a cooked game or server links anyway - no Slate, no editor
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"GameplayAbilities",
+				"GameplayTags",
+				"Sockets",
+				"Networking",
+			}
+			);
+
+		// GameplayDebugger and WITH_GAMEPLAY_DEBUGGER, for the GAS Attach category
+		SetupGameplayDebuggerSupport(Target);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,402 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachCapture.h"
+#include "GASAttachRuntimeStats.h"
+
+#include "GameplayTagsManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+static TAutoConsoleVariable<float> CVarCaptureInterval(
+	TEXT("GASAttachEditor.Capture.Interval"),
+	.1f,
+	TEXT("Seconds between two snapshots GASAttachEditor.Capture.Record writes."));
+
+static TAutoConsoleVariable<int32> CVarCaptureKeyframeInterval(
+	TEXT("GASAttachEditor.Capture.KeyframeInterval"),
+	100,
+	TEXT("Every how many frames a capture writes a keyframe. Smaller makes jumping around a capture faster, and the file larger."));
+
+static constexpr uint32 CaptureMagic = 0x43534147; // "GASC"
+// 2 added the tag index at the end, which version 1 files do without
+static constexpr uint32 CaptureVersion = 2;
+static constexpr uint32 MinCaptureVersion = 1;
+
+// A frame is its size, its flags and world time, then the message
+static constexpr uint8 CaptureFrameKeyframe = 1 << 0;
+// A record laid out like a frame, but holding the tag index
+static constexpr uint8 CaptureRecordTagIndex = 1 << 1;
+
+// Anything larger is not a capture of ours
+static constexpr int32 MaxCaptureTags = 1024 * 1024;
+
+const TCHAR* FGASCaptureWriter::Extension = TEXT(".gascapture");
+
+FGASCaptureWriter::~FGASCaptureWriter()
+{
+	Close();
+}
+
+bool FGASCaptureWriter::Open(const FString& InFilename)
+{
+	TArray<FString> TagNames;
+	GetTagNames(TagNames);
+
+	return Open(InFilename, TagNames);
+}
+
+bool FGASCaptureWriter::Open(const FString& InFilename, const TArray<FString>& TagNames)
+{
+	Close();
+
+	File.Reset(IFileManager::Get().CreateFileWriter(*InFilename));
+	if (!File)
+	{
+		return false;
+	}
+
+	Filename = InFilename;
+	NumFrames = 0;
+	Writer.Reset();
+	TagIndex.Reset();
+	bTagIndexComplete = true;
+
+	uint32 Magic = CaptureMagic;
+	uint32 Version = CaptureVersion;
+	*File << Magic;
+	*File << Version;
+
+	// Tags are few next to frames, and the reader may have no other way of knowing them
+	int32 NumTags = TagNames.Num();
+	*File << NumTags;
+	for (FString TagName : TagNames)
+	{
+		*File << TagName;
+	}
+
+	return !File->IsError();
+}
+
+void FGASCaptureWriter::GetTagNames(TArray<FString>& OutTagNames)
+{
+	check(IsInGameThread());
+
+	FGameplayTagContainer Tags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(Tags, false);
+
+	OutTagNames.Reset(Tags.Num());
+	for (const FGameplayTag& Tag : Tags)
+	{
+		OutTagNames.Add(Tag.ToString());
+	}
+}
+
+void FGASCaptureWriter::Close()
+{
+	if (!File)
+	{
+		return;
+	}
+
+	if (bTagIndexComplete &&
+		NumFrames > 0)
+	{
+		TArray<uint8> IndexData;
+		FMemoryWriter IndexWriter(IndexData);
+		TagIndex.Serialize(IndexWriter);
+
+		WriteRecord(IndexData, 0.0, CaptureRecordTagIndex);
+	}
+
+	File->Close();
+	File.Reset();
+}
+
+void FGASCaptureWriter::Append(const FGASWorldSnapshot& Snapshot)
+{
+	if (!File)
+	{
+		return;
+	}
+
+	const int32 KeyframeInterval = FMath::Max(CVarCaptureKeyframeInterval.GetValueOnGameThread(), 1);
+	const bool bKeyframe = NumFrames % KeyframeInterval == 0;
+	if (bKeyframe)
+	{
+		Writer.Reset();
+	}
+
+	Writer.Write(Snapshot, Message);
+	TagIndex.Add(NumFrames, Snapshot);
+
+	WriteRecord(Message, Snapshot.WorldTime, bKeyframe ? CaptureFrameKeyframe : 0);
+	++NumFrames;
+}
+
+void FGASCaptureWriter::AppendMessage(const TArray<uint8>& InMessage, const double WorldTime, const bool bKeyframe)
+{
+	if (!File)
+	{
+		return;
+	}
+
+	// There's no snapshot here to index
+	bTagIndexComplete = false;
+
+	WriteRecord(InMessage, WorldTime, bKeyframe ? CaptureFrameKeyframe : 0);
+	++NumFrames;
+}
+
+void FGASCaptureWriter::WriteRecord(const TArray<uint8>& InMessage, double WorldTime, uint8 Flags)
+{
+	uint32 Size = InMessage.Num();
+	*File << Size;
+	*File << Flags;
+	*File << WorldTime;
+	File->Serialize(const_cast<uint8*>(InMessage.GetData()), InMessage.Num());
+}
+
+FString FGASCaptureWriter::MakeFilename(const TCHAR* Prefix)
+{
+	return FPaths::ProjectSavedDir() / TEXT("GASAttachEditor") / FString::Printf(TEXT("%s-%s%s"), Prefix, *FDateTime::Now().ToString(), Extension);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool FGASCapture::Load(const FString& InFilename, FText& OutError)
+{
+	Filename = InFilename;
+	Data.Reset();
+	Frames.Reset();
+	TagNames.Reset();
+	TagIndex.Reset();
+	bHasTagIndex = false;
+	Reader.Reset();
+	Snapshot = FGASWorldSnapshot();
+	DecodedFrame = INDEX_NONE;
+
+	if (!FFileHelper::LoadFileToArray(Data, *Filename))
+	{
+		OutError = FText::Format(LOCTEXT("CaptureReadFailedFormat", "Can't read {0}"), FText::FromString(Filename));
+		return false;
+	}
+
+	FMemoryReader Ar(Data);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumTags = 0;
+	Ar << Magic;
+	Ar << Version;
+	Ar << NumTags;
+
+	if (Ar.IsError() ||
+		Magic != CaptureMagic ||
+		NumTags < 0 ||
+		NumTags > MaxCaptureTags)
+	{
+		OutError = FText::Format(LOCTEXT("CaptureNotCaptureFormat", "{0} is not an Ability System capture"), FText::FromString(Filename));
+		return false;
+	}
+
+	if (Version < MinCaptureVersion ||
+		Version > CaptureVersion)
+	{
+		OutError = FText::Format(LOCTEXT("CaptureVersionFormat", "{0} was written by another version of the viewer"), FText::FromString(Filename));
+		return false;
+	}
+
+	TagNames.Reserve(NumTags);
+	for (int32 NameIndex = 0; NameIndex < NumTags && !Ar.IsError(); ++NameIndex)
+	{
+		FString TagName;
+		Ar << TagName;
+		TagNames.Add(FName(*TagName));
+	}
+
+	// A process that died mid-write leaves a partial last frame; everything before it is still good
+	while (!Ar.IsError() &&
+		Ar.Tell() < Ar.TotalSize())
+	{
+		uint32 Size = 0;
+		uint8 Flags = 0;
+		double WorldTime = 0.0;
+		Ar << Size;
+		Ar << Flags;
+		Ar << WorldTime;
+
+		if (Ar.IsError() ||
+			Size > static_cast<uint64>(Ar.TotalSize() - Ar.Tell()))
+		{
+			break;
+		}
+
+		if (Flags & CaptureRecordTagIndex)
+		{
+			FMemoryReader IndexReader(Data);
+			IndexReader.Seek(Ar.Tell());
+			bHasTagIndex = TagIndex.Serialize(IndexReader);
+
+			Ar.Seek(Ar.Tell() + Size);
+			continue;
+		}
+
+		FFrame& Frame = Frames.AddDefaulted_GetRef();
+		Frame.Offset = Ar.Tell();
+		Frame.Size = Size;
+		Frame.WorldTime = WorldTime;
+		Frame.bKeyframe = (Flags & CaptureFrameKeyframe) != 0;
+
+		Ar.Seek(Frame.Offset + Size);
+	}
+
+	// An index that doesn't cover the frames that made it here is of no use
+	if (bHasTagIndex &&
+		TagIndex.GetNumFrames() != Frames.Num())
+	{
+		TagIndex.Reset();
+		bHasTagIndex = false;
+	}
+
+	if (Frames.Num() == 0 ||
+		!Frames[0].bKeyframe)
+	{
+		OutError = FText::Format(LOCTEXT("CaptureEmptyFormat", "{0} holds no snapshot"), FText::FromString(Filename));
+		Frames.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+const FGASWorldSnapshot* FGASCapture::GetFrame(const int32 FrameIndex)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_CaptureSeek);
+
+	if (!Frames.IsValidIndex(FrameIndex))
+	{
+		return nullptr;
+	}
+
+	if (FrameIndex == DecodedFrame)
+	{
+		return &Snapshot;
+	}
+
+	int32 StartFrame = FrameIndex;
+	while (StartFrame > 0 &&
+		!Frames[StartFrame].bKeyframe)
+	{
+		--StartFrame;
+	}
+
+	// Stepping forward within the same keyframe's run goes on from where the last decode stopped
+	if (DecodedFrame != INDEX_NONE &&
+		DecodedFrame >= StartFrame &&
+		DecodedFrame < FrameIndex)
+	{
+		StartFrame = DecodedFrame + 1;
+	}
+
+	for (int32 Index = StartFrame; Index <= FrameIndex; ++Index)
+	{
+		const FFrame& Frame = Frames[Index];
+
+		Message.SetNumUninitialized(Frame.Size);
+		FMemory::Memcpy(Message.GetData(), Data.GetData() + Frame.Offset, Frame.Size);
+
+		if (!Reader.Read(Message, Snapshot))
+		{
+			DecodedFrame = INDEX_NONE;
+			return nullptr;
+		}
+
+		DecodedFrame = Index;
+	}
+
+	return &Snapshot;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FGASCaptureRecorder::~FGASCaptureRecorder()
+{
+	Stop();
+}
+
+bool FGASCaptureRecorder::Start(const FString& Filename, const FGASRecordingProfile& InProfile)
+{
+	Stop();
+
+	Profile = InProfile;
+	CaptureComponent = Profile.GetCaptureFunction();
+	Filter = Profile.MakeFilter();
+
+	if (!Writer.Open(Filename))
+	{
+		Writer.Close();
+		return false;
+	}
+
+	NextCaptureTime = 0.0;
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGASCaptureRecorder::Tick));
+
+	return true;
+}
+
+void FGASCaptureRecorder::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	Writer.Close();
+}
+
+bool FGASCaptureRecorder::Tick(float DeltaTime)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_CaptureRecord);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime < NextCaptureTime)
+	{
+		return true;
+	}
+	NextCaptureTime = CurrentTime + (Profile.Interval > 0.f ? Profile.Interval : CVarCaptureInterval.GetValueOnGameThread());
+
+	FGASWorldSnapshot::CaptureGameWorld(Snapshot, Filter, [this](const UAbilitySystemComponent& Component, FGASComponentSnapshot& OutSnapshot)
+	{
+		CaptureComponent(Component, Profile.Attributes, OutSnapshot);
+	});
+	Writer.Append(Snapshot);
+
+	return true;
+}
+
+bool FGASCaptureRecorder::SaveSnapshot(const FString& Filename)
+{
+	FGASCaptureWriter SnapshotWriter;
+	if (!SnapshotWriter.Open(Filename))
+	{
+		return false;
+	}
+
+	FGASWorldSnapshot WorldSnapshot;
+	FGASWorldSnapshot::CaptureGameWorld(WorldSnapshot);
+	SnapshotWriter.Append(WorldSnapshot);
+
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
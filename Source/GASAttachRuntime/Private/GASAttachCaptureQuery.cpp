@@ -0,0 +1,688 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachCaptureQuery.h"
+#include "GASAttachCapture.h"
+#include "GASAttachRuntimeStats.h"
+
+#include "Math/VectorRegister.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+static void SetFrameBit(TMap<FName, FGASCaptureColumns::FBitmap>& Bitmaps, const FName Name, const int32 NumWords, const int32 Word, const uint64 Bit)
+{
+	FGASCaptureColumns::FBitmap* Bitmap = Bitmaps.Find(Name);
+	if (!Bitmap)
+	{
+		Bitmap = &Bitmaps.Add(Name);
+		Bitmap->SetNumZeroed(NumWords);
+	}
+
+	(*Bitmap)[Word] |= Bit;
+}
+
+bool FGASCaptureColumns::Build(FGASCapture& Capture)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_CaptureQuery);
+
+	const int32 TotalFrames = Capture.GetNumFrames();
+
+	NumFrames = 0;
+	NumWords = (TotalFrames + 63) / 64;
+	Components.Reset();
+
+	TMap<uint32, int32> ComponentIndices;
+	// The same few names come up in every frame; splitting and cleaning them once is enough
+	TMap<FName, TArray<FName>> TagPrefixes;
+	TMap<FName, FName> CleanNames;
+	TMap<TPair<FName, FName>, FName> AttributeKeys;
+
+	auto GetCleanName = [&CleanNames](const FName ClassPath)
+	{
+		FName* CleanName = CleanNames.Find(ClassPath);
+		return CleanName ? *CleanName : CleanNames.Add(ClassPath, FName(*FGASWorldSnapshot::GetCleanName(ClassPath)));
+	};
+
+	// "HealthSet.Health", so that attributes of the same name in two sets keep a column each
+	auto GetAttributeKey = [&AttributeKeys, &GetCleanName](const FGASAttributeSnapshot& Attribute)
+	{
+		const TPair<FName, FName> SetAndName(Attribute.Set, Attribute.Name);
+		FName* Key = AttributeKeys.Find(SetAndName);
+		return Key ? *Key : AttributeKeys.Add(SetAndName, FName(*FString::Printf(TEXT("%s.%s"), *GetCleanName(Attribute.Set).ToString(), *Attribute.Name.ToString())));
+	};
+
+	auto GetTagPrefixes = [&TagPrefixes](const FName Tag) -> const TArray<FName>&
+	{
+		if (const TArray<FName>* Prefixes = TagPrefixes.Find(Tag))
+		{
+			return *Prefixes;
+		}
+
+		TArray<FName>& Prefixes = TagPrefixes.Add(Tag);
+
+		const FString TagString = Tag.ToString();
+		for (int32 Index = TagString.Find(TEXT(".")); Index != INDEX_NONE; Index = TagString.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1))
+		{
+			Prefixes.Add(FName(*TagString.Left(Index)));
+		}
+		Prefixes.Add(Tag);
+
+		return Prefixes;
+	};
+
+	for (int32 Frame = 0; Frame < TotalFrames; ++Frame)
+	{
+		const FGASWorldSnapshot* Snapshot = Capture.GetFrame(Frame);
+		if (!Snapshot)
+		{
+			NumFrames = Frame;
+			return false;
+		}
+
+		const int32 Word = Frame / 64;
+		const uint64 Bit = uint64(1) << (Frame % 64);
+
+		for (const FGASComponentSnapshot& Component : Snapshot->Components)
+		{
+			int32& Index = ComponentIndices.FindOrAdd(Component.Id, INDEX_NONE);
+			if (Index == INDEX_NONE)
+			{
+				Index = Components.Num();
+
+				FComponentColumns& NewColumns = Components.AddDefaulted_GetRef();
+				NewColumns.Id = Component.Id;
+				NewColumns.OwnerName = Component.OwnerName;
+				NewColumns.Present.SetNumZeroed(NumWords);
+			}
+
+			FComponentColumns& Columns = Components[Index];
+			Columns.Present[Word] |= Bit;
+
+			for (const FGASAttributeSnapshot& Attribute : Component.Attributes)
+			{
+				const FName Key = GetAttributeKey(Attribute);
+				FAttributeColumn* Column = Columns.Attributes.Find(Key);
+				if (!Column)
+				{
+					Column = &Columns.Attributes.Add(Key);
+					Column->FirstWord = Word;
+
+					// A bare name stands for the column as long as no other set of the component has one by that name
+					FName* Alias = Columns.AttributeAliases.Find(Attribute.Name);
+					if (!Alias)
+					{
+						Columns.AttributeAliases.Add(Attribute.Name, Key);
+					}
+					else if (*Alias != Key)
+					{
+						*Alias = NAME_None;
+					}
+				}
+
+				// Grown a word at a time as frames come, the gap filled with NaN
+				const int32 NumColumnWords = Word - Column->FirstWord + 1;
+				if (Column->GetNumWords() < NumColumnWords)
+				{
+					const int32 OldNum = Column->Values.Num();
+					Column->Values.SetNumUninitialized(NumColumnWords * 64);
+					for (int32 Index = OldNum; Index < Column->Values.Num(); ++Index)
+					{
+						Column->Values[Index] = NAN;
+					}
+				}
+
+				Column->Values[Frame - Column->FirstWord * 64] = Attribute.CurrentValue;
+			}
+
+			for (const FGASTagSnapshot& Tag : Component.OwnedTags)
+			{
+				for (const FName Prefix : GetTagPrefixes(Tag.Tag))
+				{
+					SetFrameBit(Columns.Tags, Prefix, NumWords, Word, Bit);
+				}
+			}
+
+			for (const FGASEffectSnapshot& Effect : Component.Effects)
+			{
+				SetFrameBit(Columns.Effects, GetCleanName(Effect.Def), NumWords, Word, Bit);
+			}
+
+			for (const FGASAbilitySnapshot& Ability : Component.Abilities)
+			{
+				if (Ability.State == EGASAbilitySnapshotState::Active)
+				{
+					SetFrameBit(Columns.Abilities, GetCleanName(Ability.Ability), NumWords, Word, Bit);
+				}
+			}
+		}
+	}
+
+	NumFrames = TotalFrames;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+struct FGASCaptureQueryParser
+{
+	const FString& Text;
+	FGASCaptureQuery& Query;
+	int32 Position = 0;
+	FText Error;
+
+	FGASCaptureQueryParser(const FString& InText, FGASCaptureQuery& InQuery)
+		: Text(InText)
+		, Query(InQuery)
+	{
+	}
+
+	static bool IsNameChar(const TCHAR Char)
+	{
+		return FChar::IsAlnum(Char) || Char == TEXT('_') || Char == TEXT('.');
+	}
+
+	void SkipWhitespace()
+	{
+		while (Position < Text.Len() &&
+			FChar::IsWhitespace(Text[Position]))
+		{
+			++Position;
+		}
+	}
+
+	bool IsAtEnd()
+	{
+		SkipWhitespace();
+		return Position >= Text.Len();
+	}
+
+	bool MatchSymbol(const TCHAR* Symbol)
+	{
+		SkipWhitespace();
+
+		const int32 Length = FCString::Strlen(Symbol);
+		if (FCString::Strncmp(*Text + Position, Symbol, Length) != 0)
+		{
+			return false;
+		}
+
+		Position += Length;
+		return true;
+	}
+
+	bool MatchKeyword(const TCHAR* Keyword)
+	{
+		SkipWhitespace();
+
+		const int32 Length = FCString::Strlen(Keyword);
+		if (Position + Length > Text.Len() ||
+			FCString::Strnicmp(*Text + Position, Keyword, Length) != 0 ||
+			(Position + Length < Text.Len() && IsNameChar(Text[Position + Length])))
+		{
+			return false;
+		}
+
+		Position += Length;
+		return true;
+	}
+
+	FName ReadName()
+	{
+		SkipWhitespace();
+
+		const int32 Start = Position;
+		while (Position < Text.Len() &&
+			IsNameChar(Text[Position]))
+		{
+			++Position;
+		}
+
+		return Position > Start ? FName(*Text.Mid(Start, Position - Start)) : NAME_None;
+	}
+
+	bool ReadNumber(float& OutValue)
+	{
+		SkipWhitespace();
+
+		const int32 Start = Position;
+		if (Position < Text.Len() &&
+			(Text[Position] == TEXT('-') || Text[Position] == TEXT('+')))
+		{
+			++Position;
+		}
+
+		bool bDigits = false;
+		while (Position < Text.Len() &&
+			(FChar::IsDigit(Text[Position]) || Text[Position] == TEXT('.')))
+		{
+			bDigits |= FChar::IsDigit(Text[Position]);
+			++Position;
+		}
+
+		if (!bDigits)
+		{
+			Position = Start;
+			return false;
+		}
+
+		OutValue = FCString::Atof(*Text.Mid(Start, Position - Start));
+		return true;
+	}
+
+	int32 Fail(const FText& Message)
+	{
+		if (Error.IsEmpty())
+		{
+			Error = FText::Format(LOCTEXT("QueryErrorFormat", "{0} at column {1}"), Message, FText::AsNumber(Position + 1));
+		}
+		return INDEX_NONE;
+	}
+
+	int32 AddNode(const FGASCaptureQuery::ENodeType Type, const int32 Left = INDEX_NONE, const int32 Right = INDEX_NONE)
+	{
+		FGASCaptureQuery::FNode& Node = Query.Nodes.AddDefaulted_GetRef();
+		Node.Type = Type;
+		Node.Left = Left;
+		Node.Right = Right;
+		return Query.Nodes.Num() - 1;
+	}
+
+	int32 ParseOr()
+	{
+		int32 Left = ParseAnd();
+		while (Left != INDEX_NONE &&
+			(MatchKeyword(TEXT("or")) || MatchSymbol(TEXT("||"))))
+		{
+			const int32 Right = ParseAnd();
+			Left = Right != INDEX_NONE ? AddNode(FGASCaptureQuery::ENodeType::Or, Left, Right) : INDEX_NONE;
+		}
+		return Left;
+	}
+
+	int32 ParseAnd()
+	{
+		int32 Left = ParseUnary();
+		while (Left != INDEX_NONE &&
+			(MatchKeyword(TEXT("and")) || MatchSymbol(TEXT("&&"))))
+		{
+			const int32 Right = ParseUnary();
+			Left = Right != INDEX_NONE ? AddNode(FGASCaptureQuery::ENodeType::And, Left, Right) : INDEX_NONE;
+		}
+		return Left;
+	}
+
+	int32 ParseUnary()
+	{
+		if (MatchKeyword(TEXT("not")) ||
+			MatchSymbol(TEXT("!")))
+		{
+			const int32 Operand = ParseUnary();
+			return Operand != INDEX_NONE ? AddNode(FGASCaptureQuery::ENodeType::Not, Operand) : INDEX_NONE;
+		}
+
+		if (MatchSymbol(TEXT("(")))
+		{
+			const int32 Inner = ParseOr();
+			if (Inner == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+
+			return MatchSymbol(TEXT(")")) ? Inner : Fail(LOCTEXT("QueryExpectedClose", "Expected )"));
+		}
+
+		return ParsePredicate();
+	}
+
+	int32 ParsePredicate()
+	{
+		FGASCaptureQuery::ENodeType Type = FGASCaptureQuery::ENodeType::Tag;
+		if (MatchKeyword(TEXT("effect")))
+		{
+			Type = FGASCaptureQuery::ENodeType::Effect;
+		}
+		else if (MatchKeyword(TEXT("ability")))
+		{
+			Type = FGASCaptureQuery::ENodeType::Ability;
+		}
+		else if (MatchKeyword(TEXT("tag")))
+		{
+			Type = FGASCaptureQuery::ENodeType::Tag;
+		}
+
+		const FName Name = ReadName();
+		if (Name.IsNone())
+		{
+			return Fail(LOCTEXT("QueryExpectedName", "Expected an attribute, tag, effect or ability"));
+		}
+
+		// Two-character operators first, so that <= isn't read as <
+		static const TPair<const TCHAR*, FGASCaptureQuery::ECompare> Operators[] =
+		{
+			{ TEXT("<="), FGASCaptureQuery::ECompare::LessEqual },
+			{ TEXT(">="), FGASCaptureQuery::ECompare::GreaterEqual },
+			{ TEXT("=="), FGASCaptureQuery::ECompare::Equal },
+			{ TEXT("!="), FGASCaptureQuery::ECompare::NotEqual },
+			{ TEXT("<"), FGASCaptureQuery::ECompare::Less },
+			{ TEXT(">"), FGASCaptureQuery::ECompare::Greater },
+			{ TEXT("="), FGASCaptureQuery::ECompare::Equal },
+		};
+
+		if (Type == FGASCaptureQuery::ENodeType::Tag)
+		{
+			for (const TPair<const TCHAR*, FGASCaptureQuery::ECompare>& Operator : Operators)
+			{
+				if (!MatchSymbol(Operator.Key))
+				{
+					continue;
+				}
+
+				float Value = 0.f;
+				if (!ReadNumber(Value))
+				{
+					return Fail(LOCTEXT("QueryExpectedNumber", "Expected a number"));
+				}
+
+				const int32 NodeIndex = AddNode(FGASCaptureQuery::ENodeType::Attribute);
+				Query.Nodes[NodeIndex].Name = Name;
+				Query.Nodes[NodeIndex].Compare = Operator.Value;
+				Query.Nodes[NodeIndex].Value = Value;
+				return NodeIndex;
+			}
+		}
+
+		const int32 NodeIndex = AddNode(Type);
+		Query.Nodes[NodeIndex].Name = Name;
+		return NodeIndex;
+	}
+};
+
+bool FGASCaptureQuery::Parse(const FString& Text, FText& OutError)
+{
+	Nodes.Reset();
+	Root = INDEX_NONE;
+
+	FGASCaptureQueryParser Parser(Text, *this);
+	if (Parser.IsAtEnd())
+	{
+		OutError = LOCTEXT("QueryEmpty", "Type a condition, e.g. Health < 10 and State.Stunned");
+		return false;
+	}
+
+	const int32 ParsedRoot = Parser.ParseOr();
+	if (ParsedRoot != INDEX_NONE &&
+		!Parser.IsAtEnd())
+	{
+		Parser.Fail(LOCTEXT("QueryUnexpected", "Expected and, or, or the end"));
+	}
+
+	if (!Parser.Error.IsEmpty())
+	{
+		OutError = Parser.Error;
+		Nodes.Reset();
+		return false;
+	}
+
+	Root = ParsedRoot;
+	return true;
+}
+
+// Compares 64 frames a word, four at a time, without a branch per frame
+template<typename CompareType>
+static void ScanColumn(const float* Values, const int32 NumWords, const float Value, uint64* OutWords, CompareType Compare)
+{
+	const VectorRegister4Float Threshold = VectorSetFloat1(Value);
+	for (int32 Word = 0; Word < NumWords; ++Word)
+	{
+		const float* WordValues = Values + Word * 64;
+
+		uint64 Bits = 0;
+		for (int32 Group = 0; Group < 16; ++Group)
+		{
+			const VectorRegister4Float Values4 = VectorLoad(WordValues + Group * 4);
+			Bits |= static_cast<uint64>(VectorMaskBits(Compare(Values4, Threshold))) << (Group * 4);
+		}
+		OutWords[Word] = Bits;
+	}
+}
+
+static void CopyBitmap(const TMap<FName, FGASCaptureColumns::FBitmap>& Bitmaps, const FName Name, FGASCaptureColumns::FBitmap& OutBitmap)
+{
+	if (const FGASCaptureColumns::FBitmap* Bitmap = Bitmaps.Find(Name))
+	{
+		OutBitmap = *Bitmap;
+	}
+}
+
+void FGASCaptureQuery::Evaluate(const int32 NodeIndex, const FGASCaptureColumns::FComponentColumns& Component, const int32 NumWords, FGASCaptureColumns::FBitmap& OutBitmap) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+
+	OutBitmap.Reset();
+	OutBitmap.SetNumZeroed(NumWords);
+
+	switch (Node.Type)
+	{
+	case ENodeType::Attribute:
+	{
+		const FGASCaptureColumns::FAttributeColumn* Column = Component.Attributes.Find(Node.Name);
+		if (!Column)
+		{
+			const FName* Alias = Component.AttributeAliases.Find(Node.Name);
+			Column = Alias && !Alias->IsNone() ? Component.Attributes.Find(*Alias) : nullptr;
+		}
+		if (!Column)
+		{
+			return;
+		}
+
+		// Words outside the column's span stay zero, as NaN would have left them
+		const float* Values = Column->Values.GetData();
+		const int32 NumColumnWords = FMath::Min(Column->GetNumWords(), NumWords - Column->FirstWord);
+		uint64* Words = OutBitmap.GetData() + Column->FirstWord;
+		switch (Node.Compare)
+		{
+		case ECompare::Less:			ScanColumn(Values, NumColumnWords, Node.Value, Words, [](const VectorRegister4Float& A, const VectorRegister4Float& B) { return VectorCompareLT(A, B); }); break;
+		case ECompare::LessEqual:		ScanColumn(Values, NumColumnWords, Node.Value, Words, [](const VectorRegister4Float& A, const VectorRegister4Float& B) { return VectorCompareLE(A, B); }); break;
+		case ECompare::Greater:			ScanColumn(Values, NumColumnWords, Node.Value, Words, [](const VectorRegister4Float& A, const VectorRegister4Float& B) { return VectorCompareGT(A, B); }); break;
+		case ECompare::GreaterEqual:	ScanColumn(Values, NumColumnWords, Node.Value, Words, [](const VectorRegister4Float& A, const VectorRegister4Float& B) { return VectorCompareGE(A, B); }); break;
+		case ECompare::Equal:			ScanColumn(Values, NumColumnWords, Node.Value, Words, [](const VectorRegister4Float& A, const VectorRegister4Float& B) { return VectorCompareEQ(A, B); }); break;
+		// NaN is unequal to everything, but a frame without the attribute is no match either
+		case ECompare::NotEqual:		ScanColumn(Values, NumColumnWords, Node.Value, Words, [](const VectorRegister4Float& A, const VectorRegister4Float& B) { return VectorBitwiseAnd(VectorCompareNE(A, B), VectorCompareEQ(A, A)); }); break;
+		}
+		return;
+	}
+	case ENodeType::Tag:
+		CopyBitmap(Component.Tags, Node.Name, OutBitmap);
+		return;
+	case ENodeType::Effect:
+		CopyBitmap(Component.Effects, Node.Name, OutBitmap);
+		return;
+	case ENodeType::Ability:
+		CopyBitmap(Component.Abilities, Node.Name, OutBitmap);
+		return;
+	case ENodeType::Not:
+		Evaluate(Node.Left, Component, NumWords, OutBitmap);
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			OutBitmap[Word] = ~OutBitmap[Word] & Component.Present[Word];
+		}
+		return;
+	case ENodeType::And:
+	case ENodeType::Or:
+	{
+		FGASCaptureColumns::FBitmap Right;
+		Evaluate(Node.Left, Component, NumWords, OutBitmap);
+		Evaluate(Node.Right, Component, NumWords, Right);
+
+		if (Node.Type == ENodeType::And)
+		{
+			for (int32 Word = 0; Word < NumWords; ++Word)
+			{
+				OutBitmap[Word] &= Right[Word];
+			}
+		}
+		else
+		{
+			for (int32 Word = 0; Word < NumWords; ++Word)
+			{
+				OutBitmap[Word] |= Right[Word];
+			}
+		}
+		return;
+	}
+	}
+}
+
+void FGASCaptureQuery::Run(const FGASCaptureColumns& Columns, TArray<FMatch>& OutMatches) const
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_CaptureQuery);
+
+	OutMatches.Reset();
+	if (Root == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 NumWords = Columns.GetNumWords();
+
+	FGASCaptureColumns::FBitmap Bitmap;
+	for (const FGASCaptureColumns::FComponentColumns& Component : Columns.GetComponents())
+	{
+		Evaluate(Root, Component, NumWords, Bitmap);
+
+		int32 RunStart = INDEX_NONE;
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			const uint64 Bits = Bitmap[Word] & Component.Present[Word];
+
+			// Whole words in or out of a run are the common case
+			if ((Bits == 0 && RunStart == INDEX_NONE) ||
+				(Bits == MAX_uint64 && RunStart != INDEX_NONE))
+			{
+				continue;
+			}
+
+			for (int32 Bit = 0; Bit < 64; ++Bit)
+			{
+				const int32 Frame = Word * 64 + Bit;
+				const bool bMatch = (Bits >> Bit) & 1;
+				if (bMatch && RunStart == INDEX_NONE)
+				{
+					RunStart = Frame;
+				}
+				else if (!bMatch && RunStart != INDEX_NONE)
+				{
+					OutMatches.Add({ Component.Id, Component.OwnerName, RunStart, Frame - 1 });
+					RunStart = INDEX_NONE;
+				}
+			}
+		}
+
+		if (RunStart != INDEX_NONE)
+		{
+			OutMatches.Add({ Component.Id, Component.OwnerName, RunStart, Columns.GetNumFrames() - 1 });
+		}
+	}
+
+	SortMatches(OutMatches);
+}
+
+bool FGASCaptureQuery::UsesOnlyTags() const
+{
+	if (Root == INDEX_NONE)
+	{
+		return false;
+	}
+
+	for (const FNode& Node : Nodes)
+	{
+		if (Node.Type == ENodeType::Attribute ||
+			Node.Type == ENodeType::Effect ||
+			Node.Type == ENodeType::Ability)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FGASCaptureQuery::Evaluate(const int32 NodeIndex, const FGASTagIndex::FComponentTags& Component, FGASFrameRuns& OutRuns) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+
+	switch (Node.Type)
+	{
+	case ENodeType::Tag:
+		FGASTagIndex::GetTagRuns(Component, Node.Name, OutRuns);
+		return;
+	case ENodeType::Not:
+	{
+		FGASFrameRuns Operand;
+		Evaluate(Node.Left, Component, Operand);
+		FGASFrameRuns::Subtract(Component.Present, Operand, OutRuns);
+		return;
+	}
+	case ENodeType::And:
+	case ENodeType::Or:
+	{
+		FGASFrameRuns Left;
+		FGASFrameRuns Right;
+		Evaluate(Node.Left, Component, Left);
+		Evaluate(Node.Right, Component, Right);
+
+		if (Node.Type == ENodeType::And)
+		{
+			FGASFrameRuns::Intersect(Left, Right, OutRuns);
+		}
+		else
+		{
+			FGASFrameRuns::Union(Left, Right, OutRuns);
+		}
+		return;
+	}
+	default:
+		// Not in the index; UsesOnlyTags keeps these out
+		OutRuns.Runs.Reset();
+		return;
+	}
+}
+
+void FGASCaptureQuery::Run(const FGASTagIndex& TagIndex, TArray<FMatch>& OutMatches) const
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_CaptureQuery);
+
+	OutMatches.Reset();
+	if (!ensure(UsesOnlyTags()))
+	{
+		return;
+	}
+
+	FGASFrameRuns Runs;
+	FGASFrameRuns Clipped;
+	for (const FGASTagIndex::FComponentTags& Component : TagIndex.GetComponents())
+	{
+		Evaluate(Root, Component, Runs);
+		FGASFrameRuns::Intersect(Runs, Component.Present, Clipped);
+
+		for (const FGASFrameRuns::FRun& Run : Clipped.Runs)
+		{
+			OutMatches.Add({ Component.Id, Component.OwnerName, Run.First, Run.Last });
+		}
+	}
+
+	SortMatches(OutMatches);
+}
+
+void FGASCaptureQuery::SortMatches(TArray<FMatch>& Matches)
+{
+	// Timeline order, which is how they're stepped through
+	Matches.Sort([](const FMatch& A, const FMatch& B)
+	{
+		return A.FirstFrame != B.FirstFrame ? A.FirstFrame < B.FirstFrame : A.OwnerName.LexicalLess(B.OwnerName);
+	});
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
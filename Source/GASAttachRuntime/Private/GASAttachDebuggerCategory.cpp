@@ -0,0 +1,253 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachDebuggerCategory.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "GASAttachRuntimeStats.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGASAttachEditorDebuggerBytesPerFrame(
+	TEXT("GASAttachEditor.Debugger.BytesPerFrame"),
+	256,
+	TEXT("Average number of bytes per server frame the Gameplay Debugger's GAS Attach category may send; changes beyond it are held back until enough frames have passed.\n")
+	TEXT("0 sends every change as it happens."),
+	ECVF_Default);
+
+void FGameplayDebuggerCategory_GASAttach::FRepKeyframe::Serialize(FArchive& Ar)
+{
+	Ar << Version;
+	Ar << Message;
+}
+
+void FGameplayDebuggerCategory_GASAttach::FRepDelta::Serialize(FArchive& Ar)
+{
+	Ar << KeyframeVersion;
+	Ar << Message;
+}
+
+FGameplayDebuggerCategory_GASAttach::FGameplayDebuggerCategory_GASAttach()
+{
+	CollectDataInterval = 0.2f;
+	bShowOnlyWithDebugActor = true;
+	bShowDataPackReplication = true;
+
+	// Persistent, as a change held back by the budget leaves the last sent packs as they are
+	SetDataPackReplication<FRepKeyframe>(&KeyframeData, EGameplayDebuggerDataPack::Persistent);
+	SetDataPackReplication<FRepDelta>(&DeltaData, EGameplayDebuggerDataPack::Persistent);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_GASAttach::MakeInstance()
+{
+	return MakeShared<FGameplayDebuggerCategory_GASAttach>();
+}
+
+void FGameplayDebuggerCategory_GASAttach::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_DebuggerCollect);
+
+	const UAbilitySystemComponent* Component = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(DebugActor);
+	if (Component)
+	{
+		Collected.Components.SetNum(1);
+		FGASComponentSnapshot::Capture(*Component, Collected.Components[0]);
+	}
+	else
+	{
+		Collected.Components.Reset();
+	}
+	Collected.RebuildIndex();
+
+	// The client goes by its own estimate of the server's time, so that a component that doesn't change
+	// encodes to the same bytes and its packs aren't sent again
+	Collected.Frame = 0;
+	Collected.WorldTime = 0.0;
+	Collected.TimeDilation = 1.f;
+
+	Publish(Collected);
+}
+
+bool FGameplayDebuggerCategory_GASAttach::Publish(const FGASWorldSnapshot& Snapshot)
+{
+	const int32 BytesPerFrame = CVarGASAttachEditorDebuggerBytesPerFrame.GetValueOnGameThread();
+	const uint64 Frames = FMath::Max<uint64>(GFrameCounter - LastCollectFrame, 1);
+	LastCollectFrame = GFrameCounter;
+
+	const bool bHasKeyframe = KeyframeData.Version != 0;
+
+	FGASSnapshotDeltaWriter DeltaWriter = KeyframeWriter;
+	TArray<uint8> Delta;
+	if (bHasKeyframe)
+	{
+		DeltaWriter.Write(Snapshot, Delta);
+		if (Delta == DeltaData.Message)
+		{
+			return true;
+		}
+	}
+
+	// Once the state has drifted far enough from the keyframe that the delta costs half as much, a new
+	// keyframe makes the deltas after it small again
+	FGASSnapshotDeltaWriter NewKeyframeWriter;
+	TArray<uint8> NewKeyframe;
+	const bool bNewKeyframe = !bHasKeyframe || Delta.Num() * 2 > KeyframeData.Message.Num();
+	if (bNewKeyframe)
+	{
+		NewKeyframeWriter.Write(Snapshot, NewKeyframe);
+
+		DeltaWriter = NewKeyframeWriter;
+		DeltaWriter.Write(Snapshot, Delta);
+	}
+
+	const int32 Cost = NewKeyframe.Num() + Delta.Num();
+	if (BytesPerFrame > 0)
+	{
+		// Saved up for as long as a change is held back, but never more than one interval's worth past it
+		const float Income = static_cast<float>(BytesPerFrame) * Frames;
+		ByteAllowance = FMath::Min(ByteAllowance + Income, FMath::Max(static_cast<float>(Cost), Income));
+		if (ByteAllowance < Cost)
+		{
+			return false;
+		}
+		ByteAllowance -= Cost;
+	}
+
+	if (bNewKeyframe)
+	{
+		KeyframeWriter = MoveTemp(NewKeyframeWriter);
+		KeyframeData.Version = KeyframeData.Version == MAX_uint16 ? 1 : KeyframeData.Version + 1;
+		KeyframeData.Message = MoveTemp(NewKeyframe);
+	}
+
+	DeltaData.KeyframeVersion = KeyframeData.Version;
+	DeltaData.Message = MoveTemp(Delta);
+
+	return true;
+}
+
+void FGameplayDebuggerCategory_GASAttach::Decode()
+{
+	if (KeyframeData.Version == 0)
+	{
+		return;
+	}
+
+	if (!bKeyframeDecoded ||
+		DecodedKeyframeVersion != KeyframeData.Version)
+	{
+		DecodedKeyframeVersion = KeyframeData.Version;
+		DecodedDelta.Reset();
+
+		KeyframeReader.Reset();
+		KeyframeState = FGASWorldSnapshot();
+		bKeyframeDecoded = KeyframeReader.Read(KeyframeData.Message, KeyframeState);
+		if (!bKeyframeDecoded)
+		{
+			bDisplayedValid = false;
+			return;
+		}
+	}
+
+	// The packs replicate independently; until both have arrived, keep showing the last state decoded
+	if (DeltaData.KeyframeVersion != DecodedKeyframeVersion ||
+		DeltaData.Message == DecodedDelta)
+	{
+		return;
+	}
+
+	DecodedDelta = DeltaData.Message;
+
+	FGASSnapshotDeltaReader DeltaReader = KeyframeReader;
+	Displayed = KeyframeState;
+	bDisplayedValid = DeltaReader.Read(DeltaData.Message, Displayed);
+}
+
+static const TCHAR* GetAbilityStateText(const EGASAbilitySnapshotState State)
+{
+	switch (State)
+	{
+	case EGASAbilitySnapshotState::Active:			return TEXT("{green}Active");
+	case EGASAbilitySnapshotState::InputBlocked:	return TEXT("{red}Input blocked");
+	case EGASAbilitySnapshotState::TagBlocked:		return TEXT("{red}Tag blocked");
+	case EGASAbilitySnapshotState::Cooldown:		return TEXT("{orange}Cooldown");
+	default:										return TEXT("{grey}Inactive");
+	}
+}
+
+void FGameplayDebuggerCategory_GASAttach::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	Decode();
+
+	if (!bDisplayedValid)
+	{
+		CanvasContext.Printf(TEXT("{grey}Waiting for data"));
+		return;
+	}
+
+	if (Displayed.Components.Num() == 0)
+	{
+		CanvasContext.Printf(TEXT("{red}No Ability System Component on the debug actor"));
+		return;
+	}
+
+	const FGASComponentSnapshot& Component = Displayed.Components[0];
+
+	const UWorld* World = OwnerPC ? OwnerPC->GetWorld() : nullptr;
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	const double WorldTime = GameState ? GameState->GetServerWorldTimeSeconds() : World ? World->GetTimeSeconds() : 0.0;
+
+	CanvasContext.Printf(TEXT("{white}%s {grey}(%s)  keyframe %d B, delta %d B"),
+		*Component.OwnerName.ToString(), *Component.OwnerClass.ToString(), KeyframeData.Message.Num(), DeltaData.Message.Num());
+
+	CanvasContext.Printf(TEXT("{yellow}Abilities"));
+	for (const FGASAbilitySnapshot& Ability : Component.Abilities)
+	{
+		if (Ability.State == EGASAbilitySnapshotState::Cooldown)
+		{
+			const double Remaining = Ability.CooldownStartWorldTime + Ability.CooldownDuration - WorldTime;
+			CanvasContext.Printf(TEXT("  {white}%s {grey}L%d %s {grey}%.1fs"),
+				*FGASWorldSnapshot::GetCleanName(Ability.Ability), Ability.Level, GetAbilityStateText(Ability.State), FMath::Max(Remaining, 0.0));
+			continue;
+		}
+
+		CanvasContext.Printf(TEXT("  {white}%s {grey}L%d %s"),
+			*FGASWorldSnapshot::GetCleanName(Ability.Ability), Ability.Level, GetAbilityStateText(Ability.State));
+	}
+
+	CanvasContext.Printf(TEXT("{yellow}Effects"));
+	for (const FGASEffectSnapshot& Effect : Component.Effects)
+	{
+		const FString Duration = Effect.Duration > 0.f
+			? FString::Printf(TEXT("%.1fs"), FMath::Max(Effect.StartWorldTime + Effect.Duration - WorldTime, 0.0))
+			: FString(TEXT("infinite"));
+
+		CanvasContext.Printf(TEXT("  {white}%s {grey}L%.0f x%d %s%s"),
+			*FGASWorldSnapshot::GetCleanName(Effect.Def), Effect.Level, Effect.StackCount, *Duration,
+			Effect.bInhibited ? TEXT(" {red}inhibited") : TEXT(""));
+	}
+
+	CanvasContext.Printf(TEXT("{yellow}Attributes"));
+	for (const FGASAttributeSnapshot& Attribute : Component.Attributes)
+	{
+		CanvasContext.Printf(TEXT("  {grey}%s.{white}%s {green}%.2f {grey}(base %.2f)"),
+			*FGASWorldSnapshot::GetCleanName(Attribute.Set), *Attribute.Name.ToString(), Attribute.CurrentValue, Attribute.BaseValue);
+	}
+
+	CanvasContext.Printf(TEXT("{yellow}Tags"));
+	for (const FGASTagSnapshot& Tag : Component.OwnedTags)
+	{
+		CanvasContext.Printf(TEXT("  {white}%s {grey}x%d"), *Tag.Tag.ToString(), Tag.Count);
+	}
+	for (const FName& Tag : Component.BlockedTags)
+	{
+		CanvasContext.Printf(TEXT("  {red}%s {grey}blocked"), *Tag.ToString());
+	}
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
\ No newline at end of file
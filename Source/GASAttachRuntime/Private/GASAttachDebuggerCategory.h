@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "GameplayDebuggerCategory.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachSnapshotDelta.h"
+
+/**
+ * Gameplay Debugger category showing the abilities, effects, attributes and tags of the debug actor's
+ * component, for builds and connections where the editor's viewer isn't there.
+ *
+ * The server captures the component with the plugin's collector and sends it as two data packs: a keyframe,
+ * resent rarely, and the delta of the current state against that keyframe. Each pack only goes over the
+ * wire when its bytes change, and never faster than GASAttachEditor.Debugger.BytesPerFrame allows.
+ */
+class FGameplayDebuggerCategory_GASAttach : public FGameplayDebuggerCategory
+{
+public:
+	FGameplayDebuggerCategory_GASAttach();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+private:
+	struct FRepKeyframe
+	{
+		// Bumped by the server for every keyframe it sends
+		uint16 Version = 0;
+		TArray<uint8> Message;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	struct FRepDelta
+	{
+		// Version of the keyframe Message applies to
+		uint16 KeyframeVersion = 0;
+		TArray<uint8> Message;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	bool Publish(const FGASWorldSnapshot& Snapshot);
+	void Decode();
+
+private:
+	FRepKeyframe KeyframeData;
+	FRepDelta DeltaData;
+
+	// Server: the writer as it was right after the keyframe, copied for every delta
+	FGASSnapshotDeltaWriter KeyframeWriter;
+	FGASWorldSnapshot Collected;
+	float ByteAllowance = 0.f;
+	uint64 LastCollectFrame = 0;
+
+	// Client: the reader and state right after the last keyframe, and what the delta on top of it gives
+	FGASSnapshotDeltaReader KeyframeReader;
+	FGASWorldSnapshot KeyframeState;
+	uint16 DecodedKeyframeVersion = 0;
+	bool bKeyframeDecoded = false;
+	TArray<uint8> DecodedDelta;
+	FGASWorldSnapshot Displayed;
+	bool bDisplayedValid = false;
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
\ No newline at end of file
@@ -0,0 +1,323 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachFlightRecorder.h"
+#include "GASAttachCapture.h"
+#include "GASAttachRuntimeStats.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
+
+static TAutoConsoleVariable<bool> CVarFlightRecorderEnable(
+	TEXT("GASAttachEditor.FlightRecorder.Enable"),
+	true,
+	TEXT("Keep the last GASAttachEditor.FlightRecorder.Seconds of the game world in memory, to be written to a capture file when something goes wrong."));
+
+static TAutoConsoleVariable<int32> CVarFlightRecorderScope(
+	TEXT("GASAttachEditor.FlightRecorder.Scope"),
+	3,
+	TEXT("Which components the flight recorder keeps:\n")
+	TEXT("0: every component of the game world - costs the most, so only on demand\n")
+	TEXT("1: the components owning GASAttachEditor.FlightRecorder.Tag\n")
+	TEXT("2: the component selected in the Ability System Viewer\n")
+	TEXT("3: both of the above (default)"));
+
+static TAutoConsoleVariable<FString> CVarFlightRecorderTag(
+	TEXT("GASAttachEditor.FlightRecorder.Tag"),
+	TEXT(""),
+	TEXT("Gameplay tag a component has to own to be recorded with GASAttachEditor.FlightRecorder.Scope 1 or 3."));
+
+static TAutoConsoleVariable<float> CVarFlightRecorderSeconds(
+	TEXT("GASAttachEditor.FlightRecorder.Seconds"),
+	30.f,
+	TEXT("How many seconds back the flight recorder keeps."));
+
+static TAutoConsoleVariable<int32> CVarFlightRecorderMaxMemoryKB(
+	TEXT("GASAttachEditor.FlightRecorder.MaxMemoryKB"),
+	8 * 1024,
+	TEXT("Most memory the flight recorder holds; the oldest seconds go first once it's exceeded."));
+
+static TAutoConsoleVariable<float> CVarFlightRecorderInterval(
+	TEXT("GASAttachEditor.FlightRecorder.Interval"),
+	.1f,
+	TEXT("Seconds between two snapshots the flight recorder keeps."));
+
+static TAutoConsoleVariable<int32> CVarFlightRecorderKeyframeInterval(
+	TEXT("GASAttachEditor.FlightRecorder.KeyframeInterval"),
+	50,
+	TEXT("Every how many snapshots the flight recorder starts over with a keyframe. Memory is freed a keyframe's run at a time, so smaller keeps closer to the limits."));
+
+static TAutoConsoleVariable<int32> CVarFlightRecorderDumpOn(
+	TEXT("GASAttachEditor.FlightRecorder.DumpOn"),
+	1 | 2 | 4,
+	TEXT("When the flight recorder writes Saved/GASAttachEditor/<Reason>-<date>.gascapture, as flags:\n")
+	TEXT("1: an ensure fires (Ensure)\n")
+	TEXT("2: the process crashes (Crash)\n")
+	TEXT("4: a PIE session ends (PIE), as the editor reports it - not a map travel within the session"));
+
+static constexpr int32 FlightRecorderDumpOnEnsure = 1 << 0;
+static constexpr int32 FlightRecorderDumpOnCrash = 1 << 1;
+static constexpr int32 FlightRecorderDumpOnPIEEnd = 1 << 2;
+
+// A burst of ensures is usually one problem; one capture of it is enough
+static constexpr double MinSecondsBetweenEnsureDumps = 10.0;
+
+FGASFlightRecorder::FGASFlightRecorder()
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGASFlightRecorder::Tick));
+	EnsureHandle = FCoreDelegates::OnHandleSystemEnsure.AddRaw(this, &FGASFlightRecorder::OnEnsure);
+	SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddRaw(this, &FGASFlightRecorder::OnSystemError);
+}
+
+FGASFlightRecorder::~FGASFlightRecorder()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FCoreDelegates::OnHandleSystemEnsure.Remove(EnsureHandle);
+	FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+}
+
+void FGASFlightRecorder::SetSelectedComponent(const UAbilitySystemComponent* Component)
+{
+	SelectedComponent = Component;
+}
+
+bool FGASFlightRecorder::Tick(float DeltaTime)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_FlightRecord);
+
+	if (!CVarFlightRecorderEnable.GetValueOnGameThread())
+	{
+		if (Frames.Num() > 0)
+		{
+			FScopeLock Lock(&FramesLock);
+			Clear();
+		}
+		return true;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime < NextCaptureTime)
+	{
+		return true;
+	}
+	NextCaptureTime = CurrentTime + CVarFlightRecorderInterval.GetValueOnGameThread();
+
+	CaptureScope();
+
+	// Nothing to record between game sessions, or while nothing is in scope
+	const bool bSnapshotEmpty = Snapshot.Components.Num() == 0;
+	if (bSnapshotEmpty && bLastSnapshotEmpty)
+	{
+		return true;
+	}
+	bLastSnapshotEmpty = bSnapshotEmpty;
+
+	FScopeLock Lock(&FramesLock);
+
+	Append();
+	Evict(static_cast<int64>(CVarFlightRecorderMaxMemoryKB.GetValueOnGameThread()) * 1024, CurrentTime - CVarFlightRecorderSeconds.GetValueOnGameThread());
+
+	return true;
+}
+
+void FGASFlightRecorder::CaptureScope()
+{
+	const int32 Scope = CVarFlightRecorderScope.GetValueOnGameThread();
+	if (Scope == 0)
+	{
+		FGASWorldSnapshot::CaptureGameWorld(Snapshot);
+		return;
+	}
+
+	const FGameplayTag Tag = Scope != 2 ? FGameplayTag::RequestGameplayTag(FName(*CVarFlightRecorderTag.GetValueOnGameThread()), false) : FGameplayTag();
+	const UAbilitySystemComponent* Selected = Scope != 1 ? SelectedComponent.Get() : nullptr;
+
+	CaptureSelectedOrTagged(Selected, Tag);
+}
+
+void FGASFlightRecorder::CaptureSelectedOrTagged(const UAbilitySystemComponent* Selected, const FGameplayTag& Tag)
+{
+	// Nothing can match - not worth walking the world's components for
+	if (!Selected &&
+		!Tag.IsValid())
+	{
+		Snapshot.Components.Reset();
+		return;
+	}
+
+	const auto Filter = [Selected, &Tag](const UAbilitySystemComponent& Component)
+	{
+		return
+			&Component == Selected ||
+			(Tag.IsValid() && Component.HasMatchingGameplayTag(Tag));
+	};
+
+	if (!Selected)
+	{
+		FGASWorldSnapshot::CaptureGameWorld(Snapshot, Filter);
+		return;
+	}
+
+	// The selection may be in any world, a client's as much as the server's; tagged components are taken from the same one
+	const UWorld* World = Selected->GetWorld();
+	FGASWorldSnapshot::Capture(World, Snapshot, Filter);
+
+	const FWorldContext* WorldContext = World && GEngine ? GEngine->GetWorldContextFromWorld(World) : nullptr;
+	if (WorldContext)
+	{
+		Snapshot.Source = FString::Printf(TEXT("%s (%u)"), *FGASWorldSnapshot::GetWorldName(*WorldContext).ToString(), FPlatformProcess::GetCurrentProcessId());
+	}
+}
+
+void FGASFlightRecorder::Append()
+{
+	const int64 MaxBytes = static_cast<int64>(CVarFlightRecorderMaxMemoryKB.GetValueOnGameThread()) * 1024;
+
+	// A run that alone takes a good part of the memory would leave nothing to drop but itself
+	const bool bKeyframe =
+		Frames.Num() == 0 ||
+		NumRunFrames >= FMath::Max(CVarFlightRecorderKeyframeInterval.GetValueOnGameThread(), 1) ||
+		NumRunBytes > MaxBytes / 4;
+	if (bKeyframe)
+	{
+		Writer.Reset();
+		NumRunFrames = 0;
+		NumRunBytes = 0;
+
+		// Tags registered since turn up in the next dump
+		FGASCaptureWriter::GetTagNames(TagNames);
+	}
+
+	// Written aside first, so that an ensure going off in the writer dumps complete frames only
+	TArray<uint8> Message;
+	Writer.Write(Snapshot, Message);
+
+	FFrame& Frame = Frames.AddDefaulted_GetRef();
+	Frame.Message = MoveTemp(Message);
+	Frame.WorldTime = Snapshot.WorldTime;
+	Frame.LocalTime = FPlatformTime::Seconds();
+	Frame.bKeyframe = bKeyframe;
+
+	NumBytes += Frame.Message.Num();
+	NumRunBytes += Frame.Message.Num();
+	++NumRunFrames;
+}
+
+void FGASFlightRecorder::Evict(const int64 MaxBytes, const double MinLocalTime)
+{
+	for (;;)
+	{
+		int32 NextRun = 1;
+		while (NextRun < Frames.Num() &&
+			!Frames[NextRun].bKeyframe)
+		{
+			++NextRun;
+		}
+
+		// The run being recorded stays, whatever it costs
+		if (NextRun >= Frames.Num())
+		{
+			return;
+		}
+
+		// The oldest run goes once the next one alone covers the time window
+		if (NumBytes <= MaxBytes &&
+			Frames[NextRun].LocalTime > MinLocalTime)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < NextRun; ++Index)
+		{
+			NumBytes -= Frames[Index].Message.Num();
+		}
+		Frames.RemoveAt(0, NextRun);
+	}
+}
+
+void FGASFlightRecorder::Clear()
+{
+	Frames.Reset();
+	NumBytes = 0;
+	NumRunBytes = 0;
+	NumRunFrames = 0;
+	bLastSnapshotEmpty = true;
+}
+
+bool FGASFlightRecorder::Dump(const FString& Filename)
+{
+	FScopeLock Lock(&FramesLock);
+
+	if (Frames.Num() == 0)
+	{
+		return false;
+	}
+
+	FGASCaptureWriter CaptureWriter;
+	if (!CaptureWriter.Open(Filename, TagNames))
+	{
+		return false;
+	}
+
+	for (const FFrame& Frame : Frames)
+	{
+		CaptureWriter.AppendMessage(Frame.Message, Frame.WorldTime, Frame.bKeyframe);
+	}
+
+	return true;
+}
+
+bool FGASFlightRecorder::DumpFor(const TCHAR* Reason)
+{
+	return Dump(FGASCaptureWriter::MakeFilename(Reason));
+}
+
+void FGASFlightRecorder::OnEnsure()
+{
+	if (!(CVarFlightRecorderDumpOn.GetValueOnAnyThread() & FlightRecorderDumpOnEnsure))
+	{
+		return;
+	}
+
+	// Dump takes the lock again; it's reentrant
+	FScopeLock Lock(&FramesLock);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastEnsureDumpTime < MinSecondsBetweenEnsureDumps)
+	{
+		return;
+	}
+	LastEnsureDumpTime = CurrentTime;
+
+	DumpFor(TEXT("Ensure"));
+}
+
+void FGASFlightRecorder::OnSystemError()
+{
+	if (!(CVarFlightRecorderDumpOn.GetValueOnAnyThread() & FlightRecorderDumpOnCrash))
+	{
+		return;
+	}
+
+	// A thread stopped by the crash may hold the lock forever
+	if (!FramesLock.TryLock())
+	{
+		return;
+	}
+
+	DumpFor(TEXT("Crash"));
+	FramesLock.Unlock();
+}
+
+void FGASFlightRecorder::OnPIEEnd()
+{
+	// The next session starts over
+	if (CVarFlightRecorderDumpOn.GetValueOnGameThread() & FlightRecorderDumpOnPIEEnd)
+	{
+		DumpFor(TEXT("PIE"));
+	}
+
+	FScopeLock Lock(&FramesLock);
+	Clear();
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachRecordingProfile.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameFramework/Actor.h"
+#include "Misc/ConfigCacheIni.h"
+
+static const TCHAR* RecordingProfileSectionPrefix = TEXT("GASAttachEditor.RecordingProfile.");
+
+static EGASSnapshotChannels ParseChannel(const FString& Token)
+{
+	if (Token == TEXT("Attributes"))	return EGASSnapshotChannels::Attributes;
+	if (Token == TEXT("Effects"))		return EGASSnapshotChannels::Effects | EGASSnapshotChannels::EffectDetails;
+	if (Token == TEXT("EffectEvents"))	return EGASSnapshotChannels::Effects;
+	if (Token == TEXT("Abilities"))		return EGASSnapshotChannels::Abilities;
+	if (Token == TEXT("Tags"))			return EGASSnapshotChannels::Tags;
+	if (Token == TEXT("Full"))			return EGASSnapshotChannels::Full;
+	return EGASSnapshotChannels::None;
+}
+
+static bool FindBuiltInProfile(const FString& ProfileName, FGASRecordingProfile& OutProfile)
+{
+	static const TPair<const TCHAR*, EGASSnapshotChannels> BuiltInProfiles[] =
+	{
+		{ TEXT("Full"), EGASSnapshotChannels::Full },
+		{ TEXT("Attributes"), EGASSnapshotChannels::Attributes },
+		{ TEXT("EffectEvents"), EGASSnapshotChannels::Effects },
+		{ TEXT("Tags"), EGASSnapshotChannels::Tags },
+	};
+
+	for (const TPair<const TCHAR*, EGASSnapshotChannels>& BuiltInProfile : BuiltInProfiles)
+	{
+		if (ProfileName == BuiltInProfile.Key)
+		{
+			OutProfile = FGASRecordingProfile();
+			OutProfile.Name = BuiltInProfile.Key;
+			OutProfile.Channels = BuiltInProfile.Value;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FGASRecordingProfile::Find(const FString& ProfileName, FGASRecordingProfile& OutProfile)
+{
+	const FString Section = RecordingProfileSectionPrefix + ProfileName;
+	if (!GConfig ||
+		!GConfig->DoesSectionExist(*Section, GGameIni))
+	{
+		return FindBuiltInProfile(ProfileName, OutProfile);
+	}
+
+	OutProfile = FGASRecordingProfile();
+	OutProfile.Name = ProfileName;
+
+	FString ChannelList;
+	if (GConfig->GetString(*Section, TEXT("Channels"), ChannelList, GGameIni))
+	{
+		TArray<FString> Tokens;
+		ChannelList.ParseIntoArray(Tokens, TEXT(","));
+
+		OutProfile.Channels = EGASSnapshotChannels::None;
+		for (const FString& Token : Tokens)
+		{
+			OutProfile.Channels |= ParseChannel(Token.TrimStartAndEnd());
+		}
+	}
+
+	TArray<FString> AttributeNames;
+	GConfig->GetArray(*Section, TEXT("Attributes"), AttributeNames, GGameIni);
+	for (const FString& AttributeName : AttributeNames)
+	{
+		OutProfile.Attributes.Add(FName(*AttributeName));
+	}
+	if (OutProfile.Attributes.Num() > 0)
+	{
+		OutProfile.Channels |= EGASSnapshotChannels::AttributeFilter;
+	}
+
+	GConfig->GetFloat(*Section, TEXT("Interval"), OutProfile.Interval, GGameIni);
+	GConfig->GetString(*Section, TEXT("ActorName"), OutProfile.ActorName, GGameIni);
+
+	FString ActorClass;
+	if (GConfig->GetString(*Section, TEXT("ActorClass"), ActorClass, GGameIni))
+	{
+		OutProfile.ActorClass = FName(*ActorClass);
+	}
+
+	FString ActorTag;
+	if (GConfig->GetString(*Section, TEXT("ActorTag"), ActorTag, GGameIni))
+	{
+		OutProfile.ActorTag = FName(*ActorTag);
+	}
+
+	return true;
+}
+
+TArray<FString> FGASRecordingProfile::GetNames()
+{
+	TArray<FString> Names = { TEXT("Full"), TEXT("Attributes"), TEXT("EffectEvents"), TEXT("Tags") };
+
+	TArray<FString> Sections;
+	if (GConfig)
+	{
+		GConfig->GetSectionNames(GGameIni, Sections);
+	}
+
+	for (const FString& Section : Sections)
+	{
+		if (Section.StartsWith(RecordingProfileSectionPrefix))
+		{
+			Names.AddUnique(Section.RightChop(FCString::Strlen(RecordingProfileSectionPrefix)));
+		}
+	}
+
+	return Names;
+}
+
+FGASComponentSnapshot::FCaptureFunction FGASRecordingProfile::GetCaptureFunction() const
+{
+	return FGASComponentSnapshot::GetCaptureFunction(Channels);
+}
+
+TFunction<bool(const UAbilitySystemComponent&)> FGASRecordingProfile::MakeFilter() const
+{
+	if (ActorName.IsEmpty() &&
+		ActorClass.IsNone() &&
+		ActorTag.IsNone())
+	{
+		return [](const UAbilitySystemComponent&) { return true; };
+	}
+
+	// A tag that doesn't exist is owned by no component, and so filters out all of them
+	const bool bCheckTag = !ActorTag.IsNone();
+	const FGameplayTag Tag = bCheckTag ? FGameplayTag::RequestGameplayTag(ActorTag, false) : FGameplayTag();
+
+	// Likewise a class that isn't loaded; held weakly, as a recompiled blueprint replaces its class
+	const bool bCheckClass = !ActorClass.IsNone();
+	UClass* FoundClass = nullptr;
+	if (bCheckClass)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+		FoundClass = FindFirstObject<UClass>(*ActorClass.ToString());
+#else
+		FoundClass = FindObject<UClass>(ANY_PACKAGE, *ActorClass.ToString());
+#endif
+	}
+
+	return [Name = ActorName, bCheckClass, Class = TWeakObjectPtr<UClass>(FoundClass), bCheckTag, Tag](const UAbilitySystemComponent& Component)
+	{
+		if (bCheckTag &&
+			!(Tag.IsValid() && Component.HasMatchingGameplayTag(Tag)))
+		{
+			return false;
+		}
+
+		const AActor* Owner = Component.GetOwnerActor();
+		if (!Name.IsEmpty() &&
+			!(Owner && Owner->GetName().MatchesWildcard(Name)))
+		{
+			return false;
+		}
+
+		if (bCheckClass)
+		{
+			const UClass* ResolvedClass = Class.Get();
+			if (!ResolvedClass ||
+				!(Owner && Owner->IsA(ResolvedClass)))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+}
\ No newline at end of file
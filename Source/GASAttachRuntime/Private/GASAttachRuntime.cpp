@@ -0,0 +1,316 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachRuntime.h"
+#include "GASAttachSnapshotStream.h"
+#include "GASAttachCapture.h"
+#include "GASAttachCaptureQuery.h"
+#include "GASAttachSnapshotDiff.h"
+#include "GASAttachFlightRecorder.h"
+#include "GASAttachDebuggerCategory.h"
+
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#endif
+
+void FGASAttachRuntimeModule::StartupModule()
+{
+	FlightRecorder = MakeShared<FGASFlightRecorder>();
+
+	// Game and server processes have no viewer of their own, they stream to the editor's
+	if (!GIsEditor &&
+		FParse::Param(FCommandLine::Get(), TEXT("GASAttachStream")))
+	{
+		StartStreaming();
+	}
+
+#if WITH_GAMEPLAY_DEBUGGER
+	IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+	GameplayDebugger.RegisterCategory("GASAttach",
+		IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_GASAttach::MakeInstance),
+		EGameplayDebuggerCategoryState::EnabledInGame);
+	GameplayDebugger.NotifyCategoriesChanged();
+#endif
+}
+
+void FGASAttachRuntimeModule::ShutdownModule()
+{
+	StopStreaming();
+	StopRecording();
+	FlightRecorder.Reset();
+
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+		GameplayDebugger.UnregisterCategory("GASAttach");
+		GameplayDebugger.NotifyCategoriesChanged();
+	}
+#endif
+}
+
+bool FGASAttachRuntimeModule::StartStreaming()
+{
+	if (!StreamServer)
+	{
+		StreamServer = MakeShared<FGASSnapshotStreamServer>();
+	}
+
+	if (!StreamServer->Start())
+	{
+		StreamServer.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FGASAttachRuntimeModule::StopStreaming()
+{
+	StreamServer.Reset();
+}
+
+int32 FGASAttachRuntimeModule::GetStreamingPort() const
+{
+	return StreamServer ? StreamServer->GetPort() : 0;
+}
+
+bool FGASAttachRuntimeModule::StartRecording(const FString& Filename, const FGASRecordingProfile& Profile)
+{
+	if (!CaptureRecorder)
+	{
+		CaptureRecorder = MakeShared<FGASCaptureRecorder>();
+	}
+
+	if (!CaptureRecorder->Start(Filename, Profile))
+	{
+		CaptureRecorder.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FGASAttachRuntimeModule::StopRecording()
+{
+	CaptureRecorder.Reset();
+}
+
+bool FGASAttachRuntimeModule::IsRecording() const
+{
+	return CaptureRecorder && CaptureRecorder->IsRecording();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static void GASAttachEditorStreamServe(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	FGASAttachRuntimeModule* Module = FModuleManager::GetModulePtr<FGASAttachRuntimeModule>("GASAttachRuntime");
+	if (!Module)
+	{
+		return;
+	}
+
+	const bool bServe = Args.Num() > 0 ? FCString::ToBool(*Args[0]) : Module->GetStreamingPort() == 0;
+	if (!bServe)
+	{
+		Module->StopStreaming();
+		Ar.Logf(TEXT("Snapshot stream stopped"));
+		return;
+	}
+
+	if (!Module->StartStreaming())
+	{
+		Ar.Logf(TEXT("No free loopback port to stream snapshots on, see GASAttachEditor.Stream.Port and GASAttachEditor.Stream.PortRange"));
+		return;
+	}
+
+	Ar.Logf(TEXT("Streaming snapshots on port %d"), Module->GetStreamingPort());
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemRuntimeStreamServe(
+	TEXT("GASAttachEditor.Stream.Serve"),
+	TEXT("Start (1) or stop (0) streaming this process' game world to the Ability System Viewer of another process; toggles without an argument.\n")
+	TEXT("-GASAttachStream on the command line of a game or server starts it right away."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorStreamServe));
+
+static TAutoConsoleVariable<FString> CVarCaptureProfile(
+	TEXT("GASAttachEditor.Capture.Profile"),
+	TEXT("Full"),
+	TEXT("Recording profile GASAttachEditor.Capture.Record uses when not given one: Full, Attributes, EffectEvents, Tags, or one of the [GASAttachEditor.RecordingProfile.<Name>] sections of the game config."));
+
+static void GASAttachEditorCaptureRecord(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	FGASAttachRuntimeModule* Module = FModuleManager::GetModulePtr<FGASAttachRuntimeModule>("GASAttachRuntime");
+	if (!Module)
+	{
+		return;
+	}
+
+	const bool bRecord = Args.Num() > 0 ? FCString::ToBool(*Args[0]) : !Module->IsRecording();
+	if (!bRecord)
+	{
+		Module->StopRecording();
+		Ar.Logf(TEXT("Capture stopped"));
+		return;
+	}
+
+	const FString ProfileName = Args.Num() > 2 ? Args[2] : CVarCaptureProfile.GetValueOnGameThread();
+	FGASRecordingProfile Profile;
+	if (!FGASRecordingProfile::Find(ProfileName, Profile))
+	{
+		Ar.Logf(TEXT("No recording profile %s, the profiles are %s"), *ProfileName, *FString::Join(FGASRecordingProfile::GetNames(), TEXT(", ")));
+		return;
+	}
+
+	const FString Filename = Args.Num() > 1 ? Args[1] : FGASCaptureWriter::MakeFilename(TEXT("Capture"));
+	if (!Module->StartRecording(Filename, Profile))
+	{
+		Ar.Logf(TEXT("Can't write %s"), *Filename);
+		return;
+	}
+
+	Ar.Logf(TEXT("Capturing to %s with the %s profile"), *Filename, *Profile.Name);
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemRuntimeCaptureRecord(
+	TEXT("GASAttachEditor.Capture.Record"),
+	TEXT("Start (1) or stop (0) recording this process' game world to a capture file; toggles without an argument.\n")
+	TEXT("The second argument names the file, Saved/GASAttachEditor/Capture-<date>.gascapture otherwise, and the third the recording profile, GASAttachEditor.Capture.Profile otherwise."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorCaptureRecord));
+
+static void GASAttachEditorCaptureSnapshot(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	const FString Filename = Args.Num() > 0 ? Args[0] : FGASCaptureWriter::MakeFilename(TEXT("Snapshot"));
+	if (!FGASCaptureRecorder::SaveSnapshot(Filename))
+	{
+		Ar.Logf(TEXT("Can't write %s"), *Filename);
+		return;
+	}
+
+	Ar.Logf(TEXT("Snapshot saved to %s"), *Filename);
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemRuntimeCaptureSnapshot(
+	TEXT("GASAttachEditor.Capture.Snapshot"),
+	TEXT("Save a single snapshot of this process' game world to a capture file, Saved/GASAttachEditor/Snapshot-<date>.gascapture unless named."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorCaptureSnapshot));
+
+static void GASAttachEditorCaptureQuery(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	if (Args.Num() < 2)
+	{
+		Ar.Logf(TEXT("GASAttachEditor.Capture.Query <File> <Condition>"));
+		return;
+	}
+
+	FGASCaptureQuery Query;
+	FText Error;
+	if (!Query.Parse(FString::Join(MakeArrayView(Args).RightChop(1), TEXT(" ")), Error))
+	{
+		Ar.Logf(TEXT("%s"), *Error.ToString());
+		return;
+	}
+
+	FGASCapture Capture;
+	if (!Capture.Load(Args[0], Error))
+	{
+		Ar.Logf(TEXT("%s"), *Error.ToString());
+		return;
+	}
+
+	TArray<FGASCaptureQuery::FMatch> Matches;
+	if (Capture.GetTagIndex() &&
+		Query.UsesOnlyTags())
+	{
+		Query.Run(*Capture.GetTagIndex(), Matches);
+	}
+	else
+	{
+		FGASCaptureColumns Columns;
+		if (!Columns.Build(Capture))
+		{
+			Ar.Logf(TEXT("%s is damaged after frame %d, querying the frames before"), *Args[0], Columns.GetNumFrames());
+		}
+
+		Query.Run(Columns, Matches);
+	}
+
+	for (const FGASCaptureQuery::FMatch& Match : Matches)
+	{
+		Ar.Logf(TEXT("%s  frames %d - %d  %.2f - %.2f s"),
+			*Match.OwnerName.ToString(), Match.FirstFrame + 1, Match.LastFrame + 1, Capture.GetWorldTime(Match.FirstFrame), Capture.GetWorldTime(Match.LastFrame));
+	}
+	Ar.Logf(TEXT("%d matches"), Matches.Num());
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemRuntimeCaptureQuery(
+	TEXT("GASAttachEditor.Capture.Query"),
+	TEXT("List the runs of frames of a capture in which a component matches a condition, e.g. GASAttachEditor.Capture.Query Capture.gascapture Health < 10 and State.Stunned"),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorCaptureQuery));
+
+static void GASAttachEditorCaptureDiff(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	if (Args.Num() < 2)
+	{
+		Ar.Logf(TEXT("GASAttachEditor.Capture.Diff <Before>[@Frame] <After>[@Frame] [Report]"));
+		return;
+	}
+
+	FGASWorldSnapshot Before;
+	FGASWorldSnapshot After;
+	FText Error;
+	if (!FGASSnapshotDiff::LoadCapturePoint(Args[0], Before, Error) ||
+		!FGASSnapshotDiff::LoadCapturePoint(Args[1], After, Error))
+	{
+		Ar.Logf(TEXT("%s"), *Error.ToString());
+		return;
+	}
+
+	FGASSnapshotDiff Diff;
+	FGASSnapshotDiff::Compare(Before, After, Diff);
+
+	const FString Report = Diff.MakeReport(Args[0], Args[1]);
+	Ar.Logf(TEXT("%s"), *Report);
+
+	if (Args.Num() > 2 &&
+		!FFileHelper::SaveStringToFile(Report, *Args[2]))
+	{
+		Ar.Logf(TEXT("Can't write %s"), *Args[2]);
+	}
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemRuntimeCaptureDiff(
+	TEXT("GASAttachEditor.Capture.Diff"),
+	TEXT("Compare the abilities, attributes, effects and tags of two captures, or two frames of one, e.g. GASAttachEditor.Capture.Diff Before.gascapture After.gascapture@120, and optionally write the report to a file. Frames count from 1; the last one if not given."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorCaptureDiff));
+
+static void GASAttachEditorFlightRecorderDump(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	FGASAttachRuntimeModule* Module = FModuleManager::GetModulePtr<FGASAttachRuntimeModule>("GASAttachRuntime");
+	FGASFlightRecorder* FlightRecorder = Module ? Module->GetFlightRecorder() : nullptr;
+	if (!FlightRecorder)
+	{
+		return;
+	}
+
+	const FString Filename = Args.Num() > 0 ? Args[0] : FGASCaptureWriter::MakeFilename(TEXT("FlightRecorder"));
+	if (!FlightRecorder->Dump(Filename))
+	{
+		Ar.Logf(TEXT("Nothing recorded, or can't write %s"), *Filename);
+		return;
+	}
+
+	Ar.Logf(TEXT("%d frames (%lld KB) of the flight recorder saved to %s"), FlightRecorder->GetNumFrames(), FlightRecorder->GetNumBytes() / 1024, *Filename);
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice AbilitySystemRuntimeFlightRecorderDump(
+	TEXT("GASAttachEditor.FlightRecorder.Dump"),
+	TEXT("Save what the flight recorder holds to a capture file, Saved/GASAttachEditor/FlightRecorder-<date>.gascapture unless named."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(GASAttachEditorFlightRecorderDump));
+
+IMPLEMENT_MODULE(FGASAttachRuntimeModule, GASAttachRuntime)
\ No newline at end of file
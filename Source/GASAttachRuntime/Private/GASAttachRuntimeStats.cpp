@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachRuntimeStats.h"
+
+DEFINE_STAT(STAT_GASAttachEditor_SnapshotCapture);
+DEFINE_STAT(STAT_GASAttachEditor_SnapshotDelta);
+DEFINE_STAT(STAT_GASAttachEditor_SnapshotStream);
+DEFINE_STAT(STAT_GASAttachEditor_CaptureRecord);
+DEFINE_STAT(STAT_GASAttachEditor_CaptureSeek);
+DEFINE_STAT(STAT_GASAttachEditor_CaptureQuery);
+DEFINE_STAT(STAT_GASAttachEditor_SnapshotDiff);
+DEFINE_STAT(STAT_GASAttachEditor_FlightRecord);
+DEFINE_STAT(STAT_GASAttachEditor_DebuggerCollect);
+
+UE_TRACE_CHANNEL_DEFINE(GASAttachEditorChannel);
\ No newline at end of file
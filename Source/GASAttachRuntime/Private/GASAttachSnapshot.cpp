@@ -0,0 +1,442 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachSnapshot.h"
+#include "GASAttachRuntimeStats.h"
+
+#include "AttributeSet.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectIterator.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+// Building an FName out of a path string is a hash lookup; the same few classes come up all the time
+static FName GetClassPathName(const UClass* Class)
+{
+	if (!Class)
+	{
+		return NAME_None;
+	}
+
+	static TMap<TObjectKey<UClass>, FName> PathNames;
+
+	FName& PathName = PathNames.FindOrAdd(Class);
+	if (PathName.IsNone())
+	{
+		PathName = FName(*Class->GetPathName());
+	}
+
+	return PathName;
+}
+
+template<bool bFilter>
+static void CaptureAttributes(const UAbilitySystemComponent& Component, const TSet<FName>& AttributeFilter, FGASComponentSnapshot& OutSnapshot)
+{
+	OutSnapshot.Attributes.Reset();
+	for (const UAttributeSet* Set : Component.GetSpawnedAttributes())
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		const FName SetPath = GetClassPathName(Set->GetClass());
+		for (const FStructProperty* Property : TFieldRange<FStructProperty>(Set->GetClass()))
+		{
+			if (!Property->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				continue;
+			}
+
+			if constexpr (bFilter)
+			{
+				if (!AttributeFilter.Contains(Property->GetFName()))
+				{
+					continue;
+				}
+			}
+
+			const FGameplayAttributeData* Data = Property->ContainerPtrToValuePtr<FGameplayAttributeData>(Set);
+
+			FGASAttributeSnapshot& Attribute = OutSnapshot.Attributes.AddDefaulted_GetRef();
+			Attribute.Set = SetPath;
+			Attribute.Name = Property->GetFName();
+			Attribute.BaseValue = Data->GetBaseValue();
+			Attribute.CurrentValue = Data->GetCurrentValue();
+		}
+	}
+}
+
+// Without the details, an effect is only its handle and class, which change when it's applied or removed
+template<bool bDetails>
+static void CaptureEffects(const UAbilitySystemComponent& Component, FGASComponentSnapshot& OutSnapshot)
+{
+	OutSnapshot.Effects.Reset();
+	for (auto It = Component.GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+	{
+		const FActiveGameplayEffect& ActiveGameplayEffect = *It;
+		const FGameplayEffectSpec& Spec = ActiveGameplayEffect.Spec;
+
+		FGASEffectSnapshot& Effect = OutSnapshot.Effects.AddDefaulted_GetRef();
+		Effect.Handle = GetTypeHash(ActiveGameplayEffect.Handle);
+		Effect.Def = Spec.Def ? GetClassPathName(Spec.Def->GetClass()) : NAME_None;
+
+		if constexpr (bDetails)
+		{
+			Effect.Level = Spec.GetLevel();
+			Effect.StackCount = Spec.GetStackCount();
+			Effect.Duration = ActiveGameplayEffect.GetDuration();
+			Effect.Period = ActiveGameplayEffect.GetPeriod();
+			Effect.StartWorldTime = ActiveGameplayEffect.StartWorldTime;
+			Effect.bInhibited = ActiveGameplayEffect.bIsInhibited;
+			Effect.bPredicted = ActiveGameplayEffect.PredictionKey.IsValidKey();
+			Effect.bPredictedLocally = ActiveGameplayEffect.PredictionKey.WasLocallyGenerated();
+
+			Effect.Modifiers.SetNumUninitialized(Spec.Modifiers.Num());
+			for (int32 ModifierIndex = 0; ModifierIndex < Spec.Modifiers.Num(); ++ModifierIndex)
+			{
+				Effect.Modifiers[ModifierIndex] = Spec.Modifiers[ModifierIndex].GetEvaluatedMagnitude();
+			}
+		}
+	}
+}
+
+static void CaptureAbilities(const UAbilitySystemComponent& Component, FGASComponentSnapshot& OutSnapshot)
+{
+	const UWorld* World = Component.GetWorld();
+	const float WorldTime = World ? World->GetTimeSeconds() : 0.f;
+
+	OutSnapshot.Abilities.Reset();
+	for (const FGameplayAbilitySpec& Spec : Component.GetActivatableAbilities())
+	{
+		if (!Spec.Ability)
+		{
+			continue;
+		}
+
+		FGASAbilitySnapshot& Ability = OutSnapshot.Abilities.AddDefaulted_GetRef();
+		Ability.Handle = GetTypeHash(Spec.Handle);
+		Ability.Ability = GetClassPathName(Spec.Ability->GetClass());
+		Ability.Level = Spec.Level;
+		Ability.ActiveCount = Spec.ActiveCount;
+
+		// Same order as the Abilities tab, minus CanActivateAbility which is too costly to run on every capture
+		if (Spec.IsActive())
+		{
+			Ability.State = EGASAbilitySnapshotState::Active;
+			continue;
+		}
+
+		if (Component.IsAbilityInputBlocked(Spec.InputID))
+		{
+			Ability.State = EGASAbilitySnapshotState::InputBlocked;
+			continue;
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+		if (Component.AreAbilityTagsBlocked(Spec.Ability->GetAssetTags()))
+#else
+		if (Component.AreAbilityTagsBlocked(Spec.Ability->AbilityTags))
+#endif
+		{
+			Ability.State = EGASAbilitySnapshotState::TagBlocked;
+			continue;
+		}
+
+		float TimeRemaining = 0.f;
+		float CooldownDuration = 0.f;
+		Spec.Ability->GetCooldownTimeRemainingAndDuration(Spec.Handle, Component.AbilityActorInfo.Get(), TimeRemaining, CooldownDuration);
+		if (TimeRemaining > 0.f)
+		{
+			Ability.State = EGASAbilitySnapshotState::Cooldown;
+			Ability.CooldownStartWorldTime = WorldTime - (CooldownDuration - TimeRemaining);
+			Ability.CooldownDuration = CooldownDuration;
+		}
+	}
+}
+
+static void CaptureTags(const UAbilitySystemComponent& Component, FGASComponentSnapshot& OutSnapshot)
+{
+	FGameplayTagContainer Tags;
+	Component.GetOwnedGameplayTags(Tags);
+
+	OutSnapshot.OwnedTags.Reset(Tags.Num());
+	for (const FGameplayTag& Tag : Tags)
+	{
+		OutSnapshot.OwnedTags.Add({ Tag.GetTagName(), Component.GetTagCount(Tag) });
+	}
+
+	Tags.Reset();
+	Component.GetBlockedAbilityTags(Tags);
+
+	OutSnapshot.BlockedTags.Reset(Tags.Num());
+	for (const FGameplayTag& Tag : Tags)
+	{
+		OutSnapshot.BlockedTags.Add(Tag.GetTagName());
+	}
+}
+
+template<EGASSnapshotChannels Channels>
+static void CaptureChannels(const UAbilitySystemComponent& Component, const TSet<FName>& AttributeFilter, FGASComponentSnapshot& OutSnapshot)
+{
+	const AActor* Owner = Component.GetOwnerActor();
+
+	// The object's index is handed to the next object once it's collected, its serial number never is
+	OutSnapshot.Id = static_cast<uint32>(GUObjectArray.AllocateSerialNumber(GUObjectArray.ObjectToIndex(&Component)));
+	OutSnapshot.OwnerName = Owner ? Owner->GetFName() : NAME_None;
+	OutSnapshot.OwnerClass = Owner ? Owner->GetClass()->GetFName() : NAME_None;
+
+	// A channel left out only empties its array, which is free once it's empty
+	if constexpr (EnumHasAnyFlags(Channels, EGASSnapshotChannels::Attributes))
+	{
+		CaptureAttributes<EnumHasAnyFlags(Channels, EGASSnapshotChannels::AttributeFilter)>(Component, AttributeFilter, OutSnapshot);
+	}
+	else
+	{
+		OutSnapshot.Attributes.Reset();
+	}
+
+	if constexpr (EnumHasAnyFlags(Channels, EGASSnapshotChannels::Effects))
+	{
+		CaptureEffects<EnumHasAnyFlags(Channels, EGASSnapshotChannels::EffectDetails)>(Component, OutSnapshot);
+	}
+	else
+	{
+		OutSnapshot.Effects.Reset();
+	}
+
+	if constexpr (EnumHasAnyFlags(Channels, EGASSnapshotChannels::Abilities))
+	{
+		CaptureAbilities(Component, OutSnapshot);
+	}
+	else
+	{
+		OutSnapshot.Abilities.Reset();
+	}
+
+	if constexpr (EnumHasAnyFlags(Channels, EGASSnapshotChannels::Tags))
+	{
+		CaptureTags(Component, OutSnapshot);
+	}
+	else
+	{
+		OutSnapshot.OwnedTags.Reset();
+		OutSnapshot.BlockedTags.Reset();
+	}
+}
+
+// One instantiation of CaptureChannels per combination of channels
+template<typename Sequence>
+struct TGASCaptureFunctionTable;
+
+template<uint32... Indices>
+struct TGASCaptureFunctionTable<TIntegerSequence<uint32, Indices...>>
+{
+	static constexpr FGASComponentSnapshot::FCaptureFunction Functions[] = { &CaptureChannels<static_cast<EGASSnapshotChannels>(Indices)>... };
+};
+
+FGASComponentSnapshot::FCaptureFunction FGASComponentSnapshot::GetCaptureFunction(const EGASSnapshotChannels Channels)
+{
+	// Picked once per recording, so that its captures have no branch for the channels it left out
+	using FTable = TGASCaptureFunctionTable<TMakeIntegerSequence<uint32, static_cast<uint32>(EGASSnapshotChannels::All) + 1>>;
+	return FTable::Functions[static_cast<uint32>(Channels & EGASSnapshotChannels::All)];
+}
+
+void FGASComponentSnapshot::Capture(const UAbilitySystemComponent& Component, FGASComponentSnapshot& OutSnapshot)
+{
+	static const TSet<FName> NoFilter;
+	CaptureChannels<EGASSnapshotChannels::Full>(Component, NoFilter, OutSnapshot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FGASWorldSnapshot::Capture(const UWorld* World, FGASWorldSnapshot& OutSnapshot)
+{
+	Capture(World, OutSnapshot, [](const UAbilitySystemComponent&) { return true; });
+}
+
+void FGASWorldSnapshot::Capture(const UWorld* World, FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter)
+{
+	Capture(World, OutSnapshot, Filter, &FGASComponentSnapshot::Capture);
+}
+
+void FGASWorldSnapshot::Capture(const UWorld* World, FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter, TFunctionRef<void(const UAbilitySystemComponent&, FGASComponentSnapshot&)> CaptureComponent)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_SnapshotCapture);
+
+	OutSnapshot.Frame = GFrameCounter;
+	OutSnapshot.LocalTime = FPlatformTime::Seconds();
+
+	int32 NumComponents = 0;
+	if (World)
+	{
+		const AWorldSettings* WorldSettings = World->GetWorldSettings();
+
+		OutSnapshot.WorldTime = World->GetTimeSeconds();
+		OutSnapshot.TimeDilation = World->IsPaused() || !WorldSettings
+			? 0.f
+			: WorldSettings->GetEffectiveTimeDilation();
+
+		for (const UAbilitySystemComponent* Component : TObjectRange<UAbilitySystemComponent>())
+		{
+			if (!Component ||
+				Component->GetWorld() != World ||
+				!Filter(*Component))
+			{
+				continue;
+			}
+
+			// Grown one at a time so that the components' arrays of the last capture are reused
+			if (NumComponents == OutSnapshot.Components.Num())
+			{
+				OutSnapshot.Components.AddDefaulted();
+			}
+
+			CaptureComponent(*Component, OutSnapshot.Components[NumComponents++]);
+		}
+	}
+
+	OutSnapshot.Components.SetNum(NumComponents);
+	OutSnapshot.RebuildIndex();
+}
+
+static const FWorldContext* FindGameWorldContext()
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		if ((WorldContext.WorldType == EWorldType::Game || WorldContext.WorldType == EWorldType::PIE) &&
+			WorldContext.World())
+		{
+			return &WorldContext;
+		}
+	}
+
+	return nullptr;
+}
+
+void FGASWorldSnapshot::CaptureGameWorld(FGASWorldSnapshot& OutSnapshot)
+{
+	CaptureGameWorld(OutSnapshot, [](const UAbilitySystemComponent&) { return true; });
+}
+
+void FGASWorldSnapshot::CaptureGameWorld(FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter)
+{
+	CaptureGameWorld(OutSnapshot, Filter, &FGASComponentSnapshot::Capture);
+}
+
+void FGASWorldSnapshot::CaptureGameWorld(FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter, TFunctionRef<void(const UAbilitySystemComponent&, FGASComponentSnapshot&)> CaptureComponent)
+{
+	const FWorldContext* WorldContext = FindGameWorldContext();
+
+	Capture(WorldContext ? WorldContext->World() : nullptr, OutSnapshot, Filter, CaptureComponent);
+
+	if (OutSnapshot.Source.IsEmpty() &&
+		WorldContext)
+	{
+		OutSnapshot.Source = FString::Printf(TEXT("%s (%u)"), *GetWorldName(*WorldContext).ToString(), FPlatformProcess::GetCurrentProcessId());
+	}
+}
+
+FText FGASWorldSnapshot::GetWorldName(const FWorldContext& WorldContext)
+{
+	const UWorld* World = WorldContext.World();
+	if (!World)
+	{
+		return LOCTEXT("None", "None");
+	}
+
+	switch (World->GetNetMode())
+	{
+	case NM_Standalone: return FText::Format(LOCTEXT("StandaloneFormat", "{0} [{1}]"), LOCTEXT("Standalone", "Standalone"), FText::AsNumber(WorldContext.PIEInstance));
+	case NM_DedicatedServer: return LOCTEXT("DedicatedServer", "Dedicated Server");
+	case NM_ListenServer: return LOCTEXT("ListenServer", "Listen Server");
+	case NM_Client: return FText::Format(LOCTEXT("ClientFormat", "{0} [{1}]"), LOCTEXT("Client", "Client"), FText::AsNumber(WorldContext.PIEInstance));
+	default: return LOCTEXT("None", "None");
+	}
+}
+
+const FGASComponentSnapshot* FGASWorldSnapshot::FindComponent(const uint32 Id) const
+{
+	const int32* Index = ComponentIndices.Find(Id);
+	return Index ? &Components[*Index] : nullptr;
+}
+
+FGASComponentSnapshot* FGASWorldSnapshot::FindComponent(const uint32 Id)
+{
+	const int32* Index = ComponentIndices.Find(Id);
+	return Index ? &Components[*Index] : nullptr;
+}
+
+void FGASWorldSnapshot::RebuildIndex()
+{
+	ComponentIndices.Reset();
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		ComponentIndices.Add(Components[Index].Id, Index);
+	}
+}
+
+UClass* FGASWorldSnapshot::ResolveClass(const FName ClassPath)
+{
+	if (ClassPath.IsNone())
+	{
+		return nullptr;
+	}
+
+	// Misses are kept too, a class this process doesn't have is not going to show up on the next refresh
+	static TMap<FName, TWeakObjectPtr<UClass>> ResolvedClasses;
+
+	if (const TWeakObjectPtr<UClass>* ResolvedClass = ResolvedClasses.Find(ClassPath))
+	{
+		if (UClass* Class = ResolvedClass->Get())
+		{
+			return Class;
+		}
+
+		if (ResolvedClass->IsExplicitlyNull())
+		{
+			return nullptr;
+		}
+	}
+
+	const FSoftClassPath SoftClassPath(ClassPath.ToString());
+
+	UClass* Class = SoftClassPath.ResolveClass();
+#if WITH_EDITOR
+	if (!Class)
+	{
+		Class = SoftClassPath.TryLoadClass<UObject>();
+	}
+#endif
+
+	ResolvedClasses.Add(ClassPath, Class);
+	return Class;
+}
+
+FString FGASWorldSnapshot::GetCleanName(const FName ClassPath)
+{
+	FString Name = ClassPath.ToString();
+
+	int32 NameStart = INDEX_NONE;
+	if (Name.FindLastChar(TEXT('.'), NameStart))
+	{
+		Name.RightChopInline(NameStart + 1);
+	}
+
+	return UAbilitySystemComponent::CleanupName(MoveTemp(Name));
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
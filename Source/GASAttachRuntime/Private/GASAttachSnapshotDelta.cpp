@@ -0,0 +1,579 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachSnapshotDelta.h"
+#include "GASAttachRuntimeStats.h"
+
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static constexpr uint32 DeltaMagic = 0x44534147; // "GASD"
+static constexpr uint8 DeltaVersion = 1;
+
+enum class EGASDeltaFlags : uint8
+{
+	None		= 0,
+	Keyframe	= 1 << 0,
+};
+ENUM_CLASS_FLAGS(EGASDeltaFlags);
+
+/** Which parts of a component a message carries */
+enum class EGASDeltaSections : uint8
+{
+	None			= 0,
+	Owner			= 1 << 0,
+	Attributes		= 1 << 1,
+	// Values only, by index into the attributes the reader already has
+	AttributeValues	= 1 << 2,
+	Effects			= 1 << 3,
+	Abilities		= 1 << 4,
+	OwnedTags		= 1 << 5,
+	BlockedTags		= 1 << 6,
+	All				= Owner | Attributes | Effects | Abilities | OwnedTags | BlockedTags,
+};
+ENUM_CLASS_FLAGS(EGASDeltaSections);
+
+enum class EGASDeltaEffectFlags : uint8
+{
+	None		= 0,
+	Inhibited	= 1 << 0,
+	Predicted	= 1 << 1,
+	PredictedLocally = 1 << 2,
+};
+ENUM_CLASS_FLAGS(EGASDeltaEffectFlags);
+
+static bool HasSameAttributeLayout(const TArray<FGASAttributeSnapshot>& A, const TArray<FGASAttributeSnapshot>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		if (A[Index].Set != B[Index].Set ||
+			A[Index].Name != B[Index].Name)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+struct FGASSnapshotDeltaWriterContext
+{
+	FGASSnapshotDeltaWriter& Writer;
+	FArchive& Ar;
+
+	void WriteInt(const uint32 Value)
+	{
+		uint32 Packed = Value;
+		Ar.SerializeIntPacked(Packed);
+	}
+
+	void WriteName(const FName Name)
+	{
+		WriteInt(Writer.GetNameId(Name));
+	}
+
+	template<typename ValueType>
+	void Write(ValueType Value)
+	{
+		Ar << Value;
+	}
+
+	void WriteComponent(const FGASComponentSnapshot& Component, EGASDeltaSections Sections, const FGASComponentSnapshot* Previous)
+	{
+		WriteInt(Component.Id);
+		Write(static_cast<uint8>(Sections));
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Owner))
+		{
+			WriteName(Component.OwnerName);
+			WriteName(Component.OwnerClass);
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Attributes))
+		{
+			WriteInt(Component.Attributes.Num());
+			for (const FGASAttributeSnapshot& Attribute : Component.Attributes)
+			{
+				WriteName(Attribute.Set);
+				WriteName(Attribute.Name);
+				Write(Attribute.BaseValue);
+				Write(Attribute.CurrentValue);
+			}
+		}
+		else if (EnumHasAnyFlags(Sections, EGASDeltaSections::AttributeValues))
+		{
+			check(Previous);
+
+			int32 NumChanged = 0;
+			for (int32 Index = 0; Index < Component.Attributes.Num(); ++Index)
+			{
+				NumChanged += Component.Attributes[Index] != Previous->Attributes[Index] ? 1 : 0;
+			}
+
+			WriteInt(NumChanged);
+			for (int32 Index = 0; Index < Component.Attributes.Num(); ++Index)
+			{
+				const FGASAttributeSnapshot& Attribute = Component.Attributes[Index];
+				if (Attribute != Previous->Attributes[Index])
+				{
+					WriteInt(Index);
+					Write(Attribute.BaseValue);
+					Write(Attribute.CurrentValue);
+				}
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Effects))
+		{
+			WriteInt(Component.Effects.Num());
+			for (const FGASEffectSnapshot& Effect : Component.Effects)
+			{
+				EGASDeltaEffectFlags Flags = EGASDeltaEffectFlags::None;
+				Flags |= Effect.bInhibited ? EGASDeltaEffectFlags::Inhibited : EGASDeltaEffectFlags::None;
+				Flags |= Effect.bPredicted ? EGASDeltaEffectFlags::Predicted : EGASDeltaEffectFlags::None;
+				Flags |= Effect.bPredictedLocally ? EGASDeltaEffectFlags::PredictedLocally : EGASDeltaEffectFlags::None;
+
+				WriteInt(Effect.Handle);
+				WriteName(Effect.Def);
+				Write(Effect.Level);
+				WriteInt(FMath::Max(Effect.StackCount, 0));
+				Write(Effect.Duration);
+				Write(Effect.Period);
+				Write(Effect.StartWorldTime);
+				Write(static_cast<uint8>(Flags));
+
+				WriteInt(Effect.Modifiers.Num());
+				for (const float Magnitude : Effect.Modifiers)
+				{
+					Write(Magnitude);
+				}
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Abilities))
+		{
+			WriteInt(Component.Abilities.Num());
+			for (const FGASAbilitySnapshot& Ability : Component.Abilities)
+			{
+				WriteInt(Ability.Handle);
+				WriteName(Ability.Ability);
+				WriteInt(FMath::Max(Ability.Level, 0));
+				Write(Ability.ActiveCount);
+				Write(static_cast<uint8>(Ability.State));
+
+				if (Ability.State == EGASAbilitySnapshotState::Cooldown)
+				{
+					Write(Ability.CooldownStartWorldTime);
+					Write(Ability.CooldownDuration);
+				}
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::OwnedTags))
+		{
+			WriteInt(Component.OwnedTags.Num());
+			for (const FGASTagSnapshot& Tag : Component.OwnedTags)
+			{
+				WriteName(Tag.Tag);
+				WriteInt(FMath::Max(Tag.Count, 0));
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::BlockedTags))
+		{
+			WriteInt(Component.BlockedTags.Num());
+			for (const FName Tag : Component.BlockedTags)
+			{
+				WriteName(Tag);
+			}
+		}
+	}
+};
+
+void FGASSnapshotDeltaWriter::Write(const FGASWorldSnapshot& Snapshot, TArray<uint8>& OutMessage)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_SnapshotDelta);
+
+	const bool bKeyframe = !bHasBaseline;
+	NewNames.Reset();
+
+	// Components first - the names they introduce go into the header, ahead of any use
+	TArray<uint8> Body;
+	FMemoryWriter BodyAr(Body);
+	FGASSnapshotDeltaWriterContext Context { *this, BodyAr };
+
+	TArray<uint32> Removed;
+	if (!bKeyframe)
+	{
+		for (const FGASComponentSnapshot& Previous : Baseline.Components)
+		{
+			if (!Snapshot.FindComponent(Previous.Id))
+			{
+				Removed.Add(Previous.Id);
+			}
+		}
+	}
+
+	TArray<TPair<const FGASComponentSnapshot*, EGASDeltaSections>> Changed;
+	for (const FGASComponentSnapshot& Component : Snapshot.Components)
+	{
+		const FGASComponentSnapshot* Previous = bKeyframe ? nullptr : Baseline.FindComponent(Component.Id);
+		if (!Previous)
+		{
+			Changed.Emplace(&Component, EGASDeltaSections::All);
+			continue;
+		}
+
+		EGASDeltaSections Sections = EGASDeltaSections::None;
+		if (Component.OwnerName != Previous->OwnerName ||
+			Component.OwnerClass != Previous->OwnerClass)
+		{
+			Sections |= EGASDeltaSections::Owner;
+		}
+
+		if (!HasSameAttributeLayout(Component.Attributes, Previous->Attributes))
+		{
+			Sections |= EGASDeltaSections::Attributes;
+		}
+		else if (Component.Attributes != Previous->Attributes)
+		{
+			Sections |= EGASDeltaSections::AttributeValues;
+		}
+
+		Sections |= Component.Effects != Previous->Effects ? EGASDeltaSections::Effects : EGASDeltaSections::None;
+		Sections |= Component.Abilities != Previous->Abilities ? EGASDeltaSections::Abilities : EGASDeltaSections::None;
+		Sections |= Component.OwnedTags != Previous->OwnedTags ? EGASDeltaSections::OwnedTags : EGASDeltaSections::None;
+		Sections |= Component.BlockedTags != Previous->BlockedTags ? EGASDeltaSections::BlockedTags : EGASDeltaSections::None;
+
+		if (Sections != EGASDeltaSections::None)
+		{
+			Changed.Emplace(&Component, Sections);
+		}
+	}
+
+	Context.WriteInt(Removed.Num());
+	for (const uint32 Id : Removed)
+	{
+		Context.WriteInt(Id);
+	}
+
+	Context.WriteInt(Changed.Num());
+	for (const TPair<const FGASComponentSnapshot*, EGASDeltaSections>& It : Changed)
+	{
+		Context.WriteComponent(*It.Key, It.Value, bKeyframe ? nullptr : Baseline.FindComponent(It.Key->Id));
+	}
+
+	OutMessage.Reset();
+	FMemoryWriter Ar(OutMessage);
+
+	uint32 Magic = DeltaMagic;
+	uint8 Version = DeltaVersion;
+	uint8 Flags = static_cast<uint8>(bKeyframe ? EGASDeltaFlags::Keyframe : EGASDeltaFlags::None);
+	uint64 Frame = Snapshot.Frame;
+	double WorldTime = Snapshot.WorldTime;
+	float TimeDilation = Snapshot.TimeDilation;
+
+	Ar << Magic;
+	Ar << Version;
+	Ar << Flags;
+	Ar << Frame;
+	Ar << WorldTime;
+	Ar << TimeDilation;
+
+	if (bKeyframe)
+	{
+		FString Source = Snapshot.Source;
+		Ar << Source;
+	}
+
+	uint32 NumNewNames = NewNames.Num();
+	Ar.SerializeIntPacked(NumNewNames);
+	for (const FName Name : NewNames)
+	{
+		FString NameString = Name.ToString();
+		Ar << NameString;
+	}
+
+	OutMessage.Append(Body);
+
+	Baseline = Snapshot;
+	bHasBaseline = true;
+}
+
+void FGASSnapshotDeltaWriter::Reset()
+{
+	Baseline = FGASWorldSnapshot();
+	bHasBaseline = false;
+	NameIds.Reset();
+	NewNames.Reset();
+}
+
+uint32 FGASSnapshotDeltaWriter::GetNameId(const FName Name)
+{
+	if (const uint32* Id = NameIds.Find(Name))
+	{
+		return *Id;
+	}
+
+	const uint32 Id = NameIds.Num();
+	NameIds.Add(Name, Id);
+	NewNames.Add(Name);
+	return Id;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+struct FGASSnapshotDeltaReaderContext
+{
+	FGASSnapshotDeltaReader& Reader;
+	FArchive& Ar;
+
+	uint32 ReadInt()
+	{
+		uint32 Value = 0;
+		Ar.SerializeIntPacked(Value);
+		return Value;
+	}
+
+	/** A count of items of at least one byte each; anything the rest of the message can't hold is an error */
+	int32 ReadCount()
+	{
+		const uint32 Count = ReadInt();
+		if (Count > static_cast<uint64>(FMath::Max<int64>(Ar.TotalSize() - Ar.Tell(), 0)))
+		{
+			Ar.SetError();
+			return 0;
+		}
+
+		return static_cast<int32>(Count);
+	}
+
+	FName ReadName()
+	{
+		const uint32 Id = ReadInt();
+		if (!Reader.Names.IsValidIndex(Id))
+		{
+			Ar.SetError();
+			return NAME_None;
+		}
+
+		return Reader.Names[Id];
+	}
+
+	template<typename ValueType>
+	ValueType Read()
+	{
+		ValueType Value {};
+		Ar << Value;
+		return Value;
+	}
+
+	void ReadComponent(FGASComponentSnapshot& Component, const EGASDeltaSections Sections)
+	{
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Owner))
+		{
+			Component.OwnerName = ReadName();
+			Component.OwnerClass = ReadName();
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Attributes))
+		{
+			Component.Attributes.SetNum(ReadCount());
+			for (FGASAttributeSnapshot& Attribute : Component.Attributes)
+			{
+				Attribute.Set = ReadName();
+				Attribute.Name = ReadName();
+				Attribute.BaseValue = Read<float>();
+				Attribute.CurrentValue = Read<float>();
+			}
+		}
+		else if (EnumHasAnyFlags(Sections, EGASDeltaSections::AttributeValues))
+		{
+			const int32 NumChanged = ReadCount();
+			for (int32 Changed = 0; Changed < NumChanged && !Ar.IsError(); ++Changed)
+			{
+				const uint32 Index = ReadInt();
+				const float BaseValue = Read<float>();
+				const float CurrentValue = Read<float>();
+
+				if (!Component.Attributes.IsValidIndex(Index))
+				{
+					Ar.SetError();
+					break;
+				}
+
+				Component.Attributes[Index].BaseValue = BaseValue;
+				Component.Attributes[Index].CurrentValue = CurrentValue;
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Effects))
+		{
+			Component.Effects.SetNum(ReadCount());
+			for (FGASEffectSnapshot& Effect : Component.Effects)
+			{
+				Effect.Handle = ReadInt();
+				Effect.Def = ReadName();
+				Effect.Level = Read<float>();
+				Effect.StackCount = ReadInt();
+				Effect.Duration = Read<float>();
+				Effect.Period = Read<float>();
+				Effect.StartWorldTime = Read<float>();
+
+				const EGASDeltaEffectFlags Flags = static_cast<EGASDeltaEffectFlags>(Read<uint8>());
+				Effect.bInhibited = EnumHasAnyFlags(Flags, EGASDeltaEffectFlags::Inhibited);
+				Effect.bPredicted = EnumHasAnyFlags(Flags, EGASDeltaEffectFlags::Predicted);
+				Effect.bPredictedLocally = EnumHasAnyFlags(Flags, EGASDeltaEffectFlags::PredictedLocally);
+
+				Effect.Modifiers.SetNum(ReadCount());
+				for (float& Magnitude : Effect.Modifiers)
+				{
+					Magnitude = Read<float>();
+				}
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::Abilities))
+		{
+			Component.Abilities.SetNum(ReadCount());
+			for (FGASAbilitySnapshot& Ability : Component.Abilities)
+			{
+				Ability.Handle = ReadInt();
+				Ability.Ability = ReadName();
+				Ability.Level = ReadInt();
+				Ability.ActiveCount = Read<uint8>();
+				Ability.State = static_cast<EGASAbilitySnapshotState>(Read<uint8>());
+				Ability.CooldownStartWorldTime = 0.f;
+				Ability.CooldownDuration = 0.f;
+
+				if (Ability.State == EGASAbilitySnapshotState::Cooldown)
+				{
+					Ability.CooldownStartWorldTime = Read<float>();
+					Ability.CooldownDuration = Read<float>();
+				}
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::OwnedTags))
+		{
+			Component.OwnedTags.SetNum(ReadCount());
+			for (FGASTagSnapshot& Tag : Component.OwnedTags)
+			{
+				Tag.Tag = ReadName();
+				Tag.Count = ReadInt();
+			}
+		}
+
+		if (EnumHasAnyFlags(Sections, EGASDeltaSections::BlockedTags))
+		{
+			Component.BlockedTags.SetNum(ReadCount());
+			for (FName& Tag : Component.BlockedTags)
+			{
+				Tag = ReadName();
+			}
+		}
+	}
+};
+
+bool FGASSnapshotDeltaReader::Read(const TArray<uint8>& Message, FGASWorldSnapshot& InOutSnapshot)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_SnapshotDelta);
+
+	FMemoryReader Ar(Message);
+	FGASSnapshotDeltaReaderContext Context { *this, Ar };
+
+	uint32 Magic = 0;
+	uint8 Version = 0;
+	uint8 Flags = 0;
+	Ar << Magic;
+	Ar << Version;
+	Ar << Flags;
+
+	const bool bKeyframe = EnumHasAnyFlags(static_cast<EGASDeltaFlags>(Flags), EGASDeltaFlags::Keyframe);
+	if (Ar.IsError() ||
+		Magic != DeltaMagic ||
+		Version != DeltaVersion ||
+		(!bKeyframe && !bHasKeyframe))
+	{
+		bHasKeyframe = false;
+		return false;
+	}
+
+	if (bKeyframe)
+	{
+		Names.Reset();
+		InOutSnapshot = FGASWorldSnapshot();
+	}
+
+	Ar << InOutSnapshot.Frame;
+	Ar << InOutSnapshot.WorldTime;
+	Ar << InOutSnapshot.TimeDilation;
+
+	if (bKeyframe)
+	{
+		Ar << InOutSnapshot.Source;
+	}
+
+	const int32 NumNewNames = Context.ReadCount();
+	for (int32 Index = 0; Index < NumNewNames && !Ar.IsError(); ++Index)
+	{
+		FString NameString;
+		Ar << NameString;
+		Names.Add(FName(*NameString));
+	}
+
+	TSet<uint32> Removed;
+	const int32 NumRemoved = Context.ReadCount();
+	for (int32 Index = 0; Index < NumRemoved && !Ar.IsError(); ++Index)
+	{
+		Removed.Add(Context.ReadInt());
+	}
+
+	if (Removed.Num() > 0)
+	{
+		InOutSnapshot.Components.RemoveAllSwap([&Removed](const FGASComponentSnapshot& Component)
+		{
+			return Removed.Contains(Component.Id);
+		});
+		InOutSnapshot.RebuildIndex();
+	}
+
+	// New components are appended, which leaves the index of the existing ones valid until the rebuild below
+	const int32 NumChanged = Context.ReadCount();
+	for (int32 Index = 0; Index < NumChanged && !Ar.IsError(); ++Index)
+	{
+		const uint32 Id = Context.ReadInt();
+		const EGASDeltaSections Sections = static_cast<EGASDeltaSections>(Context.Read<uint8>());
+
+		FGASComponentSnapshot* Component = InOutSnapshot.FindComponent(Id);
+		if (!Component)
+		{
+			Component = &InOutSnapshot.Components.AddDefaulted_GetRef();
+			Component->Id = Id;
+		}
+
+		Context.ReadComponent(*Component, Sections);
+	}
+
+	InOutSnapshot.LocalTime = FPlatformTime::Seconds();
+	InOutSnapshot.RebuildIndex();
+
+	bHasKeyframe = !Ar.IsError();
+	return bHasKeyframe;
+}
+
+void FGASSnapshotDeltaReader::Reset()
+{
+	Names.Reset();
+	bHasKeyframe = false;
+}
\ No newline at end of file
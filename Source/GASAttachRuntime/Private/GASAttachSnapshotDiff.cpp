@@ -0,0 +1,576 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachSnapshotDiff.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachCapture.h"
+#include "GASAttachRuntimeStats.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+static const TCHAR* GetAbilityStateName(const EGASAbilitySnapshotState State)
+{
+	switch (State)
+	{
+	case EGASAbilitySnapshotState::Inactive:		return TEXT("inactive");
+	case EGASAbilitySnapshotState::Active:			return TEXT("active");
+	case EGASAbilitySnapshotState::InputBlocked:	return TEXT("input blocked");
+	case EGASAbilitySnapshotState::TagBlocked:		return TEXT("tag blocked");
+	case EGASAbilitySnapshotState::Cooldown:		return TEXT("on cooldown");
+	}
+	return TEXT("");
+}
+
+// What's compared of each ability, attribute, effect and tag; Name and Set end up in the entry
+struct FGASAbilityDiffSummary
+{
+	FName Name;
+	FName Set;
+	int32 NumSpecs = 0;
+	int32 Level = 0;
+	int32 ActiveCount = 0;
+	EGASAbilitySnapshotState State = EGASAbilitySnapshotState::Inactive;
+
+	void Add(const FGASAbilitySnapshot& Ability)
+	{
+		// One spec per class is the rule, so the first one's state stands for them all
+		if (NumSpecs == 0)
+		{
+			Name = Ability.Ability;
+			State = Ability.State;
+		}
+
+		Level = FMath::Max(Level, Ability.Level);
+		ActiveCount += Ability.ActiveCount;
+		++NumSpecs;
+	}
+
+	bool operator==(const FGASAbilityDiffSummary& Other) const
+	{
+		return
+			NumSpecs == Other.NumSpecs &&
+			Level == Other.Level &&
+			ActiveCount == Other.ActiveCount &&
+			State == Other.State;
+	}
+	bool operator!=(const FGASAbilityDiffSummary& Other) const { return !(*this == Other); }
+
+	FString ToString() const
+	{
+		FString Result = FString::Printf(TEXT("level %d, %s"), Level, GetAbilityStateName(State));
+		if (ActiveCount > 1)
+		{
+			Result += FString::Printf(TEXT(" x%d"), ActiveCount);
+		}
+		if (NumSpecs > 1)
+		{
+			Result += FString::Printf(TEXT(", %d specs"), NumSpecs);
+		}
+		return Result;
+	}
+};
+
+struct FGASAttributeDiffSummary
+{
+	FName Name;
+	FName Set;
+	float BaseValue = 0.f;
+	float CurrentValue = 0.f;
+
+	void Add(const FGASAttributeSnapshot& Attribute)
+	{
+		Name = Attribute.Name;
+		Set = Attribute.Set;
+		BaseValue = Attribute.BaseValue;
+		CurrentValue = Attribute.CurrentValue;
+	}
+
+	bool operator==(const FGASAttributeDiffSummary& Other) const { return BaseValue == Other.BaseValue && CurrentValue == Other.CurrentValue; }
+	bool operator!=(const FGASAttributeDiffSummary& Other) const { return !(*this == Other); }
+
+	FString ToString() const
+	{
+		if (BaseValue == CurrentValue)
+		{
+			return FString::SanitizeFloat(CurrentValue);
+		}
+
+		return FString::Printf(TEXT("%s (base %s)"), *FString::SanitizeFloat(CurrentValue), *FString::SanitizeFloat(BaseValue));
+	}
+};
+
+struct FGASEffectDiffSummary
+{
+	FName Name;
+	FName Set;
+	int32 NumInstances = 0;
+	int32 StackCount = 0;
+	float Level = 0.f;
+	bool bInhibited = false;
+
+	void Add(const FGASEffectSnapshot& Effect)
+	{
+		Name = Effect.Def;
+		StackCount += Effect.StackCount;
+		Level = FMath::Max(Level, Effect.Level);
+		bInhibited |= Effect.bInhibited;
+		++NumInstances;
+	}
+
+	bool operator==(const FGASEffectDiffSummary& Other) const
+	{
+		return
+			NumInstances == Other.NumInstances &&
+			StackCount == Other.StackCount &&
+			Level == Other.Level &&
+			bInhibited == Other.bInhibited;
+	}
+	bool operator!=(const FGASEffectDiffSummary& Other) const { return !(*this == Other); }
+
+	FString ToString() const
+	{
+		FString Result = FString::Printf(TEXT("level %s, %d %s"), *FString::SanitizeFloat(Level), StackCount, StackCount == 1 ? TEXT("stack") : TEXT("stacks"));
+		if (NumInstances > 1)
+		{
+			Result += FString::Printf(TEXT(", %d instances"), NumInstances);
+		}
+		if (bInhibited)
+		{
+			Result += TEXT(", inhibited");
+		}
+		return Result;
+	}
+};
+
+struct FGASTagDiffSummary
+{
+	FName Name;
+	FName Set;
+	int32 Count = 0;
+
+	void Add(const FGASTagSnapshot& Tag)
+	{
+		Name = Tag.Tag;
+		Count += Tag.Count;
+	}
+
+	bool operator==(const FGASTagDiffSummary& Other) const { return Count == Other.Count; }
+	bool operator!=(const FGASTagDiffSummary& Other) const { return !(*this == Other); }
+
+	FString ToString() const { return FString::Printf(TEXT("count %d"), Count); }
+};
+
+template <typename SummaryType, typename ItemType, typename KeyFunctionType>
+static void Summarize(const FGASComponentSnapshot* Component, TArray<ItemType> FGASComponentSnapshot::* Items, const KeyFunctionType& GetKey, TMap<FName, SummaryType>& OutSummaries)
+{
+	OutSummaries.Reset();
+	if (!Component)
+	{
+		return;
+	}
+
+	for (const ItemType& Item : Component->*Items)
+	{
+		OutSummaries.FindOrAdd(GetKey(Item)).Add(Item);
+	}
+}
+
+template <typename SummaryType>
+static void CompareSummaries(const TMap<FName, SummaryType>& Before, const TMap<FName, SummaryType>& After, TArray<FGASDiffEntry>& OutEntries)
+{
+	OutEntries.Reset();
+
+	for (const TPair<FName, SummaryType>& Pair : After)
+	{
+		const SummaryType* BeforeSummary = Before.Find(Pair.Key);
+		if (BeforeSummary &&
+			*BeforeSummary == Pair.Value)
+		{
+			continue;
+		}
+
+		FGASDiffEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Change = BeforeSummary ? EGASDiffChange::Changed : EGASDiffChange::Added;
+		Entry.Key = Pair.Value.Name;
+		Entry.Set = Pair.Value.Set;
+		Entry.Before = BeforeSummary ? BeforeSummary->ToString() : FString();
+		Entry.After = Pair.Value.ToString();
+	}
+
+	for (const TPair<FName, SummaryType>& Pair : Before)
+	{
+		if (After.Contains(Pair.Key))
+		{
+			continue;
+		}
+
+		FGASDiffEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Change = EGASDiffChange::Removed;
+		Entry.Key = Pair.Value.Name;
+		Entry.Set = Pair.Value.Set;
+		Entry.Before = Pair.Value.ToString();
+	}
+
+	OutEntries.Sort([](const FGASDiffEntry& A, const FGASDiffEntry& B)
+	{
+		return A.Set != B.Set ? A.Set.LexicalLess(B.Set) : A.Key.LexicalLess(B.Key);
+	});
+}
+
+// Only ever a map key, so attributes of the same name in two sets stay apart; the set is kept on the entry itself
+static FName GetAttributeKey(const FName Set, const FName Name)
+{
+	return *FString::Printf(TEXT("%s.%s"), *Set.ToString(), *Name.ToString());
+}
+
+void FGASComponentDiff::Compare(const FGASComponentSnapshot* Before, const FGASComponentSnapshot* After, FGASComponentDiff& OutDiff)
+{
+	const FGASComponentSnapshot* Component = After ? After : Before;
+
+	OutDiff.Id = Component ? Component->Id : 0;
+	OutDiff.OwnerName = Component ? Component->OwnerName : NAME_None;
+	OutDiff.Change =
+		!After ? EGASDiffChange::Removed :
+		!Before ? EGASDiffChange::Added :
+		EGASDiffChange::Unchanged;
+
+	{
+		auto GetKey = [](const FGASAbilitySnapshot& Ability) { return Ability.Ability; };
+		TMap<FName, FGASAbilityDiffSummary> BeforeSummaries;
+		TMap<FName, FGASAbilityDiffSummary> AfterSummaries;
+		Summarize(Before, &FGASComponentSnapshot::Abilities, GetKey, BeforeSummaries);
+		Summarize(After, &FGASComponentSnapshot::Abilities, GetKey, AfterSummaries);
+		CompareSummaries(BeforeSummaries, AfterSummaries, OutDiff.Abilities);
+	}
+
+	{
+		auto GetKey = [](const FGASAttributeSnapshot& Attribute) { return GetAttributeKey(Attribute.Set, Attribute.Name); };
+		TMap<FName, FGASAttributeDiffSummary> BeforeSummaries;
+		TMap<FName, FGASAttributeDiffSummary> AfterSummaries;
+		Summarize(Before, &FGASComponentSnapshot::Attributes, GetKey, BeforeSummaries);
+		Summarize(After, &FGASComponentSnapshot::Attributes, GetKey, AfterSummaries);
+		CompareSummaries(BeforeSummaries, AfterSummaries, OutDiff.Attributes);
+	}
+
+	{
+		auto GetKey = [](const FGASEffectSnapshot& Effect) { return Effect.Def; };
+		TMap<FName, FGASEffectDiffSummary> BeforeSummaries;
+		TMap<FName, FGASEffectDiffSummary> AfterSummaries;
+		Summarize(Before, &FGASComponentSnapshot::Effects, GetKey, BeforeSummaries);
+		Summarize(After, &FGASComponentSnapshot::Effects, GetKey, AfterSummaries);
+		CompareSummaries(BeforeSummaries, AfterSummaries, OutDiff.Effects);
+	}
+
+	{
+		auto GetKey = [](const FGASTagSnapshot& Tag) { return Tag.Tag; };
+		TMap<FName, FGASTagDiffSummary> BeforeSummaries;
+		TMap<FName, FGASTagDiffSummary> AfterSummaries;
+		Summarize(Before, &FGASComponentSnapshot::OwnedTags, GetKey, BeforeSummaries);
+		Summarize(After, &FGASComponentSnapshot::OwnedTags, GetKey, AfterSummaries);
+		CompareSummaries(BeforeSummaries, AfterSummaries, OutDiff.Tags);
+	}
+
+	if (OutDiff.Change == EGASDiffChange::Unchanged &&
+		OutDiff.HasChanges())
+	{
+		OutDiff.Change = EGASDiffChange::Changed;
+	}
+}
+
+void FGASComponentDiff::Merge(const FGASComponentSnapshot* Before, const FGASComponentSnapshot* After, FGASComponentSnapshot& OutMerged)
+{
+	if (After)
+	{
+		OutMerged = *After;
+	}
+	else
+	{
+		OutMerged = FGASComponentSnapshot();
+		if (Before)
+		{
+			OutMerged.Id = Before->Id;
+			OutMerged.OwnerName = Before->OwnerName;
+			OutMerged.OwnerClass = Before->OwnerClass;
+		}
+	}
+
+	if (!Before)
+	{
+		return;
+	}
+
+	// Handles of two processes may collide, so removed rows count down from the top of the range instead
+	TSet<uint32> UsedHandles;
+	for (const FGASAbilitySnapshot& Ability : OutMerged.Abilities)
+	{
+		UsedHandles.Add(Ability.Handle);
+	}
+	for (const FGASEffectSnapshot& Effect : OutMerged.Effects)
+	{
+		UsedHandles.Add(Effect.Handle);
+	}
+
+	uint32 NextHandle = MAX_uint32;
+	auto MakeHandle = [&UsedHandles, &NextHandle]
+	{
+		while (UsedHandles.Contains(NextHandle))
+		{
+			--NextHandle;
+		}
+		return NextHandle--;
+	};
+
+	TSet<FName> Keys;
+	for (const FGASAbilitySnapshot& Ability : OutMerged.Abilities)
+	{
+		Keys.Add(Ability.Ability);
+	}
+	for (const FGASAbilitySnapshot& Ability : Before->Abilities)
+	{
+		if (!Keys.Contains(Ability.Ability))
+		{
+			OutMerged.Abilities.Add_GetRef(Ability).Handle = MakeHandle();
+		}
+	}
+
+	Keys.Reset();
+	for (const FGASAttributeSnapshot& Attribute : OutMerged.Attributes)
+	{
+		Keys.Add(GetAttributeKey(Attribute.Set, Attribute.Name));
+	}
+	for (const FGASAttributeSnapshot& Attribute : Before->Attributes)
+	{
+		if (!Keys.Contains(GetAttributeKey(Attribute.Set, Attribute.Name)))
+		{
+			OutMerged.Attributes.Add(Attribute);
+		}
+	}
+
+	// The tab looks up a collection whenever the set changes, so a removed attribute joins the rest of its set
+	OutMerged.Attributes.StableSort([](const FGASAttributeSnapshot& A, const FGASAttributeSnapshot& B)
+	{
+		return A.Set.LexicalLess(B.Set);
+	});
+
+	Keys.Reset();
+	for (const FGASEffectSnapshot& Effect : OutMerged.Effects)
+	{
+		Keys.Add(Effect.Def);
+	}
+	for (const FGASEffectSnapshot& Effect : Before->Effects)
+	{
+		if (!Keys.Contains(Effect.Def))
+		{
+			OutMerged.Effects.Add_GetRef(Effect).Handle = MakeHandle();
+		}
+	}
+
+	Keys.Reset();
+	for (const FGASTagSnapshot& Tag : OutMerged.OwnedTags)
+	{
+		Keys.Add(Tag.Tag);
+	}
+	for (const FGASTagSnapshot& Tag : Before->OwnedTags)
+	{
+		if (!Keys.Contains(Tag.Tag))
+		{
+			OutMerged.OwnedTags.Add(Tag);
+		}
+	}
+}
+
+bool FGASComponentDiff::HasChanges() const
+{
+	return
+		Change == EGASDiffChange::Added ||
+		Change == EGASDiffChange::Removed ||
+		Abilities.Num() > 0 ||
+		Attributes.Num() > 0 ||
+		Effects.Num() > 0 ||
+		Tags.Num() > 0;
+}
+
+static const FGASDiffEntry* FindEntry(const TArray<FGASDiffEntry>& Entries, const FName Set, const FName Key)
+{
+	return Entries.FindByPredicate([Set, Key](const FGASDiffEntry& Entry)
+	{
+		return Entry.Key == Key && Entry.Set == Set;
+	});
+}
+
+const FGASDiffEntry* FGASComponentDiff::FindAbility(const FName Ability) const
+{
+	return FindEntry(Abilities, NAME_None, Ability);
+}
+
+const FGASDiffEntry* FGASComponentDiff::FindAttribute(const FName Set, const FName Name) const
+{
+	return FindEntry(Attributes, Set, Name);
+}
+
+const FGASDiffEntry* FGASComponentDiff::FindEffect(const FName Def) const
+{
+	return FindEntry(Effects, NAME_None, Def);
+}
+
+const FGASDiffEntry* FGASComponentDiff::FindTag(const FName Tag) const
+{
+	return FindEntry(Tags, NAME_None, Tag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FGASSnapshotDiff::Compare(const FGASWorldSnapshot& Before, const FGASWorldSnapshot& After, FGASSnapshotDiff& OutDiff)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_SnapshotDiff);
+
+	OutDiff.Components.Reset();
+
+	TSet<const FGASComponentSnapshot*> MatchedComponents;
+	FGASComponentDiff ComponentDiff;
+
+	for (const FGASComponentSnapshot& Component : After.Components)
+	{
+		const FGASComponentSnapshot* BeforeComponent = FindMatchingComponent(Before, After, Component);
+		MatchedComponents.Add(BeforeComponent);
+
+		FGASComponentDiff::Compare(BeforeComponent, &Component, ComponentDiff);
+		if (ComponentDiff.HasChanges())
+		{
+			OutDiff.Components.Add(MoveTemp(ComponentDiff));
+		}
+	}
+
+	for (const FGASComponentSnapshot& Component : Before.Components)
+	{
+		if (!MatchedComponents.Contains(&Component))
+		{
+			FGASComponentDiff::Compare(&Component, nullptr, OutDiff.Components.AddDefaulted_GetRef());
+		}
+	}
+
+	OutDiff.Components.Sort([](const FGASComponentDiff& A, const FGASComponentDiff& B)
+	{
+		return A.OwnerName.LexicalLess(B.OwnerName);
+	});
+}
+
+const FGASComponentSnapshot* FGASSnapshotDiff::FindMatchingComponent(const FGASWorldSnapshot& Other, const FGASWorldSnapshot& World, const FGASComponentSnapshot& Component)
+{
+	if (Other.Source == World.Source)
+	{
+		const FGASComponentSnapshot* OtherComponent = Other.FindComponent(Component.Id);
+		if (OtherComponent &&
+			OtherComponent->OwnerName == Component.OwnerName)
+		{
+			return OtherComponent;
+		}
+	}
+
+	return Other.Components.FindByPredicate([&Component](const FGASComponentSnapshot& OtherComponent)
+	{
+		return OtherComponent.OwnerName == Component.OwnerName;
+	});
+}
+
+bool FGASSnapshotDiff::LoadCapturePoint(const FString& Point, FGASWorldSnapshot& OutSnapshot, FText& OutError)
+{
+	FString Filename = Point;
+	int32 FrameIndex = INDEX_NONE;
+
+	int32 Separator = INDEX_NONE;
+	if (Point.FindLastChar(TEXT('@'), Separator) &&
+		Point.Mid(Separator + 1).IsNumeric())
+	{
+		Filename = Point.Left(Separator);
+		FrameIndex = FCString::Atoi(*Point.Mid(Separator + 1)) - 1;
+	}
+
+	FGASCapture Capture;
+	if (!Capture.Load(Filename, OutError))
+	{
+		return false;
+	}
+
+	if (FrameIndex == INDEX_NONE)
+	{
+		FrameIndex = Capture.GetNumFrames() - 1;
+	}
+
+	if (FrameIndex < 0 ||
+		FrameIndex >= Capture.GetNumFrames())
+	{
+		OutError = FText::Format(LOCTEXT("CaptureNoFrameFormat", "{0} has frames 1 to {1}"), FText::FromString(Filename), FText::AsNumber(Capture.GetNumFrames()));
+		return false;
+	}
+
+	const FGASWorldSnapshot* Frame = Capture.GetFrame(FrameIndex);
+	if (!Frame)
+	{
+		OutError = FText::Format(LOCTEXT("CaptureFrameDamagedAtFormat", "Frame {0} of {1} is damaged"), FText::AsNumber(FrameIndex + 1), FText::FromString(Filename));
+		return false;
+	}
+
+	OutSnapshot = *Frame;
+	OutSnapshot.RebuildIndex();
+	return true;
+}
+
+static void AppendEntries(const TCHAR* Section, const bool bClassPaths, const TArray<FGASDiffEntry>& Entries, FString& OutReport)
+{
+	for (const FGASDiffEntry& Entry : Entries)
+	{
+		FString Name = bClassPaths ? FGASWorldSnapshot::GetCleanName(Entry.Key) : Entry.Key.ToString();
+		if (!Entry.Set.IsNone())
+		{
+			Name = FGASWorldSnapshot::GetCleanName(Entry.Set) + TEXT(".") + Name;
+		}
+
+		switch (Entry.Change)
+		{
+		case EGASDiffChange::Added:		OutReport += FString::Printf(TEXT("  + %s %s: %s\n"), Section, *Name, *Entry.After); break;
+		case EGASDiffChange::Removed:	OutReport += FString::Printf(TEXT("  - %s %s: %s\n"), Section, *Name, *Entry.Before); break;
+		case EGASDiffChange::Changed:	OutReport += FString::Printf(TEXT("  ~ %s %s: %s -> %s\n"), Section, *Name, *Entry.Before, *Entry.After); break;
+		default: break;
+		}
+	}
+}
+
+FString FGASSnapshotDiff::MakeReport(const FString& BeforeName, const FString& AfterName) const
+{
+	FString Report = FString::Printf(TEXT("Before: %s\nAfter: %s\n"), *BeforeName, *AfterName);
+
+	if (Components.Num() == 0)
+	{
+		Report += TEXT("No differences\n");
+		return Report;
+	}
+
+	for (const FGASComponentDiff& Component : Components)
+	{
+		// Every row of an actor that came or went differs, so it gets one line
+		if (Component.Change == EGASDiffChange::Added ||
+			Component.Change == EGASDiffChange::Removed)
+		{
+			const bool bAdded = Component.Change == EGASDiffChange::Added;
+			Report += FString::Printf(TEXT("%s %s (%s: %d abilities, %d attributes, %d effects, %d tags)\n"),
+				bAdded ? TEXT("+") : TEXT("-"),
+				*Component.OwnerName.ToString(),
+				bAdded ? TEXT("added") : TEXT("removed"),
+				Component.Abilities.Num(), Component.Attributes.Num(), Component.Effects.Num(), Component.Tags.Num());
+			continue;
+		}
+
+		Report += FString::Printf(TEXT("~ %s\n"), *Component.OwnerName.ToString());
+		AppendEntries(TEXT("ability"), true, Component.Abilities, Report);
+		AppendEntries(TEXT("attribute"), false, Component.Attributes, Report);
+		AppendEntries(TEXT("effect"), true, Component.Effects, Report);
+		AppendEntries(TEXT("tag"), false, Component.Tags, Report);
+	}
+
+	Report += FString::Printf(TEXT("%d %s differ\n"), Components.Num(), Components.Num() == 1 ? TEXT("actor") : TEXT("actors"));
+	return Report;
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
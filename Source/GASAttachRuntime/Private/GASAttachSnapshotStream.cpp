@@ -0,0 +1,459 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachSnapshotStream.h"
+#include "GASAttachRuntimeStats.h"
+
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+#define LOCTEXT_NAMESPACE "GASAttachEditor"
+
+static TAutoConsoleVariable<int32> CVarStreamPort(
+	TEXT("GASAttachEditor.Stream.Port"),
+	41920,
+	TEXT("First loopback port of the snapshot stream. Each game or server process listens on the first free one of Port .. Port + PortRange - 1, and the viewer watches all of them."));
+
+static TAutoConsoleVariable<int32> CVarStreamPortRange(
+	TEXT("GASAttachEditor.Stream.PortRange"),
+	8,
+	TEXT("Number of consecutive ports the snapshot stream may use, which is how many processes can stream at once."));
+
+static TAutoConsoleVariable<float> CVarStreamInterval(
+	TEXT("GASAttachEditor.Stream.Interval"),
+	.1f,
+	TEXT("Seconds between two snapshots a streaming process captures. Captures are skipped for as long as the viewer hasn't taken the previous one."));
+
+static TAutoConsoleVariable<int32> CVarStreamMaxBytesPerSecond(
+	TEXT("GASAttachEditor.Stream.MaxBytesPerSecond"),
+	256 * 1024,
+	TEXT("Bandwidth cap of a streaming process. A snapshot larger than this takes more than a second to go out, and the next one waits for it."));
+
+// A frame is its length, then the message
+static constexpr int32 FrameHeaderSize = sizeof(uint32);
+
+// Anything larger is not a stream of ours
+static constexpr uint32 MaxMessageSize = 64 * 1024 * 1024;
+
+static ISocketSubsystem* GetSocketSubsystem()
+{
+	return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+}
+
+static void DestroySocket(FSocket*& Socket)
+{
+	if (!Socket)
+	{
+		return;
+	}
+
+	Socket->Close();
+	GetSocketSubsystem()->DestroySocket(Socket);
+	Socket = nullptr;
+}
+
+FGASSnapshotStreamServer::~FGASSnapshotStreamServer()
+{
+	Stop();
+}
+
+bool FGASSnapshotStreamServer::Start()
+{
+	if (ListenSocket)
+	{
+		return true;
+	}
+
+	const int32 FirstPort = CVarStreamPort.GetValueOnGameThread();
+	const int32 PortRange = FMath::Max(CVarStreamPortRange.GetValueOnGameThread(), 1);
+
+	// Other processes of the same session may hold the first ports already
+	for (int32 Candidate = FirstPort; Candidate < FirstPort + PortRange && !ListenSocket; ++Candidate)
+	{
+		ListenSocket = FTcpSocketBuilder(TEXT("GASAttachEditorStream"))
+			.AsNonBlocking()
+			.BoundToAddress(FIPv4Address::InternalLoopback)
+			.BoundToPort(Candidate)
+			.Listening(1);
+
+		Port = ListenSocket ? Candidate : 0;
+	}
+
+	if (!ListenSocket)
+	{
+		return false;
+	}
+
+	LastTickTime = FPlatformTime::Seconds();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGASSnapshotStreamServer::Tick));
+
+	return true;
+}
+
+void FGASSnapshotStreamServer::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	CloseConnection();
+	DestroySocket(ListenSocket);
+	Port = 0;
+}
+
+bool FGASSnapshotStreamServer::Tick(float DeltaTime)
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_SnapshotStream);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double ElapsedTime = CurrentTime - LastTickTime;
+	LastTickTime = CurrentTime;
+
+	if (!Connection)
+	{
+		AcceptConnection();
+		if (!Connection)
+		{
+			return true;
+		}
+	}
+
+	if (Connection->GetConnectionState() == SCS_ConnectionError)
+	{
+		CloseConnection();
+		return true;
+	}
+
+	const double MaxBytesPerSecond = FMath::Max(CVarStreamMaxBytesPerSecond.GetValueOnGameThread(), 1024);
+	Allowance = FMath::Min(Allowance + ElapsedTime * MaxBytesPerSecond, MaxBytesPerSecond);
+
+	// The reader still hasn't got the last one; capturing another would only pile up
+	if (SendOffset >= SendBuffer.Num() &&
+		CurrentTime >= NextCaptureTime)
+	{
+		NextCaptureTime = CurrentTime + CVarStreamInterval.GetValueOnGameThread();
+		CaptureMessage();
+	}
+
+	Flush();
+
+	return true;
+}
+
+void FGASSnapshotStreamServer::AcceptConnection()
+{
+	bool bHasPendingConnection = false;
+	if (!ListenSocket->HasPendingConnection(bHasPendingConnection) ||
+		!bHasPendingConnection)
+	{
+		return;
+	}
+
+	Connection = ListenSocket->Accept(TEXT("GASAttachEditorStreamConnection"));
+	if (!Connection)
+	{
+		return;
+	}
+
+	Connection->SetNonBlocking(true);
+	Connection->SetNoDelay(true);
+
+	// A new reader knows nothing yet
+	Writer.Reset();
+	SendBuffer.Reset();
+	SendOffset = 0;
+	Allowance = 0.0;
+	NextCaptureTime = 0.0;
+}
+
+void FGASSnapshotStreamServer::CloseConnection()
+{
+	DestroySocket(Connection);
+
+	Writer.Reset();
+	SendBuffer.Reset();
+	SendOffset = 0;
+}
+
+void FGASSnapshotStreamServer::CaptureMessage()
+{
+	FGASWorldSnapshot::CaptureGameWorld(Snapshot);
+
+	Writer.Write(Snapshot, Message);
+
+	const uint32 MessageSize = Message.Num();
+	SendBuffer.SetNumUninitialized(FrameHeaderSize + MessageSize);
+	SendBuffer[0] = MessageSize & 0xFF;
+	SendBuffer[1] = (MessageSize >> 8) & 0xFF;
+	SendBuffer[2] = (MessageSize >> 16) & 0xFF;
+	SendBuffer[3] = (MessageSize >> 24) & 0xFF;
+	FMemory::Memcpy(SendBuffer.GetData() + FrameHeaderSize, Message.GetData(), MessageSize);
+	SendOffset = 0;
+}
+
+void FGASSnapshotStreamServer::Flush()
+{
+	while (SendOffset < SendBuffer.Num() &&
+		Allowance >= 1.0)
+	{
+		const int32 BytesToSend = FMath::Min<int32>(SendBuffer.Num() - SendOffset, static_cast<int32>(Allowance));
+
+		int32 BytesSentNow = 0;
+		if (!Connection->Send(SendBuffer.GetData() + SendOffset, BytesToSend, BytesSentNow))
+		{
+			// A full socket buffer only means the reader is behind; anything else ends the connection
+			if (GetSocketSubsystem()->GetLastErrorCode() != SE_EWOULDBLOCK)
+			{
+				CloseConnection();
+			}
+			return;
+		}
+
+		if (BytesSentNow <= 0)
+		{
+			return;
+		}
+
+		SendOffset += BytesSentNow;
+		Allowance -= BytesSentNow;
+		BytesSent += BytesSentNow;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FGASSnapshotStreamClient::FGASSnapshotStreamClient(const int32 InPort)
+	: Port(InPort)
+{
+}
+
+FGASSnapshotStreamClient::~FGASSnapshotStreamClient()
+{
+	Disconnect();
+}
+
+void FGASSnapshotStreamClient::Tick()
+{
+	if (!Socket)
+	{
+		Connect();
+		return;
+	}
+
+	if (bConnecting &&
+		!FinishConnect())
+	{
+		return;
+	}
+
+	if (!Receive())
+	{
+		Disconnect();
+	}
+}
+
+FText FGASSnapshotStreamClient::GetDisplayName() const
+{
+	if (!bHasSnapshot ||
+		Snapshot.Source.IsEmpty())
+	{
+		return FText::Format(LOCTEXT("StreamPortFormat", "Port {0}"), FText::AsNumber(Port, &FNumberFormattingOptions::DefaultNoGrouping()));
+	}
+
+	return FText::FromString(Snapshot.Source);
+}
+
+void FGASSnapshotStreamClient::Connect()
+{
+	// Nothing listening is the common case, no need to hammer it
+	static constexpr double ConnectRetryInterval = 2.0;
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime < NextConnectTime)
+	{
+		return;
+	}
+	NextConnectTime = CurrentTime + ConnectRetryInterval;
+
+	// Non-blocking - on some platforms even a refused loopback connection takes a second or two to fail
+	Socket = FTcpSocketBuilder(TEXT("GASAttachEditorStreamClient"))
+		.AsNonBlocking()
+		.Build();
+
+	if (!Socket)
+	{
+		return;
+	}
+
+	const TSharedRef<FInternetAddr> Address = FIPv4Endpoint(FIPv4Address::InternalLoopback, Port).ToInternetAddr();
+	if (!Socket->Connect(*Address))
+	{
+		const ESocketErrors Error = GetSocketSubsystem()->GetLastErrorCode();
+		if (Error != SE_EWOULDBLOCK &&
+			Error != SE_EINPROGRESS)
+		{
+			DestroySocket(Socket);
+			return;
+		}
+	}
+
+	bConnecting = true;
+}
+
+bool FGASSnapshotStreamClient::FinishConnect()
+{
+	// A refused connection may look writable too; the first receive then tells it apart
+	if (!Socket->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::Zero()))
+	{
+		if (FPlatformTime::Seconds() >= NextConnectTime)
+		{
+			DestroySocket(Socket);
+			bConnecting = false;
+		}
+		return false;
+	}
+
+	bConnecting = false;
+
+	Reader.Reset();
+	ReceiveBuffer.Reset();
+	bHasSnapshot = false;
+
+	return true;
+}
+
+void FGASSnapshotStreamClient::Disconnect()
+{
+	DestroySocket(Socket);
+	bConnecting = false;
+
+	Reader.Reset();
+	ReceiveBuffer.Reset();
+	Snapshot = FGASWorldSnapshot();
+	bHasSnapshot = false;
+}
+
+bool FGASSnapshotStreamClient::Receive()
+{
+	GAS_ATTACH_EDITOR_SCOPE(STAT_GASAttachEditor_SnapshotStream);
+
+	// A burst is taken over several frames rather than stalling the editor on one
+	static constexpr int32 ChunkSize = 64 * 1024;
+	static constexpr int32 MaxBytesPerTick = 4 * 1024 * 1024;
+
+	for (int32 BytesThisTick = 0; BytesThisTick < MaxBytesPerTick;)
+	{
+		Chunk.SetNumUninitialized(ChunkSize);
+
+		int32 BytesRead = 0;
+		const bool bReceived = Socket->Recv(Chunk.GetData(), ChunkSize, BytesRead);
+
+		// False is the other end going away; true with nothing read is nothing more for now
+		if (!bReceived)
+		{
+			return false;
+		}
+
+		if (BytesRead <= 0)
+		{
+			break;
+		}
+
+		ReceiveBuffer.Append(Chunk.GetData(), BytesRead);
+		BytesThisTick += BytesRead;
+		BytesReceived += BytesRead;
+	}
+
+	int32 ParseOffset = 0;
+	while (ReceiveBuffer.Num() - ParseOffset >= FrameHeaderSize)
+	{
+		const uint8* Header = ReceiveBuffer.GetData() + ParseOffset;
+		const uint32 MessageSize = Header[0] | (Header[1] << 8) | (Header[2] << 16) | (static_cast<uint32>(Header[3]) << 24);
+		if (MessageSize > MaxMessageSize)
+		{
+			return false;
+		}
+
+		if (ReceiveBuffer.Num() - ParseOffset < FrameHeaderSize + static_cast<int64>(MessageSize))
+		{
+			break;
+		}
+
+		Message.SetNumUninitialized(MessageSize);
+		FMemory::Memcpy(Message.GetData(), Header + FrameHeaderSize, MessageSize);
+		ParseOffset += FrameHeaderSize + MessageSize;
+
+		if (!Reader.Read(Message, Snapshot))
+		{
+			return false;
+		}
+
+		bHasSnapshot = true;
+	}
+
+	ReceiveBuffer.RemoveAt(0, ParseOffset);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FGASSnapshotStreamBrowser::Tick()
+{
+	const int32 FirstPort = CVarStreamPort.GetValueOnGameThread();
+	const int32 PortRange = FMath::Max(CVarStreamPortRange.GetValueOnGameThread(), 1);
+
+	if (Clients.Num() != PortRange ||
+		Clients[0]->GetPort() != FirstPort)
+	{
+		Clients.Reset();
+		for (int32 Port = FirstPort; Port < FirstPort + PortRange; ++Port)
+		{
+			Clients.Add(MakeUnique<FGASSnapshotStreamClient>(Port));
+		}
+	}
+
+	for (const TUniquePtr<FGASSnapshotStreamClient>& Client : Clients)
+	{
+		Client->Tick();
+	}
+}
+
+void FGASSnapshotStreamBrowser::Reset()
+{
+	Clients.Reset();
+}
+
+void FGASSnapshotStreamBrowser::GetLiveStreams(TArray<const FGASSnapshotStreamClient*>& OutStreams) const
+{
+	for (const TUniquePtr<FGASSnapshotStreamClient>& Client : Clients)
+	{
+		if (Client->IsConnected() &&
+			Client->HasSnapshot())
+		{
+			OutStreams.Add(Client.Get());
+		}
+	}
+}
+
+const FGASSnapshotStreamClient* FGASSnapshotStreamBrowser::FindStream(const int32 Port) const
+{
+	for (const TUniquePtr<FGASSnapshotStreamClient>& Client : Clients)
+	{
+		if (Client->GetPort() == Port)
+		{
+			return Client.Get();
+		}
+	}
+
+	return nullptr;
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,348 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachTagIndex.h"
+#include "GASAttachSnapshot.h"
+
+#include "Serialization/Archive.h"
+
+void FGASFrameRuns::Add(const int32 Frame)
+{
+	if (Runs.Num() > 0)
+	{
+		FRun& LastRun = Runs.Last();
+		if (Frame <= LastRun.Last)
+		{
+			return;
+		}
+
+		if (Frame == LastRun.Last + 1)
+		{
+			LastRun.Last = Frame;
+			return;
+		}
+	}
+
+	Runs.Add({ Frame, Frame });
+}
+
+bool FGASFrameRuns::Contains(const int32 Frame) const
+{
+	int32 Low = 0;
+	int32 High = Runs.Num();
+	while (Low < High)
+	{
+		const int32 Middle = (Low + High) / 2;
+		if (Runs[Middle].Last < Frame)
+		{
+			Low = Middle + 1;
+		}
+		else
+		{
+			High = Middle;
+		}
+	}
+
+	return Low < Runs.Num() && Runs[Low].First <= Frame;
+}
+
+int32 FGASFrameRuns::CountFrames() const
+{
+	int32 Count = 0;
+	for (const FRun& Run : Runs)
+	{
+		Count += Run.Last - Run.First + 1;
+	}
+	return Count;
+}
+
+void FGASFrameRuns::Intersect(const FGASFrameRuns& A, const FGASFrameRuns& B, FGASFrameRuns& Out)
+{
+	Out.Runs.Reset();
+
+	int32 IndexA = 0;
+	int32 IndexB = 0;
+	while (IndexA < A.Runs.Num() &&
+		IndexB < B.Runs.Num())
+	{
+		const FRun& RunA = A.Runs[IndexA];
+		const FRun& RunB = B.Runs[IndexB];
+
+		const int32 First = FMath::Max(RunA.First, RunB.First);
+		const int32 Last = FMath::Min(RunA.Last, RunB.Last);
+		if (First <= Last)
+		{
+			Out.Runs.Add({ First, Last });
+		}
+
+		// Whichever ends first can't overlap anything further on in the other
+		if (RunA.Last < RunB.Last)
+		{
+			++IndexA;
+		}
+		else
+		{
+			++IndexB;
+		}
+	}
+}
+
+void FGASFrameRuns::Union(const FGASFrameRuns& A, const FGASFrameRuns& B, FGASFrameRuns& Out)
+{
+	Out.Runs.Reset(A.Runs.Num() + B.Runs.Num());
+
+	int32 IndexA = 0;
+	int32 IndexB = 0;
+	while (IndexA < A.Runs.Num() ||
+		IndexB < B.Runs.Num())
+	{
+		const bool bTakeA = IndexB >= B.Runs.Num() || (IndexA < A.Runs.Num() && A.Runs[IndexA].First <= B.Runs[IndexB].First);
+		const FRun& Run = bTakeA ? A.Runs[IndexA++] : B.Runs[IndexB++];
+
+		// Overlapping or adjacent runs become one
+		if (Out.Runs.Num() > 0 &&
+			Run.First <= Out.Runs.Last().Last + 1)
+		{
+			Out.Runs.Last().Last = FMath::Max(Out.Runs.Last().Last, Run.Last);
+			continue;
+		}
+
+		Out.Runs.Add(Run);
+	}
+}
+
+void FGASFrameRuns::Subtract(const FGASFrameRuns& A, const FGASFrameRuns& B, FGASFrameRuns& Out)
+{
+	Out.Runs.Reset();
+
+	int32 IndexB = 0;
+	for (const FRun& RunA : A.Runs)
+	{
+		int32 First = RunA.First;
+
+		while (IndexB < B.Runs.Num() &&
+			B.Runs[IndexB].Last < First)
+		{
+			++IndexB;
+		}
+
+		// Cut out every run of B that overlaps this one; the last of them may go on into the next run of A
+		int32 Index = IndexB;
+		while (Index < B.Runs.Num() &&
+			B.Runs[Index].First <= RunA.Last)
+		{
+			if (B.Runs[Index].First > First)
+			{
+				Out.Runs.Add({ First, B.Runs[Index].First - 1 });
+			}
+			First = FMath::Max(First, B.Runs[Index].Last + 1);
+			++Index;
+		}
+
+		if (First <= RunA.Last)
+		{
+			Out.Runs.Add({ First, RunA.Last });
+		}
+	}
+}
+
+void FGASFrameRuns::Serialize(FArchive& Ar, const int32 NumFrames)
+{
+	uint32 NumRuns = Runs.Num();
+	Ar.SerializeIntPacked(NumRuns);
+
+	if (Ar.IsLoading())
+	{
+		// Each run takes at least two bytes; anything more is not an index of ours
+		if (Ar.IsError() ||
+			NumRuns > static_cast<uint64>(Ar.TotalSize() - Ar.Tell()) / 2)
+		{
+			Ar.SetError();
+			Runs.Reset();
+			return;
+		}
+
+		Runs.SetNumUninitialized(NumRuns);
+	}
+
+	int32 PreviousLast = -1;
+	for (FRun& Run : Runs)
+	{
+		uint32 Gap = Run.First - PreviousLast - 1;
+		uint32 Length = Run.Last - Run.First;
+		Ar.SerializeIntPacked(Gap);
+		Ar.SerializeIntPacked(Length);
+
+		if (Ar.IsLoading())
+		{
+			// Wide enough that no gap or length wraps around; the rest of the code counts on runs in range and in order
+			const int64 First = static_cast<int64>(PreviousLast) + 1 + Gap;
+			const int64 Last = First + Length;
+			if (Ar.IsError() ||
+				Last >= NumFrames)
+			{
+				Ar.SetError();
+				Runs.Reset();
+				return;
+			}
+
+			Run.First = static_cast<int32>(First);
+			Run.Last = static_cast<int32>(Last);
+		}
+
+		PreviousLast = Run.Last;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FGASTagIndex::Reset()
+{
+	NumFrames = 0;
+	Components.Reset();
+	ComponentIndices.Reset();
+}
+
+void FGASTagIndex::Add(const int32 Frame, const FGASWorldSnapshot& Snapshot)
+{
+	NumFrames = FMath::Max(NumFrames, Frame + 1);
+
+	for (const FGASComponentSnapshot& Component : Snapshot.Components)
+	{
+		int32& Index = ComponentIndices.FindOrAdd(Component.Id, INDEX_NONE);
+		if (Index == INDEX_NONE)
+		{
+			Index = Components.Num();
+
+			FComponentTags& NewComponent = Components.AddDefaulted_GetRef();
+			NewComponent.Id = Component.Id;
+			NewComponent.OwnerName = Component.OwnerName;
+		}
+
+		FComponentTags& ComponentTags = Components[Index];
+		ComponentTags.Present.Add(Frame);
+
+		// Two children of one parent add the same frame to it, which Add ignores the second time
+		for (const FGASTagSnapshot& Tag : Component.OwnedTags)
+		{
+			for (const FName Prefix : GetTagPrefixes(Tag.Tag))
+			{
+				ComponentTags.Tags.FindOrAdd(Prefix).Add(Frame);
+			}
+		}
+	}
+}
+
+const TArray<FName>& FGASTagIndex::GetTagPrefixes(const FName Tag)
+{
+	if (const TArray<FName>* Prefixes = TagPrefixes.Find(Tag))
+	{
+		return *Prefixes;
+	}
+
+	TArray<FName>& Prefixes = TagPrefixes.Add(Tag);
+
+	const FString TagString = Tag.ToString();
+	for (int32 Index = TagString.Find(TEXT(".")); Index != INDEX_NONE; Index = TagString.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1))
+	{
+		Prefixes.Add(FName(*TagString.Left(Index)));
+	}
+	Prefixes.Add(Tag);
+
+	return Prefixes;
+}
+
+void FGASTagIndex::GetTagRuns(const FComponentTags& Component, const FName Tag, FGASFrameRuns& OutRuns)
+{
+	const FGASFrameRuns* Runs = Component.Tags.Find(Tag);
+	if (Runs)
+	{
+		OutRuns = *Runs;
+	}
+	else
+	{
+		OutRuns.Runs.Reset();
+	}
+}
+
+bool FGASTagIndex::Serialize(FArchive& Ar)
+{
+	// Names are written as text, as the archive may not know how to write an FName
+	int32 NumComponents = Components.Num();
+	Ar << NumFrames;
+	Ar << NumComponents;
+
+	if (Ar.IsLoading())
+	{
+		ComponentIndices.Reset();
+		if (Ar.IsError() ||
+			NumFrames < 0 ||
+			NumComponents < 0 ||
+			NumComponents > Ar.TotalSize() - Ar.Tell())
+		{
+			Reset();
+			return false;
+		}
+
+		Components.SetNum(NumComponents);
+	}
+
+	for (int32 Index = 0; Index < NumComponents && !Ar.IsError(); ++Index)
+	{
+		FComponentTags& Component = Components[Index];
+
+		FString OwnerName = Component.OwnerName.ToString();
+		Ar << Component.Id;
+		Ar << OwnerName;
+		Component.Present.Serialize(Ar, NumFrames);
+
+		int32 NumTags = Component.Tags.Num();
+		Ar << NumTags;
+
+		if (Ar.IsLoading())
+		{
+			Component.OwnerName = FName(*OwnerName);
+			ComponentIndices.Add(Component.Id, Index);
+
+			Component.Tags.Reset();
+			for (int32 TagIndex = 0; TagIndex < NumTags && !Ar.IsError(); ++TagIndex)
+			{
+				FString TagName;
+				Ar << TagName;
+				Component.Tags.Add(FName(*TagName)).Serialize(Ar, NumFrames);
+			}
+
+			// Indices written before parents were stored only hold each tag under its own name
+			TArray<FName> TagNames;
+			Component.Tags.GetKeys(TagNames);
+			FGASFrameRuns Merged;
+			for (const FName TagName : TagNames)
+			{
+				const TArray<FName>& Prefixes = GetTagPrefixes(TagName);
+				for (int32 PrefixIndex = 0; PrefixIndex < Prefixes.Num() - 1; ++PrefixIndex)
+				{
+					FGASFrameRuns& ParentRuns = Component.Tags.FindOrAdd(Prefixes[PrefixIndex]);
+					FGASFrameRuns::Union(ParentRuns, Component.Tags.FindChecked(TagName), Merged);
+					Swap(ParentRuns, Merged);
+				}
+			}
+			continue;
+		}
+
+		for (TPair<FName, FGASFrameRuns>& Pair : Component.Tags)
+		{
+			FString TagName = Pair.Key.ToString();
+			Ar << TagName;
+			Pair.Value.Serialize(Ar);
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		Reset();
+		return false;
+	}
+
+	return true;
+}
\ No newline at end of file
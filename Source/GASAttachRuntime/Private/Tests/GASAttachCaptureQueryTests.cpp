@@ -0,0 +1,219 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachCaptureQuery.h"
+#include "GASAttachCapture.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASAttachCaptureQueryTests
+{
+	/** "1:0-9 2:100-129", whatever order the matches came in */
+	static FString ToString(const TArray<FGASCaptureQuery::FMatch>& Matches)
+	{
+		TArray<FString> Parts;
+		for (const FGASCaptureQuery::FMatch& Match : Matches)
+		{
+			Parts.Add(FString::Printf(TEXT("%u:%d-%d"), Match.ComponentId, Match.FirstFrame, Match.LastFrame));
+		}
+		Parts.Sort();
+		return FString::Join(Parts, TEXT(" "));
+	}
+
+	/**
+	 * Hero (1) is there throughout, with Health counting the frames; it's stunned over 10-19 and 70-75, burns
+	 * over 50-59 and has Mana from 70 on. Minion (2) only comes at 100, with Health 5, so that its columns start
+	 * a couple of words into the capture - and a Health of 50 in another set, which makes the bare name ambiguous.
+	 */
+	static constexpr int32 NumFrames = 130;
+
+	static bool WriteCapture(const FString& Filename)
+	{
+		FGASCaptureWriter Writer;
+		if (!Writer.Open(Filename, TArray<FString>()))
+		{
+			return false;
+		}
+
+		FGASWorldSnapshot Snapshot;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Snapshot.Frame = Frame;
+			Snapshot.WorldTime = Frame * .1;
+			Snapshot.Components.Reset();
+
+			FGASComponentSnapshot& Hero = Snapshot.Components.AddDefaulted_GetRef();
+			Hero.Id = 1;
+			Hero.OwnerName = TEXT("Hero");
+			Hero.Attributes.Add({ TEXT("/Script/Game.HealthSet"), TEXT("Health"), 100.f, static_cast<float>(Frame) });
+			if (Frame >= 70)
+			{
+				Hero.Attributes.Add({ TEXT("/Script/Game.ManaSet"), TEXT("Mana"), 50.f, 50.f });
+			}
+			if ((Frame >= 10 && Frame <= 19) ||
+				(Frame >= 70 && Frame <= 75))
+			{
+				Hero.OwnedTags.Add({ TEXT("State.Stunned"), 1 });
+			}
+			if (Frame >= 50 && Frame <= 59)
+			{
+				FGASEffectSnapshot& Effect = Hero.Effects.AddDefaulted_GetRef();
+				Effect.Handle = 1;
+				Effect.Def = TEXT("/Game/GE_Burning.GE_Burning_C");
+				Effect.StackCount = 1;
+			}
+
+			if (Frame >= 100)
+			{
+				FGASComponentSnapshot& Minion = Snapshot.Components.AddDefaulted_GetRef();
+				Minion.Id = 2;
+				Minion.OwnerName = TEXT("Minion");
+				Minion.Attributes.Add({ TEXT("/Script/Game.HealthSet"), TEXT("Health"), 5.f, 5.f });
+				Minion.Attributes.Add({ TEXT("/Script/Game.ShieldSet"), TEXT("Health"), 50.f, 50.f });
+			}
+
+			Snapshot.RebuildIndex();
+			Writer.Append(Snapshot);
+		}
+
+		Writer.Close();
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASCaptureQueryParseTest, "GASAttachEditor.CaptureQuery.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASCaptureQueryParseTest::RunTest(const FString& Parameters)
+{
+	FGASCaptureQuery Query;
+	FText Error;
+
+	const TCHAR* Valid[] =
+	{
+		TEXT("Health < 10"),
+		TEXT("Health<=10.5"),
+		TEXT("HealthSet.Health > 0"),
+		TEXT("Health = -1"),
+		TEXT("State.Stunned"),
+		TEXT("tag State.Stunned"),
+		TEXT("Health < 10 and State.Stunned"),
+		TEXT("effect GE_Burning and not (ability GA_Dodge or Mana >= 50)"),
+		TEXT("!State.Stunned && (Health != 0 || Mana > 1)"),
+	};
+	for (const TCHAR* Text : Valid)
+	{
+		TestTrue(FString::Printf(TEXT("Parses \"%s\""), Text), Query.Parse(Text, Error));
+	}
+
+	const TCHAR* Invalid[] =
+	{
+		TEXT(""),
+		TEXT("   "),
+		TEXT("Health <"),
+		TEXT("Health < x"),
+		TEXT("(State.Stunned"),
+		TEXT("Health < 10 and"),
+		TEXT("not"),
+		TEXT("State.Stunned State.Dead"),
+		TEXT("effect"),
+	};
+	for (const TCHAR* Text : Invalid)
+	{
+		Error = FText::GetEmpty();
+		TestFalse(FString::Printf(TEXT("Rejects \"%s\""), Text), Query.Parse(Text, Error));
+		TestFalse(FString::Printf(TEXT("Explains \"%s\""), Text), Error.IsEmpty());
+	}
+
+	// A failed parse leaves nothing to run
+	TestFalse(TEXT("UsesOnlyTags after a failed parse"), Query.UsesOnlyTags());
+
+	TestTrue(TEXT("Parses a tag"), Query.Parse(TEXT("not (State.Stunned or State.Dead)"), Error));
+	TestTrue(TEXT("Tags only"), Query.UsesOnlyTags());
+	TestTrue(TEXT("Parses an attribute"), Query.Parse(TEXT("State.Stunned and Health < 10"), Error));
+	TestFalse(TEXT("Not tags only with an attribute"), Query.UsesOnlyTags());
+	TestTrue(TEXT("Parses an effect"), Query.Parse(TEXT("State.Stunned or effect GE_Burning"), Error));
+	TestFalse(TEXT("Not tags only with an effect"), Query.UsesOnlyTags());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASCaptureQueryRunTest, "GASAttachEditor.CaptureQuery.Run",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASCaptureQueryRunTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachCaptureQueryTests;
+
+	const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("CaptureQueryTest.gascapture"));
+	if (!TestTrue(TEXT("Capture written"), WriteCapture(Filename)))
+	{
+		return false;
+	}
+
+	FGASCapture Capture;
+	FText Error;
+	const bool bLoaded = Capture.Load(Filename, Error);
+	TestTrue(TEXT("Capture loaded"), bLoaded);
+
+	FGASCaptureColumns Columns;
+	const bool bBuilt = bLoaded && Columns.Build(Capture);
+	TestTrue(TEXT("Columns built"), bBuilt);
+	TestEqual(TEXT("Columns frames"), Columns.GetNumFrames(), NumFrames);
+
+	if (bBuilt)
+	{
+		const TPair<const TCHAR*, const TCHAR*> Cases[] =
+		{
+			// Minion has Health in two sets, which a bare name can't tell apart
+			{ TEXT("Health < 10"), TEXT("1:0-9") },
+			{ TEXT("HealthSet.Health < 10"), TEXT("1:0-9 2:100-129") },
+			{ TEXT("ShieldSet.Health > 10"), TEXT("2:100-129") },
+			{ TEXT("Health >= 60 and Health < 70"), TEXT("1:60-69") },
+			// NaN where a component or attribute isn't doesn't count as unequal
+			{ TEXT("Health != 5"), TEXT("1:0-4 1:6-129") },
+			{ TEXT("Mana >= 0"), TEXT("1:70-129") },
+			{ TEXT("Mana < 0"), TEXT("") },
+			{ TEXT("Stamina < 100"), TEXT("") },
+			{ TEXT("State.Stunned"), TEXT("1:10-19 1:70-75") },
+			{ TEXT("State"), TEXT("1:10-19 1:70-75") },
+			{ TEXT("State.Stun"), TEXT("") },
+			// Not only holds where the component is
+			{ TEXT("not State.Stunned"), TEXT("1:0-9 1:20-69 1:76-129 2:100-129") },
+			{ TEXT("not State.Stunned and HealthSet.Health < 20"), TEXT("1:0-9 2:100-129") },
+			{ TEXT("effect GE_Burning"), TEXT("1:50-59") },
+			{ TEXT("effect GE_Burning or State.Stunned"), TEXT("1:10-19 1:50-59 1:70-75") },
+			{ TEXT("ability GA_Dash"), TEXT("") },
+		};
+
+		for (const TPair<const TCHAR*, const TCHAR*>& Case : Cases)
+		{
+			FGASCaptureQuery Query;
+			if (!TestTrue(FString::Printf(TEXT("Parses \"%s\""), Case.Key), Query.Parse(Case.Key, Error)))
+			{
+				continue;
+			}
+
+			TArray<FGASCaptureQuery::FMatch> Matches;
+			Query.Run(Columns, Matches);
+			TestEqual(FString::Printf(TEXT("Columns \"%s\""), Case.Key), ToString(Matches), FString(Case.Value));
+
+			// The tag index has to agree with the columns for every query it can run
+			const FGASTagIndex* TagIndex = Capture.GetTagIndex();
+			if (Query.UsesOnlyTags() &&
+				TestNotNull(TEXT("Tag index"), TagIndex))
+			{
+				Query.Run(*TagIndex, Matches);
+				TestEqual(FString::Printf(TEXT("Tag index \"%s\""), Case.Key), ToString(Matches), FString(Case.Value));
+			}
+		}
+	}
+
+	IFileManager::Get().Delete(*Filename);
+	return true;
+}
+
+#endif
\ No newline at end of file
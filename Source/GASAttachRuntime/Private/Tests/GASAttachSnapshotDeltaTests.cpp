@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachSnapshotDelta.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASAttachSnapshotDeltaTests
+{
+	static bool IsSameComponent(const FGASComponentSnapshot& A, const FGASComponentSnapshot& B)
+	{
+		return
+			A.Id == B.Id &&
+			A.OwnerName == B.OwnerName &&
+			A.OwnerClass == B.OwnerClass &&
+			A.Attributes == B.Attributes &&
+			A.Effects == B.Effects &&
+			A.Abilities == B.Abilities &&
+			A.OwnedTags == B.OwnedTags &&
+			A.BlockedTags == B.BlockedTags;
+	}
+
+	/** The reader may keep components in another order than they were written in */
+	static bool IsSameSnapshot(const FGASWorldSnapshot& Written, const FGASWorldSnapshot& Read)
+	{
+		if (Written.Frame != Read.Frame ||
+			Written.WorldTime != Read.WorldTime ||
+			Written.TimeDilation != Read.TimeDilation ||
+			Written.Source != Read.Source ||
+			Written.Components.Num() != Read.Components.Num())
+		{
+			return false;
+		}
+
+		for (const FGASComponentSnapshot& Component : Written.Components)
+		{
+			const FGASComponentSnapshot* ReadComponent = Read.FindComponent(Component.Id);
+			if (!ReadComponent ||
+				!IsSameComponent(Component, *ReadComponent))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static FGASComponentSnapshot MakeComponent(const uint32 Id, const TCHAR* OwnerName)
+	{
+		FGASComponentSnapshot Component;
+		Component.Id = Id;
+		Component.OwnerName = OwnerName;
+		Component.OwnerClass = TEXT("/Game/BP_Character.BP_Character_C");
+
+		Component.Attributes.Add({ TEXT("/Script/Game.HealthSet"), TEXT("Health"), 100.f, 100.f });
+		Component.Attributes.Add({ TEXT("/Script/Game.HealthSet"), TEXT("MaxHealth"), 100.f, 100.f });
+
+		FGASEffectSnapshot& Effect = Component.Effects.AddDefaulted_GetRef();
+		Effect.Handle = Id * 10;
+		Effect.Def = TEXT("/Game/GE_Regen.GE_Regen_C");
+		Effect.Level = 1.f;
+		Effect.StackCount = 1;
+		Effect.Duration = -1.f;
+		Effect.Period = .5f;
+		Effect.bPredicted = true;
+		Effect.Modifiers = { 2.f, .5f };
+
+		FGASAbilitySnapshot& Ability = Component.Abilities.AddDefaulted_GetRef();
+		Ability.Handle = Id * 10 + 1;
+		Ability.Ability = TEXT("/Game/GA_Dash.GA_Dash_C");
+		Ability.Level = 1;
+		Ability.State = EGASAbilitySnapshotState::Cooldown;
+		Ability.CooldownStartWorldTime = 1.5f;
+		Ability.CooldownDuration = 3.f;
+
+		Component.OwnedTags.Add({ TEXT("State.Alive"), 1 });
+		Component.BlockedTags.Add(TEXT("Ability.Dash"));
+
+		return Component;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASSnapshotDeltaRoundTripTest, "GASAttachEditor.SnapshotDelta.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASSnapshotDeltaRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachSnapshotDeltaTests;
+
+	FGASSnapshotDeltaWriter Writer;
+	FGASSnapshotDeltaReader Reader;
+	FGASWorldSnapshot Read;
+	TArray<uint8> Message;
+
+	FGASWorldSnapshot Snapshot;
+	Snapshot.Frame = 1;
+	Snapshot.WorldTime = 2.0;
+	Snapshot.TimeDilation = .5f;
+	Snapshot.Source = TEXT("Dedicated Server (1234)");
+	Snapshot.Components.Add(MakeComponent(1, TEXT("Hero")));
+	Snapshot.Components.Add(MakeComponent(2, TEXT("Minion")));
+	Snapshot.RebuildIndex();
+
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Keyframe reads"), Reader.Read(Message, Read));
+	TestTrue(TEXT("Keyframe round trip"), IsSameSnapshot(Snapshot, Read));
+
+	const int32 KeyframeSize = Message.Num();
+
+	// Nothing changed but the time
+	++Snapshot.Frame;
+	Snapshot.WorldTime += .1;
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Unchanged delta reads"), Reader.Read(Message, Read));
+	TestTrue(TEXT("Unchanged delta round trip"), IsSameSnapshot(Snapshot, Read));
+	TestTrue(TEXT("Unchanged delta is smaller than the keyframe"), Message.Num() < KeyframeSize);
+
+	// A value within the same layout, an effect applied, a tag gone
+	++Snapshot.Frame;
+	Snapshot.Components[0].Attributes[0].CurrentValue = 75.f;
+	FGASEffectSnapshot& Burning = Snapshot.Components[0].Effects.AddDefaulted_GetRef();
+	Burning.Handle = 99;
+	Burning.Def = TEXT("/Game/GE_Burning.GE_Burning_C");
+	Burning.StackCount = 3;
+	Burning.Duration = 5.f;
+	Burning.StartWorldTime = 2.1f;
+	Burning.bInhibited = true;
+	Snapshot.Components[1].OwnedTags.Reset();
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Changed delta reads"), Reader.Read(Message, Read));
+	TestTrue(TEXT("Changed delta round trip"), IsSameSnapshot(Snapshot, Read));
+
+	// One component gone, another one come
+	++Snapshot.Frame;
+	Snapshot.Components.RemoveAt(1);
+	Snapshot.Components.Add(MakeComponent(3, TEXT("Boss")));
+	Snapshot.RebuildIndex();
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Components delta reads"), Reader.Read(Message, Read));
+	TestTrue(TEXT("Components delta round trip"), IsSameSnapshot(Snapshot, Read));
+	TestNull(TEXT("Removed component is gone"), Read.FindComponent(2));
+
+	// An attribute set granted, which changes the layout values are sent by
+	++Snapshot.Frame;
+	Snapshot.Components[0].Attributes.Insert({ TEXT("/Script/Game.ManaSet"), TEXT("Mana"), 50.f, 40.f }, 1);
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Layout delta reads"), Reader.Read(Message, Read));
+	TestTrue(TEXT("Layout delta round trip"), IsSameSnapshot(Snapshot, Read));
+
+	// Values by index into the new layout
+	++Snapshot.Frame;
+	Snapshot.Components[0].Attributes[2].BaseValue = 120.f;
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Delta after the layout change reads"), Reader.Read(Message, Read));
+	TestTrue(TEXT("Delta after the layout change round trip"), IsSameSnapshot(Snapshot, Read));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASSnapshotDeltaKeyframeTest, "GASAttachEditor.SnapshotDelta.Keyframe",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASSnapshotDeltaKeyframeTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachSnapshotDeltaTests;
+
+	FGASSnapshotDeltaWriter Writer;
+	TArray<uint8> Message;
+
+	FGASWorldSnapshot Snapshot;
+	Snapshot.Components.Add(MakeComponent(1, TEXT("Hero")));
+	Snapshot.RebuildIndex();
+
+	Writer.Write(Snapshot, Message);
+
+	++Snapshot.Frame;
+	Snapshot.Components[0].Attributes[0].CurrentValue = 50.f;
+	Writer.Write(Snapshot, Message);
+
+	// A reader joining late can't make anything of a delta
+	FGASSnapshotDeltaReader LateReader;
+	FGASWorldSnapshot Read;
+	TestFalse(TEXT("Delta without its keyframe is rejected"), LateReader.Read(Message, Read));
+
+	// Until the writer starts over
+	Writer.Reset();
+	++Snapshot.Frame;
+	Writer.Write(Snapshot, Message);
+	TestTrue(TEXT("Keyframe after Reset reads"), LateReader.Read(Message, Read));
+	TestTrue(TEXT("Keyframe after Reset round trip"), IsSameSnapshot(Snapshot, Read));
+
+	TArray<uint8> Garbage = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	TestFalse(TEXT("Garbage is rejected"), LateReader.Read(Garbage, Read));
+
+	return true;
+}
+
+#endif
\ No newline at end of file
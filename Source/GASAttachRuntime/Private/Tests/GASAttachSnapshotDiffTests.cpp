@@ -0,0 +1,229 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachSnapshotDiff.h"
+#include "GASAttachSnapshot.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASAttachSnapshotDiffTests
+{
+	static FGASComponentSnapshot MakeComponent(const uint32 Id, const TCHAR* OwnerName)
+	{
+		FGASComponentSnapshot Component;
+		Component.Id = Id;
+		Component.OwnerName = OwnerName;
+
+		Component.Attributes.Add({ TEXT("/Script/Game.HealthSet"), TEXT("Health"), 100.f, 100.f });
+		Component.Attributes.Add({ TEXT("/Script/Game.HealthSet"), TEXT("MaxHealth"), 100.f, 100.f });
+
+		FGASEffectSnapshot& Effect = Component.Effects.AddDefaulted_GetRef();
+		Effect.Handle = 1;
+		Effect.Def = TEXT("/Game/GE_Regen.GE_Regen_C");
+		Effect.Level = 1.f;
+		Effect.StackCount = 1;
+
+		FGASAbilitySnapshot& Ability = Component.Abilities.AddDefaulted_GetRef();
+		Ability.Handle = 2;
+		Ability.Ability = TEXT("/Game/GA_Dash.GA_Dash_C");
+		Ability.Level = 1;
+
+		Component.OwnedTags.Add({ TEXT("State.Alive"), 1 });
+
+		return Component;
+	}
+
+	static bool HasChange(const FGASDiffEntry* Entry, const EGASDiffChange Change)
+	{
+		return Entry && Entry->Change == Change;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASComponentDiffTest, "GASAttachEditor.SnapshotDiff.Component",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASComponentDiffTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachSnapshotDiffTests;
+
+	const FGASComponentSnapshot Before = MakeComponent(1, TEXT("Hero"));
+	FGASComponentDiff Diff;
+
+	FGASComponentDiff::Compare(&Before, &Before, Diff);
+	TestFalse(TEXT("Same component has no changes"), Diff.HasChanges());
+	TestTrue(TEXT("Same component is unchanged"), Diff.Change == EGASDiffChange::Unchanged);
+
+	// Handles differ between runs, so a new handle alone is no change
+	FGASComponentSnapshot After = Before;
+	After.Effects[0].Handle = 10;
+	After.Abilities[0].Handle = 20;
+	FGASComponentDiff::Compare(&Before, &After, Diff);
+	TestFalse(TEXT("New handles are no change"), Diff.HasChanges());
+
+	After.Abilities[0].Ability = TEXT("/Game/GA_Dodge.GA_Dodge_C");
+	After.Attributes[0].CurrentValue = 50.f;
+	After.Effects[0].StackCount = 3;
+	After.OwnedTags.Reset();
+	FGASComponentDiff::Compare(&Before, &After, Diff);
+
+	TestTrue(TEXT("Changed component"), Diff.Change == EGASDiffChange::Changed);
+	TestTrue(TEXT("Ability added"), HasChange(Diff.FindAbility(TEXT("/Game/GA_Dodge.GA_Dodge_C")), EGASDiffChange::Added));
+	TestTrue(TEXT("Ability removed"), HasChange(Diff.FindAbility(TEXT("/Game/GA_Dash.GA_Dash_C")), EGASDiffChange::Removed));
+	TestTrue(TEXT("Attribute changed"), HasChange(Diff.FindAttribute(TEXT("/Script/Game.HealthSet"), TEXT("Health")), EGASDiffChange::Changed));
+	TestNull(TEXT("Unchanged attribute"), Diff.FindAttribute(TEXT("/Script/Game.HealthSet"), TEXT("MaxHealth")));
+	TestTrue(TEXT("Effect changed"), HasChange(Diff.FindEffect(TEXT("/Game/GE_Regen.GE_Regen_C")), EGASDiffChange::Changed));
+	TestTrue(TEXT("Tag removed"), HasChange(Diff.FindTag(TEXT("State.Alive")), EGASDiffChange::Removed));
+
+	if (const FGASDiffEntry* Entry = Diff.FindAttribute(TEXT("/Script/Game.HealthSet"), TEXT("Health")))
+	{
+		TestEqual(TEXT("Attribute before"), Entry->Before, TEXT("100.0"));
+		TestEqual(TEXT("Attribute after"), Entry->After, TEXT("50.0 (base 100.0)"));
+	}
+
+	// Each side missing makes the whole component added or removed
+	FGASComponentDiff::Compare(nullptr, &Before, Diff);
+	TestTrue(TEXT("Added component"), Diff.Change == EGASDiffChange::Added);
+	TestEqual(TEXT("Added component's attributes"), Diff.Attributes.Num(), Before.Attributes.Num());
+	FGASComponentDiff::Compare(&Before, nullptr, Diff);
+	TestTrue(TEXT("Removed component"), Diff.Change == EGASDiffChange::Removed);
+	TestTrue(TEXT("Removed component's tag"), HasChange(Diff.FindTag(TEXT("State.Alive")), EGASDiffChange::Removed));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASComponentDiffAttributeKeyTest, "GASAttachEditor.SnapshotDiff.AttributeKey",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASComponentDiffAttributeKeyTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachSnapshotDiffTests;
+
+	// Set and name that run together into the same text as another pair
+	FGASComponentSnapshot Before;
+	Before.Attributes.Add({ TEXT("/Script/Game.A"), TEXT("BC"), 1.f, 1.f });
+	FGASComponentSnapshot After;
+	After.Attributes.Add({ TEXT("/Script/Game.AB"), TEXT("C"), 1.f, 1.f });
+
+	FGASComponentDiff Diff;
+	FGASComponentDiff::Compare(&Before, &After, Diff);
+	TestEqual(TEXT("Both attributes differ"), Diff.Attributes.Num(), 2);
+	TestTrue(TEXT("Attribute removed"), HasChange(Diff.FindAttribute(TEXT("/Script/Game.A"), TEXT("BC")), EGASDiffChange::Removed));
+	TestTrue(TEXT("Attribute added"), HasChange(Diff.FindAttribute(TEXT("/Script/Game.AB"), TEXT("C")), EGASDiffChange::Added));
+
+	FGASComponentSnapshot Merged;
+	FGASComponentDiff::Merge(&Before, &After, Merged);
+	TestEqual(TEXT("Merge keeps both attributes"), Merged.Attributes.Num(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASComponentDiffMergeTest, "GASAttachEditor.SnapshotDiff.Merge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASComponentDiffMergeTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachSnapshotDiffTests;
+
+	FGASComponentSnapshot Before = MakeComponent(1, TEXT("Hero"));
+	FGASEffectSnapshot& Burning = Before.Effects.AddDefaulted_GetRef();
+	Burning.Handle = 3;
+	Burning.Def = TEXT("/Game/GE_Burning.GE_Burning_C");
+	Before.Attributes.Add({ TEXT("/Script/Game.ManaSet"), TEXT("Mana"), 50.f, 50.f });
+
+	// Handles of another process, one of them the very top of the range removed rows count down from
+	FGASComponentSnapshot After = MakeComponent(1, TEXT("Hero"));
+	After.Effects[0].Handle = MAX_uint32;
+	After.Abilities.Reset();
+	After.OwnedTags.Reset();
+
+	FGASComponentSnapshot Merged;
+	FGASComponentDiff::Merge(&Before, &After, Merged);
+
+	TestEqual(TEXT("Merged abilities"), Merged.Abilities.Num(), 1);
+	TestEqual(TEXT("Merged effects"), Merged.Effects.Num(), 2);
+	TestEqual(TEXT("Merged attributes"), Merged.Attributes.Num(), 3);
+	TestEqual(TEXT("Merged tags"), Merged.OwnedTags.Num(), 1);
+
+	TSet<uint32> Handles;
+	for (const FGASEffectSnapshot& Effect : Merged.Effects)
+	{
+		Handles.Add(Effect.Handle);
+	}
+	for (const FGASAbilitySnapshot& Ability : Merged.Abilities)
+	{
+		Handles.Add(Ability.Handle);
+	}
+	TestEqual(TEXT("Merged handles are unique"), Handles.Num(), Merged.Effects.Num() + Merged.Abilities.Num());
+	TestTrue(TEXT("After keeps its handle"), Handles.Contains(MAX_uint32) && Merged.Effects[0].Handle == MAX_uint32);
+
+	// The tab expects the attributes of a set together
+	TestTrue(TEXT("Merged attributes by set"), Merged.Attributes.Last().Set == FName(TEXT("/Script/Game.ManaSet")));
+
+	// A removed component comes back whole
+	FGASComponentDiff::Merge(&Before, nullptr, Merged);
+	TestEqual(TEXT("Removed component's effects"), Merged.Effects.Num(), Before.Effects.Num());
+	TestEqual(TEXT("Removed component's owner"), Merged.OwnerName.ToString(), TEXT("Hero"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASSnapshotDiffTest, "GASAttachEditor.SnapshotDiff.World",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASSnapshotDiffTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachSnapshotDiffTests;
+
+	FGASWorldSnapshot Before;
+	Before.Source = TEXT("Dedicated Server (1)");
+	Before.Components.Add(MakeComponent(1, TEXT("Hero")));
+	Before.Components.Add(MakeComponent(2, TEXT("Minion")));
+	Before.RebuildIndex();
+
+	FGASSnapshotDiff Diff;
+	FGASSnapshotDiff::Compare(Before, Before, Diff);
+	TestEqual(TEXT("Same snapshot has no differences"), Diff.Components.Num(), 0);
+	TestTrue(TEXT("Report of no differences"), Diff.MakeReport(TEXT("A"), TEXT("B")).Contains(TEXT("No differences\n")));
+
+	// Another run: the ids differ, so components are matched by owner name
+	FGASWorldSnapshot After;
+	After.Source = TEXT("Dedicated Server (2)");
+	After.Components.Add(MakeComponent(11, TEXT("Minion")));
+	After.Components.Add(MakeComponent(12, TEXT("Hero")));
+	After.Components.Add(MakeComponent(13, TEXT("Boss")));
+	After.Components[1].Attributes[0].CurrentValue = 10.f;
+	After.RebuildIndex();
+
+	TestTrue(TEXT("Matched by owner name across sources"), FGASSnapshotDiff::FindMatchingComponent(Before, After, After.Components[1]) == &Before.Components[0]);
+
+	FGASSnapshotDiff::Compare(Before, After, Diff);
+	if (TestEqual(TEXT("Components that differ"), Diff.Components.Num(), 2))
+	{
+		// Sorted by owner name
+		TestEqual(TEXT("Added component"), Diff.Components[0].OwnerName.ToString(), TEXT("Boss"));
+		TestTrue(TEXT("Added component's change"), Diff.Components[0].Change == EGASDiffChange::Added);
+		TestEqual(TEXT("Changed component"), Diff.Components[1].OwnerName.ToString(), TEXT("Hero"));
+		TestTrue(TEXT("Changed component's change"), Diff.Components[1].Change == EGASDiffChange::Changed);
+		TestTrue(TEXT("Changed component's id is of After"), Diff.Components[1].Id == 12);
+	}
+	TestTrue(TEXT("Report counts the actors"), Diff.MakeReport(TEXT("A"), TEXT("B")).EndsWith(TEXT("2 actors differ\n")));
+
+	// The same source: matched by id, as long as the owner is the same
+	FGASWorldSnapshot Later = Before;
+	Later.Components.RemoveAt(1);
+	Later.Components[0].Id = 2;
+	Later.RebuildIndex();
+	TestTrue(TEXT("Id of another owner isn't a match"), FGASSnapshotDiff::FindMatchingComponent(Before, Later, Later.Components[0]) == &Before.Components[0]);
+
+	FGASSnapshotDiff::Compare(Before, Later, Diff);
+	if (TestEqual(TEXT("Removed component differs"), Diff.Components.Num(), 1))
+	{
+		TestEqual(TEXT("Removed component"), Diff.Components[0].OwnerName.ToString(), TEXT("Minion"));
+		TestTrue(TEXT("Removed component's change"), Diff.Components[0].Change == EGASDiffChange::Removed);
+	}
+
+	return true;
+}
+
+#endif
\ No newline at end of file
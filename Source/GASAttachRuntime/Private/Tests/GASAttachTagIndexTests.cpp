@@ -0,0 +1,206 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GASAttachTagIndex.h"
+#include "GASAttachSnapshot.h"
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASAttachTagIndexTests
+{
+	static FGASFrameRuns MakeRuns(std::initializer_list<TPair<int32, int32>> Runs)
+	{
+		FGASFrameRuns Result;
+		for (const TPair<int32, int32>& Run : Runs)
+		{
+			for (int32 Frame = Run.Key; Frame <= Run.Value; ++Frame)
+			{
+				Result.Add(Frame);
+			}
+		}
+		return Result;
+	}
+
+	static FString ToString(const FGASFrameRuns& Runs)
+	{
+		TArray<FString> Parts;
+		for (const FGASFrameRuns::FRun& Run : Runs.Runs)
+		{
+			Parts.Add(FString::Printf(TEXT("%d-%d"), Run.First, Run.Last));
+		}
+		return FString::Join(Parts, TEXT(" "));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASFrameRunsTest, "GASAttachEditor.TagIndex.FrameRuns",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASFrameRunsTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachTagIndexTests;
+
+	// Consecutive frames join a run, repeated or older ones are ignored
+	FGASFrameRuns Added;
+	for (const int32 Frame : { 0, 1, 2, 2, 1, 5, 6, 9 })
+	{
+		Added.Add(Frame);
+	}
+	TestEqual(TEXT("Add"), ToString(Added), TEXT("0-2 5-6 9-9"));
+	TestEqual(TEXT("CountFrames"), Added.CountFrames(), 6);
+	TestTrue(TEXT("Contains a run's first frame"), Added.Contains(5));
+	TestTrue(TEXT("Contains a run's last frame"), Added.Contains(6));
+	TestFalse(TEXT("Contains a gap"), Added.Contains(4));
+	TestFalse(TEXT("Contains past the end"), Added.Contains(10));
+	TestFalse(TEXT("Contains before the start"), Added.Contains(-1));
+
+	const FGASFrameRuns A = MakeRuns({ { 0, 9 }, { 20, 29 }, { 40, 40 } });
+	const FGASFrameRuns B = MakeRuns({ { 5, 24 }, { 30, 35 }, { 40, 50 } });
+	const FGASFrameRuns Empty;
+
+	FGASFrameRuns Out;
+
+	FGASFrameRuns::Intersect(A, B, Out);
+	TestEqual(TEXT("Intersect"), ToString(Out), TEXT("5-9 20-24 40-40"));
+	FGASFrameRuns::Intersect(A, Empty, Out);
+	TestEqual(TEXT("Intersect with nothing"), ToString(Out), TEXT(""));
+
+	// Adjacent runs of the two sides merge into one
+	FGASFrameRuns::Union(A, B, Out);
+	TestEqual(TEXT("Union"), ToString(Out), TEXT("0-35 40-50"));
+	FGASFrameRuns::Union(Empty, B, Out);
+	TestEqual(TEXT("Union with nothing"), ToString(Out), ToString(B));
+
+	FGASFrameRuns::Subtract(A, B, Out);
+	TestEqual(TEXT("Subtract"), ToString(Out), TEXT("0-4 25-29"));
+	FGASFrameRuns::Subtract(B, A, Out);
+	TestEqual(TEXT("Subtract the other way"), ToString(Out), TEXT("10-19 30-35 41-50"));
+	FGASFrameRuns::Subtract(A, Empty, Out);
+	TestEqual(TEXT("Subtract nothing"), ToString(Out), ToString(A));
+
+	// One run of B cutting several holes into one of A, and going on into the next
+	const FGASFrameRuns Wide = MakeRuns({ { 0, 20 }, { 30, 40 } });
+	const FGASFrameRuns Holes = MakeRuns({ { 2, 3 }, { 8, 8 }, { 15, 32 } });
+	FGASFrameRuns::Subtract(Wide, Holes, Out);
+	TestEqual(TEXT("Subtract several holes"), ToString(Out), TEXT("0-1 4-7 9-14 33-40"));
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	FGASFrameRuns Written = A;
+	Written.Serialize(Writer);
+
+	FMemoryReader Reader(Data);
+	FGASFrameRuns Read;
+	Read.Serialize(Reader);
+	TestFalse(TEXT("Serialize reads without error"), Reader.IsError());
+	TestEqual(TEXT("Serialize round trip"), ToString(Read), ToString(A));
+
+	// A count no archive of that size can hold
+	TArray<uint8> Garbage = { 0xFF, 0xFF, 0xFF, 0x7F };
+	FMemoryReader GarbageReader(Garbage);
+	Read.Serialize(GarbageReader);
+	TestTrue(TEXT("Serialize rejects a malformed count"), GarbageReader.IsError());
+	TestEqual(TEXT("Serialize leaves nothing of a malformed count"), Read.Runs.Num(), 0);
+
+	// Runs that go past the frames the capture has
+	FMemoryReader ShortReader(Data);
+	Read.Serialize(ShortReader, 30);
+	TestTrue(TEXT("Serialize rejects runs past the last frame"), ShortReader.IsError());
+	TestEqual(TEXT("Serialize leaves nothing of runs past the last frame"), Read.Runs.Num(), 0);
+
+	// A gap that would wrap First around to a negative frame
+	TArray<uint8> Wrapping;
+	FMemoryWriter WrappingWriter(Wrapping);
+	uint32 NumRuns = 1;
+	uint32 Gap = MAX_uint32;
+	uint32 Length = 0;
+	WrappingWriter.SerializeIntPacked(NumRuns);
+	WrappingWriter.SerializeIntPacked(Gap);
+	WrappingWriter.SerializeIntPacked(Length);
+	FMemoryReader WrappingReader(Wrapping);
+	Read.Serialize(WrappingReader);
+	TestTrue(TEXT("Serialize rejects a run out of range"), WrappingReader.IsError());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASTagIndexTest, "GASAttachEditor.TagIndex.Index",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGASTagIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace GASAttachTagIndexTests;
+
+	FGASTagIndex Index;
+	FGASWorldSnapshot Snapshot;
+
+	for (int32 Frame = 0; Frame < 10; ++Frame)
+	{
+		Snapshot.Components.Reset();
+
+		FGASComponentSnapshot& Component = Snapshot.Components.AddDefaulted_GetRef();
+		Component.Id = 1;
+		Component.OwnerName = TEXT("Hero");
+		if (Frame >= 2 && Frame <= 4)
+		{
+			Component.OwnedTags.Add({ TEXT("State.Stunned"), 1 });
+		}
+		if (Frame >= 4 && Frame <= 6)
+		{
+			Component.OwnedTags.Add({ TEXT("State.Dead"), 1 });
+		}
+
+		// Only there for the second half
+		if (Frame >= 5)
+		{
+			FGASComponentSnapshot& Other = Snapshot.Components.AddDefaulted_GetRef();
+			Other.Id = 2;
+			Other.OwnerName = TEXT("Minion");
+		}
+
+		Index.Add(Frame, Snapshot);
+	}
+
+	TestEqual(TEXT("NumFrames"), Index.GetNumFrames(), 10);
+	if (!TestEqual(TEXT("Components"), Index.GetComponents().Num(), 2))
+	{
+		return false;
+	}
+
+	const FGASTagIndex::FComponentTags& Hero = Index.GetComponents()[0];
+	const FGASTagIndex::FComponentTags& Minion = Index.GetComponents()[1];
+	TestEqual(TEXT("Present"), ToString(Hero.Present), TEXT("0-9"));
+	TestEqual(TEXT("Present for part of the capture"), ToString(Minion.Present), TEXT("5-9"));
+
+	FGASFrameRuns Runs;
+	FGASTagIndex::GetTagRuns(Hero, TEXT("State.Stunned"), Runs);
+	TestEqual(TEXT("A tag"), ToString(Runs), TEXT("2-4"));
+
+	// A parent matches any of its children, as HasMatchingGameplayTag does
+	FGASTagIndex::GetTagRuns(Hero, TEXT("State"), Runs);
+	TestEqual(TEXT("A parent tag"), ToString(Runs), TEXT("2-6"));
+
+	// Not a parent, only a prefix of the name
+	FGASTagIndex::GetTagRuns(Hero, TEXT("State.Stun"), Runs);
+	TestEqual(TEXT("A prefix that isn't a parent"), ToString(Runs), TEXT(""));
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	TestTrue(TEXT("Serialize writes"), Index.Serialize(Writer));
+
+	FGASTagIndex Read;
+	FMemoryReader Reader(Data);
+	TestTrue(TEXT("Serialize reads"), Read.Serialize(Reader));
+	if (TestEqual(TEXT("Components read"), Read.GetComponents().Num(), 2))
+	{
+		FGASTagIndex::GetTagRuns(Read.GetComponents()[0], TEXT("State"), Runs);
+		TestEqual(TEXT("Runs read"), ToString(Runs), TEXT("2-6"));
+		TestEqual(TEXT("Owner read"), Read.GetComponents()[1].OwnerName.ToString(), TEXT("Minion"));
+	}
+
+	return true;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachSnapshotDelta.h"
+#include "GASAttachRecordingProfile.h"
+#include "GASAttachTagIndex.h"
+
+/**
+ * Writes a capture file: the snapshots of one world over time, as the messages of a FGASSnapshotDeltaWriter.
+ *
+ * Every GASAttachEditor.Capture.KeyframeInterval-th frame is a keyframe, so that a reader gets to any frame
+ * by decoding at most that many messages. A capture of a single snapshot is one keyframe. The file also
+ * lists every gameplay tag the writing process knows, for readers that don't have the project's tags, and
+ * ends with the FGASTagIndex of its frames when closed - unless messages were appended as they are.
+ */
+class GASATTACHRUNTIME_API FGASCaptureWriter
+{
+public:
+	~FGASCaptureWriter();
+
+	bool Open(const FString& InFilename);
+	/** Writes TagNames as the capture's tags, for when the file is opened off the game thread */
+	bool Open(const FString& InFilename, const TArray<FString>& TagNames);
+	void Close();
+
+	bool IsOpen() const { return File.IsValid(); }
+	const FString& GetFilename() const { return Filename; }
+	int32 GetNumFrames() const { return NumFrames; }
+
+	void Append(const FGASWorldSnapshot& Snapshot);
+
+	/**
+	 * Appends a message of a FGASSnapshotDeltaWriter as it is. The first message of a file, and every one that
+	 * follows a Reset of that writer, is a keyframe.
+	 */
+	void AppendMessage(const TArray<uint8>& InMessage, double WorldTime, bool bKeyframe);
+
+	static const TCHAR* Extension;
+
+	/** Saved/GASAttachEditor/<Prefix>-<date>.gascapture */
+	static FString MakeFilename(const TCHAR* Prefix);
+
+	/** Every registered tag, as Open writes them; game thread only, as the tag manager is */
+	static void GetTagNames(TArray<FString>& OutTagNames);
+
+private:
+	void WriteRecord(const TArray<uint8>& InMessage, double WorldTime, uint8 Flags);
+
+private:
+	TUniquePtr<FArchive> File;
+	FString Filename;
+	int32 NumFrames = 0;
+
+	FGASSnapshotDeltaWriter Writer;
+	TArray<uint8> Message;
+
+	// Only complete if every frame went through Append
+	FGASTagIndex TagIndex;
+	bool bTagIndexComplete = true;
+};
+
+/** A capture file read back, any of whose frames can be decoded on demand. */
+class GASATTACHRUNTIME_API FGASCapture
+{
+public:
+	bool Load(const FString& InFilename, FText& OutError);
+
+	const FString& GetFilename() const { return Filename; }
+	int32 GetNumFrames() const { return Frames.Num(); }
+	double GetWorldTime(int32 FrameIndex) const { return Frames[FrameIndex].WorldTime; }
+
+	/** Tags of the process that wrote the capture */
+	const TArray<FName>& GetTagNames() const { return TagNames; }
+
+	/** Null for captures that were cut short, or hold messages appended as they are */
+	const FGASTagIndex* GetTagIndex() const { return bHasTagIndex ? &TagIndex : nullptr; }
+
+	/**
+	 * The snapshot of FrameIndex, or null if the file is damaged there. Decodes on from the frame decoded last
+	 * when going forward, from the closest keyframe before FrameIndex otherwise.
+	 */
+	const FGASWorldSnapshot* GetFrame(int32 FrameIndex);
+
+private:
+	struct FFrame
+	{
+		int64 Offset = 0;
+		int32 Size = 0;
+		double WorldTime = 0.0;
+		bool bKeyframe = false;
+	};
+
+	FString Filename;
+	TArray<uint8> Data;
+	TArray<FFrame> Frames;
+	TArray<FName> TagNames;
+	FGASTagIndex TagIndex;
+	bool bHasTagIndex = false;
+
+	FGASSnapshotDeltaReader Reader;
+	FGASWorldSnapshot Snapshot;
+	int32 DecodedFrame = INDEX_NONE;
+	TArray<uint8> Message;
+};
+
+/**
+ * Records this process' game world into a capture file every GASAttachEditor.Capture.Interval seconds, or as
+ * often as its profile says, taking only the channels and actors of the profile.
+ */
+class GASATTACHRUNTIME_API FGASCaptureRecorder
+{
+public:
+	~FGASCaptureRecorder();
+
+	bool Start(const FString& Filename, const FGASRecordingProfile& InProfile = FGASRecordingProfile());
+	void Stop();
+
+	const FGASRecordingProfile& GetProfile() const { return Profile; }
+
+	bool IsRecording() const { return Writer.IsOpen(); }
+	const FString& GetFilename() const { return Writer.GetFilename(); }
+	int32 GetNumFrames() const { return Writer.GetNumFrames(); }
+
+	/** Writes a capture of a single snapshot of this process' game world */
+	static bool SaveSnapshot(const FString& Filename);
+
+private:
+	bool Tick(float DeltaTime);
+
+private:
+	FGASCaptureWriter Writer;
+	FGASWorldSnapshot Snapshot;
+
+	FGASRecordingProfile Profile;
+	FGASComponentSnapshot::FCaptureFunction CaptureComponent = nullptr;
+	TFunction<bool(const UAbilitySystemComponent&)> Filter;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	double NextCaptureTime = 0.0;
+};
\ No newline at end of file
@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachTagIndex.h"
+
+class FGASCapture;
+
+/**
+ * The frames of a capture decoded once and laid out by column, for queries to scan.
+ *
+ * Each component gets a value per frame for each of its attributes, and a bitmap of frames for each tag it
+ * owned, effect it had and ability it ran. Attribute columns only span the words from the first to the last
+ * frame the attribute was seen in, as those take 32 times the memory of a bitmap and most components of a long
+ * capture only live for a part of it. Columns are padded to whole bitmap words, so that scans never need a
+ * scalar tail; a frame without the component or the attribute holds NaN, which compares false to anything.
+ */
+class GASATTACHRUNTIME_API FGASCaptureColumns
+{
+public:
+	// One bit per frame, 64 frames per word
+	using FBitmap = TArray<uint64>;
+
+	struct FAttributeColumn
+	{
+		// Values[0] is the first frame of this word
+		int32 FirstWord = 0;
+		// A whole number of words
+		TArray<float> Values;
+
+		int32 GetNumWords() const { return Values.Num() / 64; }
+	};
+
+	struct FComponentColumns
+	{
+		uint32 Id = 0;
+		FName OwnerName;
+
+		// Frames the component is in
+		FBitmap Present;
+		// Current values, by the clean name of the set and the attribute's, e.g. "HealthSet.Health"
+		TMap<FName, FAttributeColumn> Attributes;
+		// Attribute name to its key in Attributes, or None if the component has it in more than one set
+		TMap<FName, FName> AttributeAliases;
+		// By tag name; a tag's parents are set along with it, as for HasMatchingGameplayTag
+		TMap<FName, FBitmap> Tags;
+		// By the clean name of the effect's or ability's class; abilities only while active
+		TMap<FName, FBitmap> Effects;
+		TMap<FName, FBitmap> Abilities;
+	};
+
+	/** Decodes every frame of Capture. False if one is damaged, in which case the frames before it are kept */
+	bool Build(FGASCapture& Capture);
+
+	bool IsBuilt() const { return NumFrames > 0; }
+	int32 GetNumFrames() const { return NumFrames; }
+	int32 GetNumWords() const { return NumWords; }
+	const TArray<FComponentColumns>& GetComponents() const { return Components; }
+
+private:
+	int32 NumFrames = 0;
+	int32 NumWords = 0;
+	TArray<FComponentColumns> Components;
+};
+
+/**
+ * A condition on the components of a capture, run over its columns a whole bitmap at a time.
+ *
+ *   Health < 10 and State.Stunned
+ *   effect GE_Burning and not (ability GA_Dodge or Mana >= 50)
+ *
+ * An attribute compares to a number with <, <=, >, >=, == or !=, named with its set - HealthSet.Health - or
+ * alone where only one set of the component has it; a bare name is a tag the component owns;
+ * "effect" and "ability" test for an effect on it or an ability running, by class name. Conditions combine
+ * with and, or, not and parentheses.
+ */
+class GASATTACHRUNTIME_API FGASCaptureQuery
+{
+public:
+	/** A run of consecutive frames in which a component matches */
+	struct FMatch
+	{
+		uint32 ComponentId = 0;
+		FName OwnerName;
+		int32 FirstFrame = 0;
+		int32 LastFrame = 0;
+	};
+
+	bool Parse(const FString& Text, FText& OutError);
+
+	/** Every run that matches, in the order they start in */
+	void Run(const FGASCaptureColumns& Columns, TArray<FMatch>& OutMatches) const;
+
+	/** True if the query only tests tags, and so can run on a capture's tag index instead of its columns */
+	bool UsesOnlyTags() const;
+
+	/** As for the columns, but walking the runs of the index; the query has to use only tags */
+	void Run(const FGASTagIndex& TagIndex, TArray<FMatch>& OutMatches) const;
+
+private:
+	enum class ENodeType : uint8
+	{
+		Attribute,
+		Tag,
+		Effect,
+		Ability,
+		And,
+		Or,
+		Not,
+	};
+
+	enum class ECompare : uint8
+	{
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		Equal,
+		NotEqual,
+	};
+
+	struct FNode
+	{
+		ENodeType Type = ENodeType::Tag;
+		ECompare Compare = ECompare::Less;
+		FName Name;
+		float Value = 0.f;
+		// Operands of And, Or and Not
+		int32 Left = INDEX_NONE;
+		int32 Right = INDEX_NONE;
+	};
+
+	friend struct FGASCaptureQueryParser;
+
+	void Evaluate(int32 NodeIndex, const FGASCaptureColumns::FComponentColumns& Component, int32 NumWords, FGASCaptureColumns::FBitmap& OutBitmap) const;
+	void Evaluate(int32 NodeIndex, const FGASTagIndex::FComponentTags& Component, FGASFrameRuns& OutRuns) const;
+
+	static void SortMatches(TArray<FMatch>& Matches);
+
+private:
+	TArray<FNode> Nodes;
+	int32 Root = INDEX_NONE;
+};
\ No newline at end of file
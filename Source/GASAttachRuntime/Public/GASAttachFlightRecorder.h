@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/WeakObjectPtr.h"
+#include "GameplayTagContainer.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachSnapshotDelta.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * Keeps the last GASAttachEditor.FlightRecorder.Seconds of the game world in memory, as the messages of a
+ * FGASSnapshotDeltaWriter, and writes them to a capture file when an ensure fires, on a crash or at the end
+ * of a PIE session.
+ *
+ * Messages are kept in runs that each start with a keyframe, and the oldest run is dropped as a whole once it
+ * falls out of the time window or GASAttachEditor.FlightRecorder.MaxMemoryKB is exceeded, so that what is
+ * left always decodes. GASAttachEditor.FlightRecorder.Scope picks which components are recorded; by default
+ * only the one selected in the viewer and those owning GASAttachEditor.FlightRecorder.Tag, the whole world
+ * being opt-in.
+ *
+ * Ensures and crashes dump from whichever thread they happen on, so everything a dump needs - frames and the
+ * names of the tags - is gathered on the game thread beforehand and only read under FramesLock.
+ */
+class GASATTACHRUNTIME_API FGASFlightRecorder
+{
+public:
+	FGASFlightRecorder();
+	~FGASFlightRecorder();
+
+	/** What the Selected scope records; the viewer sets it as its selection changes */
+	void SetSelectedComponent(const UAbilitySystemComponent* Component);
+
+	/** Writes what is recorded to a capture file; false if there is nothing or the file can't be written */
+	bool Dump(const FString& Filename);
+
+	/**
+	 * Called by the editor as a PIE session ends - a world tearing down can't tell that apart from a map travel
+	 * within the session. Dumps if GASAttachEditor.FlightRecorder.DumpOn asks for it, then starts over.
+	 */
+	void OnPIEEnd();
+
+	int32 GetNumFrames() const { return Frames.Num(); }
+	int64 GetNumBytes() const { return NumBytes; }
+
+private:
+	bool Tick(float DeltaTime);
+	void CaptureScope();
+	void CaptureSelectedOrTagged(const UAbilitySystemComponent* Selected, const FGameplayTag& Tag);
+	void Append();
+	void Evict(int64 MaxBytes, double MinLocalTime);
+	void Clear();
+
+	/** Dumps to Saved/GASAttachEditor/<Reason>-<date>.gascapture, if anything was recorded */
+	bool DumpFor(const TCHAR* Reason);
+
+	void OnEnsure();
+	void OnSystemError();
+
+private:
+	struct FFrame
+	{
+		TArray<uint8> Message;
+		double WorldTime = 0.0;
+		double LocalTime = 0.0;
+		bool bKeyframe = false;
+	};
+
+	// Held while Frames change, as ensures and crashes dump from whichever thread they happen on
+	FCriticalSection FramesLock;
+	TArray<FFrame> Frames;
+	int64 NumBytes = 0;
+	int64 NumRunBytes = 0;
+	int32 NumRunFrames = 0;
+
+	// Of the tag manager, which only the game thread may ask; refreshed with every keyframe
+	TArray<FString> TagNames;
+
+	FGASSnapshotDeltaWriter Writer;
+	FGASWorldSnapshot Snapshot;
+	bool bLastSnapshotEmpty = true;
+
+	TWeakObjectPtr<const UAbilitySystemComponent> SelectedComponent;
+
+	double NextCaptureTime = 0.0;
+	// Under FramesLock, as ensures may fire on several threads at once
+	double LastEnsureDumpTime = -DBL_MAX;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle EnsureHandle;
+	FDelegateHandle SystemErrorHandle;
+};
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachSnapshot.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * What a capture records: which channels of a component, how often, and of which actors.
+ *
+ * Full, Attributes, EffectEvents and Tags are built in. More are read from the [GASAttachEditor.RecordingProfile.<Name>]
+ * sections of the game config, which can also replace a built-in one:
+ *
+ *   [GASAttachEditor.RecordingProfile.BossHealth]
+ *   Channels=Attributes,EffectEvents
+ *   +Attributes=Health
+ *   Interval=0.05
+ *   ActorClass=BP_Boss_C
+ *
+ * Channels are Attributes, Effects, EffectEvents (effects applied and removed, without their details),
+ * Abilities, Tags and Full. The actor filters are ActorName (a wildcard on the owner's name), ActorClass
+ * (the owner's class or one of its parents, by name, which has to be loaded when recording starts) and
+ * ActorTag (a gameplay tag the component owns).
+ */
+struct GASATTACHRUNTIME_API FGASRecordingProfile
+{
+	FString Name = TEXT("Full");
+	EGASSnapshotChannels Channels = EGASSnapshotChannels::Full;
+	// Property names of the attributes recorded, all of them if empty
+	TSet<FName> Attributes;
+	// Seconds between two snapshots, GASAttachEditor.Capture.Interval if 0
+	float Interval = 0.f;
+
+	FString ActorName;
+	FName ActorClass;
+	FName ActorTag;
+
+	/** A built-in or configured profile by name */
+	static bool Find(const FString& ProfileName, FGASRecordingProfile& OutProfile);
+	static TArray<FString> GetNames();
+
+	/** The capture compiled for this profile's channels; see FGASComponentSnapshot::GetCaptureFunction */
+	FGASComponentSnapshot::FCaptureFunction GetCaptureFunction() const;
+
+	/** Whether a component is recorded, with the class and tag resolved once, and only the filters that are set checked */
+	TFunction<bool(const UAbilitySystemComponent&)> MakeFilter() const;
+};
\ No newline at end of file
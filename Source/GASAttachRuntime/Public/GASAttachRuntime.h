@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FGASSnapshotStreamServer;
+class FGASCaptureRecorder;
+class FGASFlightRecorder;
+struct FGASRecordingProfile;
+
+/**
+ * What a game or server process needs to be inspected from the outside: the collector, the snapshot and
+ * capture formats, the stream server and the recorder. No Slate and no editor, so that it can go into
+ * Development and Test builds of a game or dedicated server; the viewer UI lives in GASAttachEditor.
+ */
+class GASATTACHRUNTIME_API FGASAttachRuntimeModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+	/** Streams this process' game world to the viewer of another process; see FGASSnapshotStreamServer */
+	bool StartStreaming();
+	void StopStreaming();
+	/** 0 while not streaming */
+	int32 GetStreamingPort() const;
+
+	/** Records this process' game world to a capture file; see FGASCaptureRecorder */
+	bool StartRecording(const FString& Filename, const FGASRecordingProfile& Profile);
+	void StopRecording();
+	bool IsRecording() const;
+
+	/** Always there while the module is loaded; see FGASFlightRecorder */
+	FGASFlightRecorder* GetFlightRecorder() const { return FlightRecorder.Get(); }
+
+private:
+	TSharedPtr<FGASSnapshotStreamServer> StreamServer;
+	TSharedPtr<FGASCaptureRecorder> CaptureRecorder;
+	TSharedPtr<FGASFlightRecorder> FlightRecorder;
+};
\ No newline at end of file
@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("GAS Attach Editor"), STATGROUP_GASAttachEditor, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Snapshot Capture"), STAT_GASAttachEditor_SnapshotCapture, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Snapshot Delta"), STAT_GASAttachEditor_SnapshotDelta, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Snapshot Stream"), STAT_GASAttachEditor_SnapshotStream, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Record"), STAT_GASAttachEditor_CaptureRecord, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Seek"), STAT_GASAttachEditor_CaptureSeek, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Query"), STAT_GASAttachEditor_CaptureQuery, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Snapshot Diff"), STAT_GASAttachEditor_SnapshotDiff, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flight Record"), STAT_GASAttachEditor_FlightRecord, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gameplay Debugger Collect"), STAT_GASAttachEditor_DebuggerCollect, STATGROUP_GASAttachEditor, GASATTACHRUNTIME_API);
+
+// Enable with -trace=cpu,GASAttachEditor, or Trace.Enable GASAttachEditor
+UE_TRACE_CHANNEL_EXTERN(GASAttachEditorChannel, GASATTACHRUNTIME_API);
+
+/** Times the enclosing scope for both the stat group and Insights */
+#define GAS_ATTACH_EDITOR_SCOPE(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, GASAttachEditorChannel)
\ No newline at end of file
@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class UClass;
+class UAbilitySystemComponent;
+struct FWorldContext;
+
+/**
+ * Plain-data copies of what the tabs show about a component, detached from any UObject.
+ *
+ * Classes and tags are kept by path name so that another process running the same project - the
+ * editor reading a stream, or a viewer reading a capture - can resolve them to its own objects.
+ */
+struct FGASAttributeSnapshot
+{
+	// Path of the attribute set class, and the attribute's property name in it
+	FName Set;
+	FName Name;
+	float BaseValue = 0.f;
+	float CurrentValue = 0.f;
+
+	bool operator==(const FGASAttributeSnapshot& Other) const
+	{
+		return
+			Set == Other.Set &&
+			Name == Other.Name &&
+			BaseValue == Other.BaseValue &&
+			CurrentValue == Other.CurrentValue;
+	}
+	bool operator!=(const FGASAttributeSnapshot& Other) const { return !(*this == Other); }
+};
+
+struct FGASEffectSnapshot
+{
+	uint32 Handle = 0;
+	// Path of the effect's class
+	FName Def;
+	float Level = 0.f;
+	int32 StackCount = 0;
+	float Duration = 0.f;
+	float Period = 0.f;
+	float StartWorldTime = 0.f;
+	bool bInhibited = false;
+	bool bPredicted = false;
+	bool bPredictedLocally = false;
+
+	// Evaluated magnitude of each modifier, in the order of the definition's modifiers
+	TArray<float> Modifiers;
+
+	bool operator==(const FGASEffectSnapshot& Other) const
+	{
+		return
+			Handle == Other.Handle &&
+			Def == Other.Def &&
+			Level == Other.Level &&
+			StackCount == Other.StackCount &&
+			Duration == Other.Duration &&
+			Period == Other.Period &&
+			StartWorldTime == Other.StartWorldTime &&
+			bInhibited == Other.bInhibited &&
+			bPredicted == Other.bPredicted &&
+			bPredictedLocally == Other.bPredictedLocally &&
+			Modifiers == Other.Modifiers;
+	}
+	bool operator!=(const FGASEffectSnapshot& Other) const { return !(*this == Other); }
+};
+
+enum class EGASAbilitySnapshotState : uint8
+{
+	Inactive,
+	Active,
+	InputBlocked,
+	TagBlocked,
+	Cooldown,
+};
+
+struct FGASAbilitySnapshot
+{
+	uint32 Handle = 0;
+	// Path of the ability's class
+	FName Ability;
+	int32 Level = 0;
+	uint8 ActiveCount = 0;
+	EGASAbilitySnapshotState State = EGASAbilitySnapshotState::Inactive;
+	float CooldownStartWorldTime = 0.f;
+	float CooldownDuration = 0.f;
+
+	bool operator==(const FGASAbilitySnapshot& Other) const
+	{
+		return
+			Handle == Other.Handle &&
+			Ability == Other.Ability &&
+			Level == Other.Level &&
+			ActiveCount == Other.ActiveCount &&
+			State == Other.State &&
+			CooldownStartWorldTime == Other.CooldownStartWorldTime &&
+			CooldownDuration == Other.CooldownDuration;
+	}
+	bool operator!=(const FGASAbilitySnapshot& Other) const { return !(*this == Other); }
+};
+
+struct FGASTagSnapshot
+{
+	FName Tag;
+	int32 Count = 0;
+
+	bool operator==(const FGASTagSnapshot& Other) const { return Tag == Other.Tag && Count == Other.Count; }
+	bool operator!=(const FGASTagSnapshot& Other) const { return !(*this == Other); }
+};
+
+/** The parts of a component a capture takes; see FGASComponentSnapshot::GetCaptureFunction */
+enum class EGASSnapshotChannels : uint8
+{
+	None			= 0,
+	Attributes		= 1 << 0,
+	// Only the attributes named in the capture's filter
+	AttributeFilter	= 1 << 1,
+	// Handle and class of each effect, which only change when it's applied or removed
+	Effects			= 1 << 2,
+	// Level, stacks, timing and modifiers of each effect, on top of Effects
+	EffectDetails	= 1 << 3,
+	Abilities		= 1 << 4,
+	// Owned and blocked tags
+	Tags			= 1 << 5,
+
+	All				= Attributes | AttributeFilter | Effects | EffectDetails | Abilities | Tags,
+	Full			= Attributes | Effects | EffectDetails | Abilities | Tags,
+};
+ENUM_CLASS_FLAGS(EGASSnapshotChannels);
+
+struct GASATTACHRUNTIME_API FGASComponentSnapshot
+{
+	// Unique among the components of one snapshot source for as long as it runs, never reused by a later component
+	uint32 Id = 0;
+	FName OwnerName;
+	FName OwnerClass;
+
+	TArray<FGASAttributeSnapshot> Attributes;
+	TArray<FGASEffectSnapshot> Effects;
+	TArray<FGASAbilitySnapshot> Abilities;
+	TArray<FGASTagSnapshot> OwnedTags;
+	TArray<FName> BlockedTags;
+
+	static void Capture(const UAbilitySystemComponent& Component, FGASComponentSnapshot& OutSnapshot);
+
+	/** Captures only some channels; the sections of the rest are left empty */
+	using FCaptureFunction = void(*)(const UAbilitySystemComponent& Component, const TSet<FName>& AttributeFilter, FGASComponentSnapshot& OutSnapshot);
+
+	/** The capture compiled for Channels, with the checks of every channel left out compiled away */
+	static FCaptureFunction GetCaptureFunction(EGASSnapshotChannels Channels);
+};
+
+struct GASATTACHRUNTIME_API FGASWorldSnapshot
+{
+	uint64 Frame = 0;
+	double WorldTime = 0.0;
+	// Zero while the world is paused
+	float TimeDilation = 1.f;
+	// Which process and world this came from, e.g. "Dedicated Server (1234)"
+	FString Source;
+
+	TArray<FGASComponentSnapshot> Components;
+
+	// FPlatformTime::Seconds() of this process when captured or received; never sent anywhere
+	double LocalTime = 0.0;
+
+	/** Captures every component of World, reusing the arrays of the previous capture. */
+	static void Capture(const UWorld* World, FGASWorldSnapshot& OutSnapshot);
+	/** Same, for only the components Filter accepts */
+	static void Capture(const UWorld* World, FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter);
+	/** Same, capturing each of them with CaptureComponent rather than in full */
+	static void Capture(const UWorld* World, FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter, TFunctionRef<void(const UAbilitySystemComponent&, FGASComponentSnapshot&)> CaptureComponent);
+
+	/** Captures this process' game world - or the first PIE world, in the editor - and names the source after it. */
+	static void CaptureGameWorld(FGASWorldSnapshot& OutSnapshot);
+	static void CaptureGameWorld(FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter);
+	static void CaptureGameWorld(FGASWorldSnapshot& OutSnapshot, TFunctionRef<bool(const UAbilitySystemComponent&)> Filter, TFunctionRef<void(const UAbilitySystemComponent&, FGASComponentSnapshot&)> CaptureComponent);
+
+	/** "Dedicated Server", "Client [2]" and so on */
+	static FText GetWorldName(const FWorldContext& WorldContext);
+
+	const FGASComponentSnapshot* FindComponent(uint32 Id) const;
+	FGASComponentSnapshot* FindComponent(uint32 Id);
+
+	/** Call after adding or removing components by hand */
+	void RebuildIndex();
+
+	/** A class path of a snapshot resolved to this process' class, loading it if needs be in the editor */
+	static UClass* ResolveClass(FName ClassPath);
+
+	/** "GE_Burning" for ".../GE_Burning.GE_Burning_C" */
+	static FString GetCleanName(FName ClassPath);
+
+private:
+	TMap<uint32, int32> ComponentIndices;
+};
\ No newline at end of file
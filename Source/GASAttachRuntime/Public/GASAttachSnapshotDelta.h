@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASAttachSnapshot.h"
+
+/**
+ * Encodes a series of world snapshots as deltas for one reader on the other end of a reliable, ordered
+ * channel.
+ *
+ * Only components that changed since the previous message are written, and of those only the sections
+ * that changed; attribute values are sent by index for as long as a component's attribute layout stays
+ * the same. Names travel as indices into a table both sides grow in step, so a path or tag is only ever
+ * sent as text once per connection. The first message after a Reset is a keyframe.
+ */
+class GASATTACHRUNTIME_API FGASSnapshotDeltaWriter
+{
+public:
+	/** Encodes Snapshot against the previous one written, which it then replaces. */
+	void Write(const FGASWorldSnapshot& Snapshot, TArray<uint8>& OutMessage);
+	void Reset();
+
+private:
+	friend struct FGASSnapshotDeltaWriterContext;
+
+	uint32 GetNameId(FName Name);
+
+private:
+	FGASWorldSnapshot Baseline;
+	bool bHasBaseline = false;
+
+	TMap<FName, uint32> NameIds;
+	TArray<FName> NewNames;
+};
+
+/** Applies the messages of a FGASSnapshotDeltaWriter, in order, to a snapshot of its own. */
+class GASATTACHRUNTIME_API FGASSnapshotDeltaReader
+{
+public:
+	/** False if the message is malformed or a delta arrived without its keyframe; Snapshot is then unusable until the next keyframe. */
+	bool Read(const TArray<uint8>& Message, FGASWorldSnapshot& InOutSnapshot);
+	void Reset();
+
+private:
+	friend struct FGASSnapshotDeltaReaderContext;
+
+	TArray<FName> Names;
+	bool bHasKeyframe = false;
+};
\ No newline at end of file
@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGASWorldSnapshot;
+struct FGASComponentSnapshot;
+
+enum class EGASDiffChange : uint8
+{
+	Unchanged,
+	Added,
+	Removed,
+	Changed,
+};
+
+/** An ability, attribute, effect or tag that isn't the same on both sides */
+struct FGASDiffEntry
+{
+	EGASDiffChange Change = EGASDiffChange::Unchanged;
+	// Class path of the ability or effect, name of the attribute, or the tag
+	FName Key;
+	// Path of the attribute's set; None for the rest
+	FName Set;
+	// As the report prints them; empty on the side it's missing from
+	FString Before;
+	FString After;
+};
+
+/**
+ * What differs on a component between two snapshots: its granted abilities, attribute values, active effects
+ * and owned tags.
+ *
+ * Abilities and effects are matched by class rather than handle, as handles don't carry over between two
+ * processes or two runs; several effects of one class are compared as one, by instances, stacks and level.
+ */
+struct GASATTACHRUNTIME_API FGASComponentDiff
+{
+	// Of the component after, or before if it was removed
+	uint32 Id = 0;
+	FName OwnerName;
+	// Added or Removed for a component only one side has
+	EGASDiffChange Change = EGASDiffChange::Unchanged;
+
+	// Each sorted by key
+	TArray<FGASDiffEntry> Abilities;
+	TArray<FGASDiffEntry> Attributes;
+	TArray<FGASDiffEntry> Effects;
+	TArray<FGASDiffEntry> Tags;
+
+	/** Either side may be null, for a component that was added or removed */
+	static void Compare(const FGASComponentSnapshot* Before, const FGASComponentSnapshot* After, FGASComponentDiff& OutDiff);
+
+	/**
+	 * After, plus what it lost since Before, for the tabs to show the removed rows too. Those come with
+	 * handles After doesn't use.
+	 */
+	static void Merge(const FGASComponentSnapshot* Before, const FGASComponentSnapshot* After, FGASComponentSnapshot& OutMerged);
+
+	bool HasChanges() const;
+
+	const FGASDiffEntry* FindAbility(FName Ability) const;
+	const FGASDiffEntry* FindAttribute(FName Set, FName Name) const;
+	const FGASDiffEntry* FindEffect(FName Def) const;
+	const FGASDiffEntry* FindTag(FName Tag) const;
+};
+
+/** The components that differ between two snapshots of a world - two captures, or two frames of one */
+struct GASATTACHRUNTIME_API FGASSnapshotDiff
+{
+	// By owner name
+	TArray<FGASComponentDiff> Components;
+
+	static void Compare(const FGASWorldSnapshot& Before, const FGASWorldSnapshot& After, FGASSnapshotDiff& OutDiff);
+
+	/**
+	 * The component of Other that is Component of World: the one with its id if both come from the same
+	 * source, the one with its owner's name otherwise.
+	 */
+	static const FGASComponentSnapshot* FindMatchingComponent(const FGASWorldSnapshot& Other, const FGASWorldSnapshot& World, const FGASComponentSnapshot& Component);
+
+	/**
+	 * Reads "File.gascapture" or "File.gascapture@Frame", Frame counting from 1 as the viewer does; the last
+	 * frame if there's no frame given.
+	 */
+	static bool LoadCapturePoint(const FString& Point, FGASWorldSnapshot& OutSnapshot, FText& OutError);
+
+	/** Plain text, a line per difference, for logs and files */
+	FString MakeReport(const FString& BeforeName, const FString& AfterName) const;
+};
\ No newline at end of file
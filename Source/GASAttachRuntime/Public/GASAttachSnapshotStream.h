@@ -0,0 +1,127 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GASAttachSnapshot.h"
+#include "GASAttachSnapshotDelta.h"
+
+class FSocket;
+
+/**
+ * Game or server side of the snapshot stream: captures the process' game world and sends it as deltas
+ * to one reader on the loopback interface.
+ *
+ * Listens on the first free port of GASAttachEditor.Stream.Port and the following PortRange ports. A
+ * snapshot is captured every GASAttachEditor.Stream.Interval seconds, but only once the reader took the
+ * previous one - a reader that falls behind makes the server capture less, never queue more. Sending
+ * is non-blocking and limited to GASAttachEditor.Stream.MaxBytesPerSecond.
+ */
+class GASATTACHRUNTIME_API FGASSnapshotStreamServer
+{
+public:
+	~FGASSnapshotStreamServer();
+
+	/** False if no port of the range could be listened on */
+	bool Start();
+	void Stop();
+
+	bool IsListening() const { return ListenSocket != nullptr; }
+	bool IsConnected() const { return Connection != nullptr; }
+	int32 GetPort() const { return Port; }
+	uint64 GetBytesSent() const { return BytesSent; }
+
+private:
+	bool Tick(float DeltaTime);
+
+	void AcceptConnection();
+	void CloseConnection();
+	void CaptureMessage();
+	void Flush();
+
+private:
+	FSocket* ListenSocket = nullptr;
+	FSocket* Connection = nullptr;
+	int32 Port = 0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FGASWorldSnapshot Snapshot;
+	FGASSnapshotDeltaWriter Writer;
+	TArray<uint8> Message;
+
+	// The framed message being sent, and how far into it the socket got
+	TArray<uint8> SendBuffer;
+	int32 SendOffset = 0;
+
+	// Bytes that may still be sent - refills at the bandwidth cap, up to one second's worth
+	double Allowance = 0.0;
+	double LastTickTime = 0.0;
+	double NextCaptureTime = 0.0;
+
+	uint64 BytesSent = 0;
+};
+
+/** Editor side of one snapshot stream: the latest snapshot of the process on the other end. */
+class GASATTACHRUNTIME_API FGASSnapshotStreamClient
+{
+public:
+	explicit FGASSnapshotStreamClient(int32 InPort);
+	~FGASSnapshotStreamClient();
+
+	/** Tries to connect when not connected; otherwise applies whatever arrived since the last tick. */
+	void Tick();
+
+	bool IsConnected() const { return Socket && !bConnecting; }
+	bool HasSnapshot() const { return bHasSnapshot; }
+	int32 GetPort() const { return Port; }
+	uint64 GetBytesReceived() const { return BytesReceived; }
+
+	const FGASWorldSnapshot& GetSnapshot() const { return Snapshot; }
+
+	/** "Dedicated Server (1234)", or the port while nothing arrived yet */
+	FText GetDisplayName() const;
+
+private:
+	void Connect();
+	bool FinishConnect();
+	void Disconnect();
+	bool Receive();
+
+private:
+	const int32 Port;
+	FSocket* Socket = nullptr;
+	bool bConnecting = false;
+
+	TArray<uint8> Chunk;
+	TArray<uint8> ReceiveBuffer;
+	TArray<uint8> Message;
+
+	FGASSnapshotDeltaReader Reader;
+	FGASWorldSnapshot Snapshot;
+	bool bHasSnapshot = false;
+
+	double NextConnectTime = 0.0;
+	uint64 BytesReceived = 0;
+};
+
+/**
+ * Every snapshot stream of the port range, as seen from the editor.
+ *
+ * Ports nothing listens on are retried every couple of seconds, so game and server processes show up
+ * on their own as they start, and drop out as they stop.
+ */
+class GASATTACHRUNTIME_API FGASSnapshotStreamBrowser
+{
+public:
+	void Tick();
+	void Reset();
+
+	/** Streams that are connected and delivered at least one snapshot */
+	void GetLiveStreams(TArray<const FGASSnapshotStreamClient*>& OutStreams) const;
+	const FGASSnapshotStreamClient* FindStream(int32 Port) const;
+
+private:
+	TArray<TUniquePtr<FGASSnapshotStreamClient>> Clients;
+};
\ No newline at end of file
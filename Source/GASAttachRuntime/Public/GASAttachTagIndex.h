@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGASWorldSnapshot;
+
+/**
+ * A set of frames as sorted, disjoint runs of consecutive frames.
+ *
+ * Tags tend to stay on or off for long stretches, so an hour of frames is usually a handful of runs, and
+ * combining two sets walks their runs rather than their frames.
+ */
+struct GASATTACHRUNTIME_API FGASFrameRuns
+{
+	struct FRun
+	{
+		int32 First = 0;
+		int32 Last = 0;
+	};
+
+	TArray<FRun> Runs;
+
+	/** Frames have to be added in increasing order */
+	void Add(int32 Frame);
+	bool Contains(int32 Frame) const;
+	int32 CountFrames() const;
+
+	static void Intersect(const FGASFrameRuns& A, const FGASFrameRuns& B, FGASFrameRuns& Out);
+	static void Union(const FGASFrameRuns& A, const FGASFrameRuns& B, FGASFrameRuns& Out);
+	/** The frames of A that aren't in B */
+	static void Subtract(const FGASFrameRuns& A, const FGASFrameRuns& B, FGASFrameRuns& Out);
+
+	/** Gaps and lengths as packed integers, so that a run costs a couple of bytes. Loading fails on runs past NumFrames */
+	void Serialize(FArchive& Ar, int32 NumFrames = MAX_int32);
+};
+
+/**
+ * Which frames each component of a capture was in, and owned each of its tags, kept up by the capture
+ * writer as it goes and stored at the end of the file, so that tag queries don't have to decode any frame.
+ */
+class GASATTACHRUNTIME_API FGASTagIndex
+{
+public:
+	struct FComponentTags
+	{
+		uint32 Id = 0;
+		FName OwnerName;
+		FGASFrameRuns Present;
+		// By tag name; a tag's parents are set along with it, as for HasMatchingGameplayTag
+		TMap<FName, FGASFrameRuns> Tags;
+	};
+
+	void Reset();
+
+	/** Adds the next frame, which is Frame */
+	void Add(int32 Frame, const FGASWorldSnapshot& Snapshot);
+
+	int32 GetNumFrames() const { return NumFrames; }
+	const TArray<FComponentTags>& GetComponents() const { return Components; }
+
+	/** Frames in which Component owned Tag or one of its children, as HasMatchingGameplayTag would have it; a single lookup */
+	static void GetTagRuns(const FComponentTags& Component, FName Tag, FGASFrameRuns& OutRuns);
+
+	/** False if what's read is malformed */
+	bool Serialize(FArchive& Ar);
+
+private:
+	/** Tag and each of its parents, split once per tag */
+	const TArray<FName>& GetTagPrefixes(FName Tag);
+
+private:
+	int32 NumFrames = 0;
+	TArray<FComponentTags> Components;
+	TMap<uint32, int32> ComponentIndices;
+	TMap<FName, TArray<FName>> TagPrefixes;
+};
\ No newline at end of file
@@ -0,0 +1,26 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+using UnrealBuildTool;
+
+public class GASCaptureViewer : ModuleRules
+{
+	public GASCaptureViewer(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PublicIncludePathModuleNames.Add("Launch");
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"ApplicationCore",
+				"Projects",
+				"Slate",
+				"SlateCore",
+				"StandaloneRenderer",
+				"GASAttachRuntime",
+				"GASAttachEditor",
+			}
+			);
+	}
+}
\ No newline at end of file
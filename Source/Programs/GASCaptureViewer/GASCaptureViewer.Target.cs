@@ -0,0 +1,32 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+using UnrealBuildTool;
+
+// Build from Engine/Source/Programs, with the plugin installed under Engine/Plugins - see README.md
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class GASCaptureViewerTarget : TargetRules
+{
+	public GASCaptureViewerTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Program;
+		LinkType = TargetLinkType.Monolithic;
+		LaunchModuleName = "GASCaptureViewer";
+		DefaultBuildSettings = BuildSettingsVersion.Latest;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+
+		// The viewer module is a DeveloperTool, and the tabs read ability and effect classes
+		bBuildDeveloperTools = true;
+		bCompileAgainstEngine = true;
+		bCompileAgainstCoreUObject = true;
+		bCompileAgainstApplicationCore = true;
+		bBuildWithEditorOnlyData = false;
+
+		bCompileWithPluginSupport = true;
+		EnablePlugins.Add("GameplayAbilities");
+		EnablePlugins.Add("GASAttachEditor");
+
+		// Launched from a shell on the machines it is meant for, and logs there
+		bIsBuildingConsoleApplication = true;
+		bHasExports = false;
+	}
+}
\ No newline at end of file
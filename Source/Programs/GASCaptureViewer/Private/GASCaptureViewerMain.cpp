@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RequiredProgramMainCPPInclude.h"
+#include "GASAttachEditor.h"
+#include "GASAttachSnapshotDiff.h"
+
+#include "StandaloneRenderer.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Widgets/SWindow.h"
+#include "Framework/Application/SlateApplication.h"
+
+IMPLEMENT_APPLICATION(GASCaptureViewer, "GASCaptureViewer");
+
+#define LOCTEXT_NAMESPACE "GASCaptureViewer"
+
+/**
+ * GASCaptureViewer [File.gascapture]
+ * GASCaptureViewer -diff <Before>[@Frame] <After>[@Frame] [-report=File]
+ *
+ * The capture viewer of the GASAttachEditor plugin in a window of its own. The engine is linked in for the
+ * ability and effect classes, but never initialized - no project, no content, no renderer beyond Slate's -
+ * which is what keeps its start short.
+ *
+ * With -diff it opens no window, and prints how the two snapshots differ, as GASAttachEditor.Capture.Diff
+ * does; frames count from 1 and default to the last. Exits with 0 if they're the same, 1 if they differ and
+ * 2 if either can't be read, so that a build step can check a capture against a known good one.
+ */
+static int32 RunDiff(const TArray<FString>& Tokens)
+{
+	if (Tokens.Num() < 2)
+	{
+		GLog->Log(TEXT("Usage: GASCaptureViewer -diff <Before>[@Frame] <After>[@Frame] [-report=File]"));
+		return 2;
+	}
+
+	FGASWorldSnapshot Before;
+	FGASWorldSnapshot After;
+	FText Error;
+	if (!FGASSnapshotDiff::LoadCapturePoint(Tokens[0], Before, Error) ||
+		!FGASSnapshotDiff::LoadCapturePoint(Tokens[1], After, Error))
+	{
+		GLog->Log(Error.ToString());
+		return 2;
+	}
+
+	FGASSnapshotDiff Diff;
+	FGASSnapshotDiff::Compare(Before, After, Diff);
+
+	const FString Report = Diff.MakeReport(Tokens[0], Tokens[1]);
+	GLog->Log(Report);
+
+	FString ReportFile;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-report="), ReportFile) &&
+		!FFileHelper::SaveStringToFile(Report, *ReportFile))
+	{
+		GLog->Logf(TEXT("Can't write %s"), *ReportFile);
+		return 2;
+	}
+
+	return Diff.Components.Num() > 0 ? 1 : 0;
+}
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	FTaskTagScope Scope(ETaskTag::EGameThread);
+
+	ON_SCOPE_EXIT
+	{
+		RequestEngineExit(TEXT("Exiting"));
+		FEngineLoop::AppPreExit();
+		FModuleManager::Get().UnloadModulesAtShutdown();
+		FEngineLoop::AppExit();
+	};
+
+	if (const int32 Result = GEngineLoop.PreInit(ArgC, ArgV))
+	{
+		return Result;
+	}
+
+	FModuleManager::Get().StartProcessingNewlyLoadedObjects();
+
+	// The first argument that isn't a switch is the capture to open
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	FCommandLine::Parse(FCommandLine::Get(), Tokens, Switches);
+
+	if (Switches.Contains(TEXT("diff")))
+	{
+		return RunDiff(Tokens);
+	}
+
+	FSlateApplication::InitializeAsStandaloneApplication(GetStandardStandaloneRenderer());
+
+	FGASAttachEditorModule& Module = FModuleManager::LoadModuleChecked<FGASAttachEditorModule>("GASAttachEditor");
+
+	const TSharedRef<SWindow> Window =
+		SNew(SWindow)
+		.Title(LOCTEXT("WindowTitle", "Ability System Capture Viewer"))
+		.ClientSize(FVector2D(1000.f, 700.f))
+		[
+			Module.MakeCaptureViewer(Tokens.Num() > 0 ? Tokens[0] : FString(), true)
+		];
+
+	Window->SetOnWindowClosed(FOnWindowClosed::CreateLambda([](const TSharedRef<SWindow>&)
+	{
+		RequestEngineExit(TEXT("Capture viewer closed"));
+	}));
+
+	FSlateApplication::Get().AddWindow(Window);
+
+	while (!IsEngineExitRequested())
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
+		FSlateApplication::Get().PumpMessages();
+		FSlateApplication::Get().Tick();
+		FPlatformProcess::Sleep(0.01f);
+		++GFrameCounter;
+	}
+
+	FSlateApplication::Shutdown();
+
+	return 0;
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file